@@ -17,10 +17,33 @@
 """Automatically generated unit tests list - DO NOT EDIT."""
 
 bigquery_unified_client_unit_tests = [
+    "blocking_thread_pool_test.cc",
     "client_test.cc",
     "connection_test.cc",
+    "internal/blocking_executor_test.cc",
     "internal/connection_impl_test.cc",
     "internal/default_options_test.cc",
+    "internal/job_long_poll_test.cc",
+    "internal/job_rest_stats_stub_test.cc",
+    "internal/job_watcher_test.cc",
+    "internal/lazy_connection_test.cc",
+    "internal/list_jobs_stream_test.cc",
+    "internal/prepared_options_test.cc",
+    "internal/query_cache_connection_test.cc",
+    "internal/query_cache_test.cc",
+    "internal/read_channel_pool_test.cc",
+    "internal/read_channels_test.cc",
+    "internal/read_metrics_stub_test.cc",
+    "internal/read_metrics_test.cc",
+    "internal/read_rows_watchdog_test.cc",
+    "internal/read_session_cache_test.cc",
+    "internal/read_strategy_test.cc",
+    "internal/read_tracing_test.cc",
+    "internal/shared_background_threads_test.cc",
+    "internal/table_schema_cache_test.cc",
+    "internal/table_schema_test.cc",
+    "internal/timer_wheel_test.cc",
     "internal/tracing_connection_test.cc",
     "mocks/mock_stream_range_test.cc",
+    "read_session_stats_test.cc",
 ]
@@ -0,0 +1,42 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/blocking_thread_pool.h"
+#include "google/cloud/bigquery_unified/internal/blocking_executor.h"
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+std::shared_ptr<BlockingExecutor> GetBlockingExecutor(
+    bigquery_unified::BlockingThreadPool const& pool) {
+  return pool.executor_;
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+namespace google::cloud::bigquery_unified {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+BlockingThreadPool::BlockingThreadPool(std::size_t max_threads,
+                                       std::chrono::milliseconds idle_timeout)
+    : executor_(std::make_shared<bigquery_unified_internal::BlockingExecutor>(
+          max_threads, idle_timeout)) {}
+
+std::size_t BlockingThreadPool::max_threads() const {
+  return executor_->max_threads();
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified
@@ -0,0 +1,78 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_BLOCKING_THREAD_POOL_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_BLOCKING_THREAD_POOL_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+class BlockingExecutor;
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+namespace google::cloud::bigquery_unified {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+class BlockingThreadPool;
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+std::shared_ptr<BlockingExecutor> GetBlockingExecutor(
+    bigquery_unified::BlockingThreadPool const& pool);
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+namespace google::cloud::bigquery_unified {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * A pool of threads for the blocking work of one or more connections.
+ *
+ * Connections run the blocking RPCs of job polling, including the long polls,
+ * of operations that fan out (such as `Client::ReadArrowPartitions()`), and the
+ * decoding of prefetched results on a pool of threads, so they do not block
+ * the completion queue.
+ * By default each connection has its own pools. Use `BlockingThreadPoolOption`
+ * to share one pool between all the connections of a process.
+ *
+ * The threads are created on demand, up to `max_threads`, and exit after they
+ * have been idle for `idle_timeout`. An unused pool holds no threads.
+ */
+class BlockingThreadPool {
+ public:
+  explicit BlockingThreadPool(
+      std::size_t max_threads,
+      std::chrono::milliseconds idle_timeout = std::chrono::seconds(30));
+
+  /// The maximum number of threads in the pool.
+  std::size_t max_threads() const;
+
+ private:
+  friend std::shared_ptr<bigquery_unified_internal::BlockingExecutor>
+  bigquery_unified_internal::GetBlockingExecutor(
+      BlockingThreadPool const& pool);
+
+  std::shared_ptr<bigquery_unified_internal::BlockingExecutor> executor_;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_BLOCKING_THREAD_POOL_H
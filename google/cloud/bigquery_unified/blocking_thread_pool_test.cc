@@ -0,0 +1,35 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/blocking_thread_pool.h"
+#include "google/cloud/bigquery_unified/internal/blocking_executor.h"
+#include <gmock/gmock.h>
+
+namespace google::cloud::bigquery_unified {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+TEST(BlockingThreadPoolTest, Basic) {
+  BlockingThreadPool pool(4);
+  EXPECT_EQ(pool.max_threads(), 4U);
+
+  // All the users of the pool share one executor.
+  auto executor = bigquery_unified_internal::GetBlockingExecutor(pool);
+  EXPECT_EQ(executor, bigquery_unified_internal::GetBlockingExecutor(pool));
+  EXPECT_EQ(executor->Run([] { return 42; }).get(), 42);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified
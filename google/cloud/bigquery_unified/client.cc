@@ -13,23 +13,21 @@
 // limitations under the License.
 
 #include "google/cloud/bigquery_unified/client.h"
+#include "google/cloud/bigquery_unified/internal/read_strategy.h"
 #include "google/cloud/bigquery_unified/job_options.h"
-#include "google/cloud/bigquery_unified/read_options.h"
 #include "google/cloud/internal/absl_str_cat_quiet.h"
 #include "google/cloud/internal/make_status.h"
 #include "google/cloud/internal/pagination_range.h"
 #include "google/cloud/options.h"
-#include "google/cloud/project.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/str_replace.h"
+#include <map>
 
 namespace google::cloud::bigquery_unified {
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
 namespace {
-std::string TableReferenceFullName(
-    google::cloud::bigquery::v2::TableReference const& table_reference) {
-  return absl::StrCat("projects/", table_reference.project_id(), "/datasets/",
-                      table_reference.dataset_id(), "/tables/",
-                      table_reference.table_id());
-}
+
+using ::google::cloud::bigquery_unified_internal::MakeReadSessionRequest;
 
 std::string DetermineBillingProject(
     Options const& options, std::string const& default_billing_project) {
@@ -39,74 +37,116 @@ std::string DetermineBillingProject(
   return default_billing_project;
 }
 
+// Returns @p column as a quoted identifier, so any name selects that column.
+std::string QuoteColumnName(std::string const& column) {
+  return absl::StrCat(
+      "`", absl::StrReplaceAll(column, {{"\\", "\\\\"}, {"`", "\\`"}}),
+      "`");
+}
+
 }  // namespace
 
 Client::Client(std::shared_ptr<Connection> connection, Options opts)
     : connection_(std::move(connection)),
+      client_options_(std::move(opts)),
       options_(
-          internal::MergeOptions(std::move(opts), connection_->options())) {}
+          internal::MergeOptions(client_options_, connection_->options())) {}
+
+Options Client::CallOptions(Options opts) const {
+  // The connection merges its own options under these, there is no need to
+  // copy them on each call.
+  if (internal::IsEmpty(opts)) return client_options_;
+  return internal::MergeOptions(std::move(opts), client_options_);
+}
+
+future<Status> Client::WarmUp(Options opts) {
+  return connection_->WarmUp(CallOptions(std::move(opts)));
+}
 
 future<StatusOr<google::cloud::bigquery::v2::Job>> Client::CancelJob(
     google::cloud::bigquery::v2::CancelJobRequest const& request,
     Options opts) {
-  return connection_->CancelJob(
-      request, internal::MergeOptions(std::move(opts), options_));
+  return connection_->CancelJob(request, CallOptions(std::move(opts)));
 }
 
 StatusOr<google::cloud::bigquery::v2::JobReference> Client::CancelJob(
     google::cloud::NoAwaitTag,
     google::cloud::bigquery::v2::CancelJobRequest const& request,
     Options opts) {
-  return connection_->CancelJob(
-      google::cloud::NoAwaitTag{}, request,
-      internal::MergeOptions(std::move(opts), options_));
+  return connection_->CancelJob(google::cloud::NoAwaitTag{}, request,
+                                CallOptions(std::move(opts)));
 }
 
 future<StatusOr<google::cloud::bigquery::v2::Job>> Client::CancelJob(
     google::cloud::bigquery::v2::JobReference const& job_reference,
     Options opts) {
-  return connection_->CancelJob(
-      job_reference, internal::MergeOptions(std::move(opts), options_));
+  return connection_->CancelJob(job_reference, CallOptions(std::move(opts)));
 }
 
 StatusOr<google::cloud::bigquery::v2::Job> Client::GetJob(
     google::cloud::bigquery::v2::GetJobRequest const& request, Options opts) {
-  return connection_->GetJob(request,
-                             internal::MergeOptions(std::move(opts), options_));
+  return connection_->GetJob(request, CallOptions(std::move(opts)));
 }
 
 Status Client::DeleteJob(
     google::cloud::bigquery::v2::DeleteJobRequest const& request,
     Options opts) {
-  return connection_->DeleteJob(
-      request, internal::MergeOptions(std::move(opts), options_));
+  return connection_->DeleteJob(request, CallOptions(std::move(opts)));
+}
+
+StatusOr<std::vector<JobOperationResult>> Client::CancelJobs(
+    JobFilter const& filter, Options opts) {
+  return connection_->CancelJobs(filter, CallOptions(std::move(opts)));
+}
+
+StatusOr<std::vector<JobOperationResult>> Client::DeleteJobs(
+    JobFilter const& filter, Options opts) {
+  return connection_->DeleteJobs(filter, CallOptions(std::move(opts)));
 }
 
 StreamRange<google::cloud::bigquery::v2::ListFormatJob> Client::ListJobs(
     google::cloud::bigquery::v2::ListJobsRequest request, Options opts) {
-  return connection_->ListJobs(
-      std::move(request), internal::MergeOptions(std::move(opts), options_));
+  return connection_->ListJobs(std::move(request),
+                               CallOptions(std::move(opts)));
+}
+
+StreamRange<google::cloud::bigquery::v2::ListFormatJob>
+Client::ListJobsInProjects(std::vector<std::string> const& project_ids,
+                           google::cloud::bigquery::v2::ListJobsRequest request,
+                           Options opts) {
+  std::vector<google::cloud::bigquery::v2::ListJobsRequest> requests;
+  requests.reserve(project_ids.size());
+  for (auto const& project_id : project_ids) {
+    request.set_project_id(project_id);
+    requests.push_back(request);
+  }
+  return connection_->ListJobsInProjects(std::move(requests),
+                                         CallOptions(std::move(opts)));
 }
 
 future<StatusOr<google::cloud::bigquery::v2::Job>> Client::InsertJob(
     google::cloud::bigquery::v2::Job const& job, Options opts) {
-  return connection_->InsertJob(
-      job, internal::MergeOptions(std::move(opts), options_));
+  return connection_->InsertJob(job, CallOptions(std::move(opts)));
 }
 
 StatusOr<google::cloud::bigquery::v2::JobReference> Client::InsertJob(
     google::cloud::NoAwaitTag, google::cloud::bigquery::v2::Job const& job,
     Options opts) {
-  return connection_->InsertJob(
-      google::cloud::NoAwaitTag{}, job,
-      internal::MergeOptions(std::move(opts), options_));
+  return connection_->InsertJob(google::cloud::NoAwaitTag{}, job,
+                                CallOptions(std::move(opts)));
 }
 
 future<StatusOr<google::cloud::bigquery::v2::Job>> Client::InsertJob(
     google::cloud::bigquery::v2::JobReference const& job_reference,
     Options opts) {
-  return connection_->InsertJob(
-      job_reference, internal::MergeOptions(std::move(opts), options_));
+  return connection_->InsertJob(job_reference, CallOptions(std::move(opts)));
+}
+
+std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>>
+Client::InsertJobs(absl::Span<google::cloud::bigquery::v2::Job const> jobs,
+                   Options opts) {
+  return connection_->InsertJobs({jobs.begin(), jobs.end()},
+                                 CallOptions(std::move(opts)));
 }
 
 StatusOr<ReadArrowResponse> Client::ReadArrow(
@@ -115,19 +155,20 @@ StatusOr<ReadArrowResponse> Client::ReadArrow(
   auto const& job_reference = job.job_reference();
   auto billing_project =
       DetermineBillingProject(current_options, job_reference.project_id());
+  auto estimated_rows = bigquery_unified_internal::EstimateJobResultRows(job);
 
   if (job.configuration().job_type() == "QUERY") {
     return ReadArrowHelper(job.configuration().query().destination_table(),
                            std::move(billing_project),
-                           std::move(current_options));
+                           std::move(current_options), estimated_rows);
   } else if (job.configuration().job_type() == "COPY") {
     return ReadArrowHelper(job.configuration().copy().destination_table(),
                            std::move(billing_project),
-                           std::move(current_options));
+                           std::move(current_options), estimated_rows);
   } else if (job.configuration().job_type() == "LOAD") {
     return ReadArrowHelper(job.configuration().load().destination_table(),
                            std::move(billing_project),
-                           std::move(current_options));
+                           std::move(current_options), estimated_rows);
   }
   return internal::InvalidArgumentError(
       absl::StrCat("Job: ", job_reference.job_id(),
@@ -157,42 +198,84 @@ StatusOr<ReadArrowResponse> Client::ReadArrow(
   auto const billing_project =
       DetermineBillingProject(current_options, table_reference.project_id());
   return ReadArrowHelper(table_reference, billing_project,
-                         std::move(current_options));
+                         std::move(current_options), absl::nullopt);
 }
 
 StatusOr<ReadArrowResponse> Client::ReadArrow(
     google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
         read_session_request,
     Options opts) {
-  return connection_->ReadArrow(
-      read_session_request, internal::MergeOptions(std::move(opts), options_));
+  return connection_->ReadArrow(read_session_request,
+                                CallOptions(std::move(opts)));
 }
 
-StatusOr<ReadArrowResponse> Client::ReadArrowHelper(
+StatusOr<ReadArrowPartitionsResponse> Client::ReadArrowPartitions(
     google::cloud::bigquery::v2::TableReference const& table_reference,
-    std::string billing_project, Options opts) {
-  google::cloud::bigquery::storage::v1::CreateReadSessionRequest
-      read_session_request;
-  read_session_request.set_parent(
-      google::cloud::Project(std::move(billing_project)).FullName());
-
-  if (opts.has<bigquery_unified::MaxReadStreamsOption>()) {
-    read_session_request.set_max_stream_count(
-        opts.get<bigquery_unified::MaxReadStreamsOption>());
+    PartitionRange const& range, Options opts) {
+  if (range.last < range.first) {
+    return internal::InvalidArgumentError(
+        absl::StrCat("Invalid partition range: ",
+                     absl::FormatCivilTime(range.first), " is after ",
+                     absl::FormatCivilTime(range.last)),
+        GCP_ERROR_INFO());
+  }
+  auto const days = range.last - range.first + 1;
+  if (days > kMaxPartitionRangeDays) {
+    return internal::InvalidArgumentError(
+        absl::StrCat("Invalid partition range: ", days,
+                     " partitions, the maximum is ", kMaxPartitionRangeDays),
+        GCP_ERROR_INFO());
   }
+  if (range.column.empty()) {
+    return internal::InvalidArgumentError(
+        "Invalid partition range: the column is empty", GCP_ERROR_INFO());
+  }
+  // The requests need the connection options, the connection does not.
+  auto const request_options = internal::MergeOptions(opts, options_);
+  auto const billing_project =
+      DetermineBillingProject(request_options, table_reference.project_id());
+  auto const column = QuoteColumnName(range.column);
 
-  if (opts.has<bigquery_unified::PreferredMinimumReadStreamsOption>()) {
-    read_session_request.set_preferred_min_stream_count(
-        opts.get<bigquery_unified::PreferredMinimumReadStreamsOption>());
+  std::map<std::string,
+           google::cloud::bigquery::storage::v1::CreateReadSessionRequest>
+      partition_requests;
+  for (auto day = range.first; day <= range.last; ++day) {
+    auto const date = absl::FormatCivilTime(day);
+    auto request = MakeReadSessionRequest(table_reference, billing_project,
+                                          request_options, absl::nullopt);
+    request.mutable_read_session()->mutable_read_options()->set_row_restriction(
+        absl::StrCat(column, " = DATE '", date, "'"));
+    partition_requests.emplace(absl::StrReplaceAll(date, {{"-", ""}}),
+                               std::move(request));
   }
+  return connection_->ReadArrowPartitions(std::move(partition_requests),
+                                          CallOptions(std::move(opts)));
+}
 
-  google::cloud::bigquery::storage::v1::ReadSession read_session;
-  read_session.set_data_format(
-      google::cloud::bigquery::storage::v1::DataFormat::ARROW);
-  read_session.set_table(TableReferenceFullName(table_reference));
-  *read_session_request.mutable_read_session() = read_session;
+future<StatusOr<ReadArrowResponse>> Client::QueryArrow(
+    google::cloud::bigquery::v2::Job const& job, Options opts) {
+  return connection_->QueryArrow(job, CallOptions(std::move(opts)));
+}
 
-  return ReadArrow(read_session_request, std::move(opts));
+StatusOr<std::shared_ptr<arrow::Schema>> Client::GetArrowSchema(
+    google::cloud::bigquery::v2::TableReference const& table_reference,
+    std::vector<std::string> const& selected_fields, Options opts) {
+  google::cloud::bigquery::v2::GetTableRequest request;
+  request.set_project_id(table_reference.project_id());
+  request.set_dataset_id(table_reference.dataset_id());
+  request.set_table_id(table_reference.table_id());
+  request.set_selected_fields(absl::StrJoin(selected_fields, ","));
+  return connection_->GetArrowSchema(request, CallOptions(std::move(opts)));
+}
+
+StatusOr<ReadArrowResponse> Client::ReadArrowHelper(
+    google::cloud::bigquery::v2::TableReference const& table_reference,
+    std::string billing_project, Options opts,
+    absl::optional<std::int64_t> estimated_rows) {
+  return ReadArrow(MakeReadSessionRequest(table_reference,
+                                          std::move(billing_project), opts,
+                                          estimated_rows),
+                   std::move(opts));
 }
 
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
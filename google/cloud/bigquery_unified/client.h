@@ -16,15 +16,22 @@
 #define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_CLIENT_H
 
 #include "google/cloud/bigquery_unified/connection.h"
+#include "google/cloud/bigquery_unified/job_filter.h"
+#include "google/cloud/bigquery_unified/partition_range.h"
 #include "google/cloud/bigquery_unified/read_arrow_response.h"
 #include "google/cloud/bigquery_unified/version.h"
 #include "google/cloud/future.h"
 #include "google/cloud/no_await_tag.h"
 #include "google/cloud/options.h"
 #include "google/cloud/status_or.h"
+#include "absl/types/optional.h"
+#include "absl/types/span.h"
 #include <google/cloud/bigquery/storage/v1/storage.pb.h>
 #include <google/cloud/bigquery/v2/job.pb.h>
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace google::cloud::bigquery_unified {
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
@@ -80,6 +87,31 @@ class Client {
   friend bool operator!=(Client const& a, Client const& b) { return !(a == b); }
   ///@}
 
+  // clang-format off
+  ///
+  /// Prepares the connection for its first requests.
+  ///
+  /// The first requests on a new connection pay for establishing the gRPC
+  /// channels and the REST connection, the TLS handshakes, and fetching the
+  /// access tokens. This function connects the Storage Read API channels and
+  /// fetches their access token, and lists a single job of the
+  /// `bigquery_unified::BillingProjectOption` project on the REST connection,
+  /// concurrently, so the later requests do not. Without a billing project
+  /// the REST connection is not warmed up. Set
+  /// `bigquery_unified::WarmUpOnCreateOption` to start the warm-up when the
+  /// connection is created.
+  ///
+  /// @param opts Optional. Override the class-level options.
+  /// @return a [`future`] satisfied when the warm-up completes. The [`Status`]
+  ///     contains any error that would also fail later requests, such as
+  ///     failing to connect or to authenticate.
+  ///
+  /// [`future`]: @ref google::cloud::future
+  /// [`Status`]: @ref google::cloud::Status
+  ///
+  // clang-format on
+  future<Status> WarmUp(Options opts = {});
+
   // clang-format off
   ///
   /// Requests that a job be cancelled. Cancelled jobs may still incur costs.
@@ -149,6 +181,50 @@ class Client {
   Status DeleteJob(google::cloud::bigquery::v2::DeleteJobRequest const& request,
                    Options opts = {});
 
+  // clang-format off
+  ///
+  /// Cancels all the jobs matched by a filter.
+  ///
+  /// The jobs are listed with `jobs.list`, and cancelled concurrently, using up
+  /// to `bigquery_unified::MaxConcurrentRpcsOption` RPCs at a time. This call
+  /// returns once a cancellation was requested for each job, without waiting
+  /// for the jobs to stop, unless `bigquery_unified::CancelJobsAwaitOption` is
+  /// set to `true`.
+  ///
+  /// @param filter The jobs to cancel. If `filter.states` is empty, the
+  ///     pending and running jobs are cancelled.
+  /// @param opts Optional. Override the class-level options, such as retry and
+  ///     backoff policies.
+  /// @return the result for each matched job. If the jobs cannot be listed,
+  ///     the [`StatusOr`] contains the error details, and no job is cancelled.
+  ///
+  /// [`StatusOr`]: @ref google::cloud::StatusOr
+  ///
+  // clang-format on
+  StatusOr<std::vector<JobOperationResult>> CancelJobs(JobFilter const& filter,
+                                                       Options opts = {});
+
+  // clang-format off
+  ///
+  /// Deletes the metadata of all the jobs matched by a filter.
+  ///
+  /// The jobs are listed with `jobs.list`, and deleted concurrently, using up
+  /// to `bigquery_unified::MaxConcurrentRpcsOption` RPCs at a time. Note that
+  /// running jobs cannot be deleted, their results contain the error.
+  ///
+  /// @param filter The jobs to delete. If `filter.states` is empty, jobs in
+  ///     any state are matched.
+  /// @param opts Optional. Override the class-level options, such as retry and
+  ///     backoff policies.
+  /// @return the result for each matched job. If the jobs cannot be listed,
+  ///     the [`StatusOr`] contains the error details, and no job is deleted.
+  ///
+  /// [`StatusOr`]: @ref google::cloud::StatusOr
+  ///
+  // clang-format on
+  StatusOr<std::vector<JobOperationResult>> DeleteJobs(JobFilter const& filter,
+                                                       Options opts = {});
+
   // clang-format off
   ///
   /// Returns information about a specific job. Job information is available for
@@ -190,6 +266,11 @@ class Client {
   /// project role, or the Is Owner project role if you set the allUsers
   /// property.
   ///
+  /// The next page of results is fetched in the background while the current
+  /// page is consumed. Use `bigquery_unified::ListJobsProjectionOption` and
+  /// `bigquery_unified::ListJobsStateFilterOption` to reduce the amount of
+  /// data returned.
+  ///
   /// @param request Unary RPCs, such as the one wrapped by this
   ///     function, receive a single `request` proto message which includes all
   ///     the inputs for the RPC. In this case, the proto message is a
@@ -225,6 +306,31 @@ class Client {
   StreamRange<google::cloud::bigquery::v2::ListFormatJob> ListJobs(
       google::cloud::bigquery::v2::ListJobsRequest request, Options opts = {});
 
+  // clang-format off
+  ///
+  /// Lists the jobs in several projects, listing the projects in parallel.
+  ///
+  /// Each project is listed with a copy of @p request, with its `project_id`
+  /// replaced. Up to `bigquery_unified::MaxConcurrentRpcsOption` projects are
+  /// listed at the same time. The jobs of each project are returned in the
+  /// same order as `ListJobs()`, but the jobs from different projects are
+  /// interleaved.
+  ///
+  /// @param project_ids The projects to list.
+  /// @param request The [google.cloud.bigquery.v2.ListJobsRequest] used for
+  ///     each project.
+  /// @param opts Optional. Override the class-level options, such as retry and
+  ///     backoff policies.
+  /// @return a [StreamRange](@ref google::cloud::StreamRange) to iterate over
+  ///     the jobs of all the projects. The iteration stops at the first error.
+  ///
+  /// [google.cloud.bigquery.v2.ListJobsRequest]: @googleapis_reference_link{google/cloud/bigquery/v2/job.proto#L244}
+  ///
+  // clang-format on
+  StreamRange<google::cloud::bigquery::v2::ListFormatJob> ListJobsInProjects(
+      std::vector<std::string> const& project_ids,
+      google::cloud::bigquery::v2::ListJobsRequest request, Options opts = {});
+
   // clang-format off
   ///
   /// Starts a new asynchronous job.
@@ -232,6 +338,11 @@ class Client {
   /// Unless `bigquery_unified::BillingProjectOption` is set, the billing
   /// project is determined by interrogating the provided `Job`.
   ///
+  /// If the `Job` has no job id, the client generates a random one. With a
+  /// job id the insertion is idempotent, so transient failures are retried
+  /// using the configured retry policy. If a retried attempt reports that the
+  /// job already exists, the job created by the earlier attempt is returned.
+  ///
   /// @param job Unary RPCs, such as the one wrapped by this
   ///     function, receive a single `request` proto message which includes all
   ///     the inputs for the RPC. In this case, the proto message is a
@@ -266,6 +377,34 @@ class Client {
       google::cloud::bigquery::v2::JobReference const& job_reference,
       Options opts = {});
 
+  // clang-format off
+  ///
+  /// Starts many new asynchronous jobs.
+  ///
+  /// The jobs are submitted in the background, up to
+  /// `bigquery_unified::MaxConcurrentRpcsOption` at a time and using at most
+  /// half of the blocking threads of the connection, and this function returns
+  /// without waiting for any `InsertJob` RPC. Each job is then awaited
+  /// as in `InsertJob()`, using the configured
+  /// `bigquery_unified::JobCompletionStrategyOption`.
+  ///
+  /// Unless `bigquery_unified::BillingProjectOption` is set, the billing
+  /// project of each job is determined by interrogating the job.
+  ///
+  /// @param jobs The jobs to start.
+  /// @param opts Optional. Override the class-level options, such as retry and
+  ///     backoff policies.
+  /// @return one future per job, in the order of @p jobs. Each [`future`] is
+  ///     satisfied when its job completes, or with the error details if the
+  ///     job could not be started or awaited.
+  ///
+  /// [`future`]: @ref google::cloud::future
+  ///
+  // clang-format on
+  std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>> InsertJobs(
+      absl::Span<google::cloud::bigquery::v2::Job const> jobs,
+      Options opts = {});
+
   // clang-format off
   ///
   /// Reads data in the Apache Arrow RecordBatch format from BigQuery.
@@ -276,6 +415,9 @@ class Client {
   /// suggested number of readers will be present in the response.
   /// Setting `bigquery_unified::MaxReadStreamsOption` is required to guarantee
   /// ordering when reading results from ordered queries.
+  /// When reading the results of a `Job`, and neither of the stream count
+  /// options are set, `bigquery_unified::ReadStrategyOption` uses the row
+  /// count in the job statistics to choose the number of streams.
   ///
   /// @param job Unary RPCs, such as the one wrapped by this
   ///     function, receive a single `request` proto message which includes all
@@ -324,12 +466,108 @@ class Client {
           read_session_request,
       Options opts = {});
 
+  // clang-format off
+  ///
+  /// Reads a range of daily partitions of a date partitioned table in the
+  /// Apache Arrow RecordBatch format.
+  ///
+  /// Each partition in @p range is read by its own read session, with a row
+  /// restriction selecting only that partition. The sessions are created
+  /// concurrently, using up to `bigquery_unified::MaxConcurrentRpcsOption`
+  /// RPCs at a time. The streams of all the sessions are returned together,
+  /// each tagged with its partition id, and the schema of every record batch
+  /// contains the partition id under `kPartitionIdMetadataKey`. Partitions
+  /// without any data have no streams.
+  ///
+  /// The stream count options apply to each partition separately. Ranges of
+  /// more than `kMaxPartitionRangeDays` partitions are rejected.
+  ///
+  /// @param table_reference The date partitioned table.
+  /// @param range The partitions to read. Note that the partitions of tables
+  ///     partitioned by a `TIMESTAMP` or `DATETIME` column cannot be selected
+  ///     with this function.
+  /// @param opts Optional. Override the class-level options, such as retry and
+  ///     backoff policies.
+  /// @return the streams of all partitions, ordered by partition.
+  ///     If the request fails, the [`StatusOr`] contains the error details.
+  ///
+  /// [`StatusOr`]: @ref google::cloud::StatusOr
+  ///
+  // clang-format on
+  StatusOr<ReadArrowPartitionsResponse> ReadArrowPartitions(
+      google::cloud::bigquery::v2::TableReference const& table_reference,
+      PartitionRange const& range, Options opts = {});
+
+  // clang-format off
+  ///
+  /// Runs a query and reads its results in the Apache Arrow RecordBatch
+  /// format.
+  ///
+  /// This is equivalent to awaiting `InsertJob()` and then calling
+  /// `ReadArrow()` with the completed job, but overlaps the two: the
+  /// connection to the Storage Read API is prepared while the query runs, and
+  /// the read session is created, and all its streams are opened
+  /// concurrently, as soon as the job completes.
+  ///
+  /// @param job The query job to run. The job must have a `query`
+  ///     configuration.
+  /// @param opts Optional. Override the class-level options, such as retry and
+  ///     backoff policies. The read options, such as
+  ///     `bigquery_unified::ReadStrategyOption`, apply to reading the results.
+  /// @return a [`future`] satisfied with the readers for the query results.
+  ///     If the job is not a query, fails, or its results cannot be read, the
+  ///     [`StatusOr`] contains the error details.
+  ///
+  /// [`future`]: @ref google::cloud::future
+  /// [`StatusOr`]: @ref google::cloud::StatusOr
+  ///
+  // clang-format on
+  future<StatusOr<ReadArrowResponse>> QueryArrow(
+      google::cloud::bigquery::v2::Job const& job, Options opts = {});
+
+  // clang-format off
+  ///
+  /// Returns the Apache Arrow schema of a table without reading any data.
+  ///
+  /// The schema is computed from the table metadata, mapping each BigQuery
+  /// type to the Arrow type used by the Storage Read API. No read session is
+  /// created. Table schemas are cached for
+  /// `bigquery_unified::TableSchemaCacheTtlOption`, so repeated calls for the
+  /// same table, with any @p selected_fields, usually make no RPCs. The
+  /// number of cached schemas is bounded by
+  /// `bigquery_unified::TableSchemaCacheSizeOption`.
+  ///
+  /// @param table_reference The table.
+  /// @param selected_fields Optional. The names of the fields to include in
+  ///     the schema, using dots for nested fields, e.g. `"a.b"`. Like column
+  ///     names in BigQuery, they are case-insensitive. If empty, all the
+  ///     fields are included.
+  /// @param opts Optional. Override the class-level options, such as retry and
+  ///     backoff policies.
+  /// @return the Arrow schema of the selected fields, in table order.
+  ///     If a selected field does not exist, or the table uses a type without
+  ///     a known Arrow mapping, the [`StatusOr`] contains an
+  ///     `InvalidArgument` error.
+  ///
+  /// [`StatusOr`]: @ref google::cloud::StatusOr
+  ///
+  // clang-format on
+  StatusOr<std::shared_ptr<arrow::Schema>> GetArrowSchema(
+      google::cloud::bigquery::v2::TableReference const& table_reference,
+      std::vector<std::string> const& selected_fields = {}, Options opts = {});
+
  private:
   StatusOr<ReadArrowResponse> ReadArrowHelper(
       google::cloud::bigquery::v2::TableReference const& table_reference,
-      std::string billing_project, Options opts);
+      std::string billing_project, Options opts,
+      absl::optional<std::int64_t> estimated_rows);
+
+  // The options for a connection call: @p opts merged over the options given
+  // to the constructor.
+  Options CallOptions(Options opts) const;
 
   std::shared_ptr<Connection> connection_;
+  Options client_options_;
   Options options_;
 };
 
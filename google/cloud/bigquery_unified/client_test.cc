@@ -15,8 +15,11 @@
 #include "google/cloud/bigquery_unified/client.h"
 #include "google/cloud/bigquery_unified/job_options.h"
 #include "google/cloud/bigquery_unified/mocks/mock_connection.h"
+#include "google/cloud/bigquery_unified/mocks/mock_stream_range.h"
+#include "google/cloud/bigquery_unified/read_options.h"
 #include "google/cloud/bigquery_unified/testing_util/status_matchers.h"
 #include "google/cloud/internal/make_status.h"
+#include <arrow/api.h>
 
 namespace google::cloud::bigquery_unified {
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
@@ -26,12 +29,14 @@ using ::google::cloud::bigquery_unified::testing_util::IsOkAndHolds;
 using ::google::cloud::bigquery_unified::testing_util::StatusIs;
 using ::google::cloud::bigquery_unified_mocks::MockConnection;
 using ::testing::AllOf;
+using ::testing::ElementsAre;
 using ::testing::Eq;
 using ::testing::HasSubstr;
 using ::testing::IsSupersetOf;
 using ::testing::Pair;
 using ::testing::ResultOf;
 using ::testing::Return;
+using ::testing::SizeIs;
 
 struct TestOption {
   using Type = std::string;
@@ -71,6 +76,98 @@ TEST(BigQueryUnifiedClientTest, GetJobSuccess) {
               "my-job-id"))));
 }
 
+TEST(BigQueryUnifiedClientTest, CallOptionsOmitConnectionOptions) {
+  struct ConnectionOption {
+    using Type = std::string;
+  };
+  auto mock_connection = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock_connection, options)
+      .WillRepeatedly(
+          Return(Options{}.set<ConnectionOption>("connection-option")));
+  EXPECT_CALL(*mock_connection, GetJob)
+      .WillOnce([](google::cloud::bigquery::v2::GetJobRequest const&,
+                   Options const& opts) {
+        // The connection merges its own options.
+        EXPECT_FALSE(opts.has<ConnectionOption>());
+        EXPECT_THAT(opts.get<TestOption>(), Eq("client-test-option"));
+        return google::cloud::bigquery::v2::Job{};
+      })
+      .WillOnce([](google::cloud::bigquery::v2::GetJobRequest const&,
+                   Options const& opts) {
+        EXPECT_FALSE(opts.has<ConnectionOption>());
+        EXPECT_THAT(opts.get<TestOption>(), Eq("call-test-option"));
+        return google::cloud::bigquery::v2::Job{};
+      });
+
+  auto client =
+      Client(mock_connection, Options{}.set<TestOption>("client-test-option"));
+  EXPECT_STATUS_OK(client.GetJob({}));
+  EXPECT_STATUS_OK(
+      client.GetJob({}, Options{}.set<TestOption>("call-test-option")));
+}
+
+TEST(BigQueryUnifiedClientTest, InsertJobs) {
+  auto mock_connection = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock_connection, options).WillRepeatedly(Return(Options{}));
+  EXPECT_CALL(*mock_connection, InsertJobs)
+      .WillOnce([](std::vector<google::cloud::bigquery::v2::Job> jobs,
+                   Options const& opts) {
+        EXPECT_THAT(opts.get<BillingProjectOption>(), Eq("billing-project"));
+        std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>> result;
+        for (auto& job : jobs) {
+          job.mutable_status()->set_state("DONE");
+          result.push_back(
+              make_ready_future(StatusOr<google::cloud::bigquery::v2::Job>(
+                  std::move(job))));
+        }
+        return result;
+      });
+
+  auto client = Client(mock_connection, Options{});
+  std::vector<google::cloud::bigquery::v2::Job> jobs(2);
+  jobs[0].mutable_job_reference()->set_job_id("job-0");
+  jobs[1].mutable_job_reference()->set_job_id("job-1");
+  auto result = client.InsertJobs(
+      jobs, Options{}.set<BillingProjectOption>("billing-project"));
+  ASSERT_EQ(result.size(), 2U);
+  for (std::size_t i = 0; i != result.size(); ++i) {
+    auto job = result[i].get();
+    ASSERT_STATUS_OK(job);
+    EXPECT_THAT(job->job_reference().job_id(), Eq("job-" + std::to_string(i)));
+  }
+}
+
+TEST(BigQueryUnifiedClientTest, ListJobsInProjects) {
+  auto mock_connection = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock_connection, options).WillRepeatedly(Return(Options{}));
+  EXPECT_CALL(*mock_connection, ListJobsInProjects)
+      .WillOnce(
+          [](std::vector<google::cloud::bigquery::v2::ListJobsRequest> const&
+                 requests,
+             Options const&) {
+            std::vector<std::string> projects;
+            for (auto const& r : requests) {
+              projects.push_back(r.project_id());
+              EXPECT_EQ(r.max_results().value(), 10U);
+            }
+            EXPECT_THAT(projects, ElementsAre("p1", "p2"));
+            google::cloud::bigquery::v2::ListFormatJob job;
+            job.set_id("p1:job");
+            return bigquery_unified_mocks::MakeStreamRange<
+                google::cloud::bigquery::v2::ListFormatJob>({job});
+          });
+
+  auto client = Client(mock_connection, Options{});
+  google::cloud::bigquery::v2::ListJobsRequest request;
+  request.mutable_max_results()->set_value(10);
+  std::vector<std::string> ids;
+  for (auto& job : client.ListJobsInProjects({"p1", "p2"}, request)) {
+    ASSERT_STATUS_OK(job);
+    ids.push_back(job->id());
+  }
+  EXPECT_THAT(ids, ElementsAre("p1:job"));
+}
+
 TEST(BigQueryUnifiedClientTest, ReadArrowJobExtract) {
   std::string const project_id = "my-project";
   std::string const job_id = "my-job";
@@ -134,6 +231,43 @@ TEST(BigQueryUnifiedClientTest, ReadArrowJobQuery) {
   EXPECT_THAT(result, StatusIs(StatusCode::kPermissionDenied));
 }
 
+TEST(BigQueryUnifiedClientTest, ReadArrowJobQuerySmallResult) {
+  std::string const project_id = "my-project";
+
+  auto mock_connection = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock_connection, options).WillRepeatedly(Return(Options{}));
+  EXPECT_CALL(*mock_connection, ReadArrow)
+      .WillOnce([&](google::cloud::bigquery::storage::v1::
+                        CreateReadSessionRequest const& request,
+                    Options) -> StatusOr<ReadArrowResponse> {
+        EXPECT_THAT(request.max_stream_count(), Eq(1));
+        return internal::PermissionDeniedError("uh-oh");
+      });
+
+  auto client = Client(
+      mock_connection,
+      Options{}
+          .set<bigquery_unified::ReadStrategyOption>(ReadStrategy::kAuto)
+          .set<bigquery_unified::SingleStreamRowThresholdOption>(1000));
+  google::cloud::bigquery::v2::Job job;
+  job.mutable_job_reference()->set_project_id(project_id);
+  job.mutable_job_reference()->set_job_id("my-job");
+  job.mutable_configuration()->set_job_type("QUERY");
+  auto* mutable_destination_table =
+      job.mutable_configuration()->mutable_query()->mutable_destination_table();
+  mutable_destination_table->set_project_id(project_id);
+  mutable_destination_table->set_dataset_id("my-dataset");
+  mutable_destination_table->set_table_id("my-table");
+  job.mutable_statistics()
+      ->mutable_query()
+      ->add_query_plan()
+      ->mutable_records_written()
+      ->set_value(10);
+
+  auto result = client.ReadArrow(job, {});
+  EXPECT_THAT(result, StatusIs(StatusCode::kPermissionDenied));
+}
+
 TEST(BigQueryUnifiedClientTest, ReadArrowJobCopy) {
   std::string const project_id = "my-project";
   std::string const job_id = "my-job";
@@ -281,6 +415,165 @@ TEST(BigQueryUnifiedClientTest, ReadArrowJobTableReference) {
   EXPECT_THAT(result, StatusIs(StatusCode::kPermissionDenied));
 }
 
+TEST(BigQueryUnifiedClientTest, ReadArrowPartitions) {
+  auto mock_connection = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock_connection, options).WillRepeatedly(Return(Options{}));
+  EXPECT_CALL(*mock_connection, ReadArrowPartitions)
+      .WillOnce([&](std::map<std::string, google::cloud::bigquery::storage::
+                                              v1::CreateReadSessionRequest>
+                        requests,
+                    Options) -> StatusOr<ReadArrowPartitionsResponse> {
+        std::vector<std::string> restrictions;
+        for (auto const& kv : requests) {
+          EXPECT_THAT(kv.second.parent(), Eq("projects/billing-project"));
+          EXPECT_THAT(
+              kv.second.read_session().table(),
+              Eq("projects/my-project/datasets/my-dataset/tables/my-table"));
+          restrictions.push_back(
+              kv.first + ": " +
+              kv.second.read_session().read_options().row_restriction());
+        }
+        EXPECT_THAT(restrictions,
+                    ElementsAre("20241231: `day` = DATE '2024-12-31'",
+                                "20250101: `day` = DATE '2025-01-01'",
+                                "20250102: `day` = DATE '2025-01-02'"));
+        return internal::PermissionDeniedError("uh-oh");
+      });
+
+  auto client = Client(mock_connection, Options{});
+  google::cloud::bigquery::v2::TableReference table_reference;
+  table_reference.set_project_id("my-project");
+  table_reference.set_dataset_id("my-dataset");
+  table_reference.set_table_id("my-table");
+
+  PartitionRange range;
+  range.column = "day";
+  range.first = absl::CivilDay(2024, 12, 31);
+  range.last = absl::CivilDay(2025, 1, 2);
+  auto result = client.ReadArrowPartitions(
+      table_reference, range,
+      Options{}.set<BillingProjectOption>("billing-project"));
+  EXPECT_THAT(result, StatusIs(StatusCode::kPermissionDenied));
+}
+
+TEST(BigQueryUnifiedClientTest, ReadArrowPartitionsInvalidRange) {
+  auto mock_connection = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock_connection, options).WillRepeatedly(Return(Options{}));
+  EXPECT_CALL(*mock_connection, ReadArrowPartitions).Times(0);
+
+  auto client = Client(mock_connection, Options{});
+  google::cloud::bigquery::v2::TableReference table_reference;
+  PartitionRange range;
+  range.first = absl::CivilDay(2025, 1, 2);
+  range.last = absl::CivilDay(2025, 1, 1);
+  auto result = client.ReadArrowPartitions(table_reference, range);
+  EXPECT_THAT(result, StatusIs(StatusCode::kInvalidArgument,
+                               HasSubstr("2025-01-02 is after 2025-01-01")));
+}
+
+TEST(BigQueryUnifiedClientTest, ReadArrowPartitionsQuotesColumn) {
+  auto mock_connection = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock_connection, options).WillRepeatedly(Return(Options{}));
+  EXPECT_CALL(*mock_connection, ReadArrowPartitions)
+      .WillOnce([&](std::map<std::string, google::cloud::bigquery::storage::
+                                              v1::CreateReadSessionRequest>
+                        requests,
+                    Options) -> StatusOr<ReadArrowPartitionsResponse> {
+        EXPECT_THAT(requests, SizeIs(1));
+        for (auto const& kv : requests) {
+          // The backslash and the backticks are escaped.
+          EXPECT_THAT(
+              kv.second.read_session().read_options().row_restriction(),
+              Eq(R"(`a\\\` OR TRUE OR \`` = DATE '2025-01-01')"));
+        }
+        return internal::PermissionDeniedError("uh-oh");
+      });
+
+  auto client = Client(mock_connection, Options{});
+  google::cloud::bigquery::v2::TableReference table_reference;
+  PartitionRange range;
+  range.column = R"(a\` OR TRUE OR `)";
+  range.first = absl::CivilDay(2025, 1, 1);
+  range.last = absl::CivilDay(2025, 1, 1);
+  auto result = client.ReadArrowPartitions(table_reference, range);
+  EXPECT_THAT(result, StatusIs(StatusCode::kPermissionDenied));
+}
+
+TEST(BigQueryUnifiedClientTest, ReadArrowPartitionsRangeTooLarge) {
+  auto mock_connection = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock_connection, options).WillRepeatedly(Return(Options{}));
+  EXPECT_CALL(*mock_connection, ReadArrowPartitions).Times(0);
+
+  auto client = Client(mock_connection, Options{});
+  google::cloud::bigquery::v2::TableReference table_reference;
+  PartitionRange range;
+  range.first = absl::CivilDay(2024, 1, 1);
+  range.last = range.first + kMaxPartitionRangeDays;
+  auto result = client.ReadArrowPartitions(table_reference, range);
+  EXPECT_THAT(result, StatusIs(StatusCode::kInvalidArgument,
+                               HasSubstr("the maximum is")));
+}
+
+TEST(BigQueryUnifiedClientTest, ReadArrowPartitionsCallOptions) {
+  struct ConnectionOption {
+    using Type = std::string;
+  };
+  auto mock_connection = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock_connection, options)
+      .WillRepeatedly(Return(
+          Options{}
+              .set<ConnectionOption>("connection-option")
+              .set<BillingProjectOption>("connection-billing-project")));
+  EXPECT_CALL(*mock_connection, ReadArrowPartitions)
+      .WillOnce([&](std::map<std::string, google::cloud::bigquery::storage::
+                                              v1::CreateReadSessionRequest>
+                        requests,
+                    Options const& opts)
+                    -> StatusOr<ReadArrowPartitionsResponse> {
+        // The requests use the connection options, the call options do not
+        // include them.
+        for (auto const& kv : requests) {
+          EXPECT_THAT(kv.second.parent(),
+                      Eq("projects/connection-billing-project"));
+        }
+        EXPECT_FALSE(opts.has<ConnectionOption>());
+        EXPECT_THAT(opts.get<TestOption>(), Eq("call-test-option"));
+        return internal::PermissionDeniedError("uh-oh");
+      });
+
+  auto client = Client(mock_connection, Options{});
+  google::cloud::bigquery::v2::TableReference table_reference;
+  PartitionRange range;
+  range.first = absl::CivilDay(2025, 1, 1);
+  range.last = absl::CivilDay(2025, 1, 1);
+  auto result = client.ReadArrowPartitions(
+      table_reference, range, Options{}.set<TestOption>("call-test-option"));
+  EXPECT_THAT(result, StatusIs(StatusCode::kPermissionDenied));
+}
+
+TEST(BigQueryUnifiedClientTest, GetArrowSchema) {
+  auto mock_connection = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock_connection, options).WillRepeatedly(Return(Options{}));
+  auto expected = arrow::schema({arrow::field("a", arrow::int64())});
+  EXPECT_CALL(*mock_connection, GetArrowSchema)
+      .WillOnce([&](google::cloud::bigquery::v2::GetTableRequest const& request,
+                    Options) -> StatusOr<std::shared_ptr<arrow::Schema>> {
+        EXPECT_THAT(request.project_id(), Eq("my-project"));
+        EXPECT_THAT(request.dataset_id(), Eq("my-dataset"));
+        EXPECT_THAT(request.table_id(), Eq("my-table"));
+        EXPECT_THAT(request.selected_fields(), Eq("a,b.c"));
+        return expected;
+      });
+
+  auto client = Client(mock_connection, Options{});
+  google::cloud::bigquery::v2::TableReference table_reference;
+  table_reference.set_project_id("my-project");
+  table_reference.set_dataset_id("my-dataset");
+  table_reference.set_table_id("my-table");
+  auto result = client.GetArrowSchema(table_reference, {"a", "b.c"});
+  EXPECT_THAT(result, IsOkAndHolds(expected));
+}
+
 }  // namespace
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
 }  // namespace google::cloud::bigquery_unified
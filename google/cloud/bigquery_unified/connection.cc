@@ -23,6 +23,12 @@ GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
 
 Connection::~Connection() = default;
 
+// WarmUp
+future<Status> Connection::WarmUp(Options opts) {
+  return google::cloud::make_ready_future(
+      Status(StatusCode::kUnimplemented, "not implemented"));
+}
+
 // CancelJob
 future<StatusOr<google::cloud::bigquery::v2::Job>> Connection::CancelJob(
     google::cloud::bigquery::v2::CancelJobRequest const& request,
@@ -60,6 +66,18 @@ Status Connection::DeleteJob(
   return internal::UnimplementedError("not implemented");
 }
 
+// CancelJobs
+StatusOr<std::vector<JobOperationResult>> Connection::CancelJobs(
+    JobFilter const& filter, Options opts) {
+  return internal::UnimplementedError("not implemented");
+}
+
+// DeleteJobs
+StatusOr<std::vector<JobOperationResult>> Connection::DeleteJobs(
+    JobFilter const& filter, Options opts) {
+  return internal::UnimplementedError("not implemented");
+}
+
 // ListJobs
 StreamRange<google::cloud::bigquery::v2::ListFormatJob> Connection::ListJobs(
     google::cloud::bigquery::v2::ListJobsRequest request, Options opts) {
@@ -67,6 +85,15 @@ StreamRange<google::cloud::bigquery::v2::ListFormatJob> Connection::ListJobs(
       StreamRange<google::cloud::bigquery::v2::ListFormatJob>>();
 }
 
+// ListJobsInProjects
+StreamRange<google::cloud::bigquery::v2::ListFormatJob>
+Connection::ListJobsInProjects(
+    std::vector<google::cloud::bigquery::v2::ListJobsRequest> requests,
+    Options opts) {
+  return internal::MakeUnimplementedPaginationRange<
+      StreamRange<google::cloud::bigquery::v2::ListFormatJob>>();
+}
+
 // InsertJob
 future<StatusOr<google::cloud::bigquery::v2::Job>> Connection::InsertJob(
     google::cloud::bigquery::v2::Job const& job, Options opts) {
@@ -89,6 +116,19 @@ future<StatusOr<google::cloud::bigquery::v2::Job>> Connection::InsertJob(
       Status(StatusCode::kUnimplemented, "not implemented"));
 }
 
+// InsertJobs
+std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>>
+Connection::InsertJobs(std::vector<google::cloud::bigquery::v2::Job> jobs,
+                       Options opts) {
+  std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>> result;
+  for (std::size_t i = 0; i != jobs.size(); ++i) {
+    result.push_back(google::cloud::make_ready_future<
+                     StatusOr<google::cloud::bigquery::v2::Job>>(
+        Status(StatusCode::kUnimplemented, "not implemented")));
+  }
+  return result;
+}
+
 StatusOr<ReadArrowResponse> Connection::ReadArrow(
     google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
         read_session,
@@ -96,6 +136,26 @@ StatusOr<ReadArrowResponse> Connection::ReadArrow(
   return internal::UnimplementedError("not implemented");
 }
 
+StatusOr<ReadArrowPartitionsResponse> Connection::ReadArrowPartitions(
+    std::map<std::string,
+             google::cloud::bigquery::storage::v1::CreateReadSessionRequest>
+        partition_requests,
+    Options opts) {
+  return internal::UnimplementedError("not implemented");
+}
+
+future<StatusOr<ReadArrowResponse>> Connection::QueryArrow(
+    google::cloud::bigquery::v2::Job const& job, Options opts) {
+  return google::cloud::make_ready_future<StatusOr<ReadArrowResponse>>(
+      internal::UnimplementedError("not implemented"));
+}
+
+StatusOr<std::shared_ptr<arrow::Schema>> Connection::GetArrowSchema(
+    google::cloud::bigquery::v2::GetTableRequest const& request,
+    Options opts) {
+  return internal::UnimplementedError("not implemented");
+}
+
 std::shared_ptr<Connection> MakeConnection(Options options) {
   return bigquery_unified_internal::MakeDefaultConnectionImpl(
       bigquery_unified_internal::DefaultOptions(std::move(options)));
@@ -15,6 +15,7 @@
 #ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_CONNECTION_H
 #define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_CONNECTION_H
 
+#include "google/cloud/bigquery_unified/job_filter.h"
 #include "google/cloud/bigquery_unified/read_arrow_response.h"
 #include "google/cloud/bigquery_unified/version.h"
 #include "google/cloud/future.h"
@@ -24,8 +25,12 @@
 #include "google/cloud/stream_range.h"
 #include <google/cloud/bigquery/storage/v1/storage.pb.h>
 #include <google/cloud/bigquery/v2/job.pb.h>
+#include <google/cloud/bigquery/v2/table.pb.h>
 #include <arrow/record_batch.h>
+#include <map>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace google::cloud::bigquery_unified {
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
@@ -40,6 +45,10 @@ GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
  *
  * To create a concrete instance, see `MakeConnection()`.
  *
+ * The `opts` given to each function override the `options()` of the connection
+ * for that call. `Client` passes only the options given to it, and to the
+ * call, so implementations merge them with their own options.
+ *
  * For mocking, see `bigquery_unified_mocks::MockConnection`.
  */
 class Connection {
@@ -48,6 +57,9 @@ class Connection {
 
   virtual Options options() { return Options{}; }
 
+  // WarmUp
+  virtual future<Status> WarmUp(Options opts);
+
   // CancelJob
   virtual future<StatusOr<google::cloud::bigquery::v2::Job>> CancelJob(
       google::cloud::bigquery::v2::CancelJobRequest const& request,
@@ -71,10 +83,24 @@ class Connection {
       google::cloud::bigquery::v2::DeleteJobRequest const& request,
       Options opts);
 
+  // CancelJobs
+  virtual StatusOr<std::vector<JobOperationResult>> CancelJobs(
+      JobFilter const& filter, Options opts);
+
+  // DeleteJobs
+  virtual StatusOr<std::vector<JobOperationResult>> DeleteJobs(
+      JobFilter const& filter, Options opts);
+
   // ListJobs
   virtual StreamRange<google::cloud::bigquery::v2::ListFormatJob> ListJobs(
       google::cloud::bigquery::v2::ListJobsRequest request, Options opts);
 
+  // ListJobsInProjects
+  virtual StreamRange<google::cloud::bigquery::v2::ListFormatJob>
+  ListJobsInProjects(
+      std::vector<google::cloud::bigquery::v2::ListJobsRequest> requests,
+      Options opts);
+
   // InsertJob
   virtual future<StatusOr<google::cloud::bigquery::v2::Job>> InsertJob(
       google::cloud::bigquery::v2::Job const& job, Options opts);
@@ -87,10 +113,28 @@ class Connection {
       google::cloud::bigquery::v2::JobReference const& job_reference,
       Options opts);
 
+  // InsertJobs
+  virtual std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>>
+  InsertJobs(std::vector<google::cloud::bigquery::v2::Job> jobs, Options opts);
+
   virtual StatusOr<ReadArrowResponse> ReadArrow(
       google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
           read_session,
       Options opts);
+
+  virtual StatusOr<ReadArrowPartitionsResponse> ReadArrowPartitions(
+      std::map<std::string,
+               google::cloud::bigquery::storage::v1::CreateReadSessionRequest>
+          partition_requests,
+      Options opts);
+
+  // QueryArrow
+  virtual future<StatusOr<ReadArrowResponse>> QueryArrow(
+      google::cloud::bigquery::v2::Job const& job, Options opts);
+
+  virtual StatusOr<std::shared_ptr<arrow::Schema>> GetArrowSchema(
+      google::cloud::bigquery::v2::GetTableRequest const& request,
+      Options opts);
 };
 
 /**
@@ -107,14 +151,21 @@ class Connection {
  * - `google::cloud::GrpcOptionList`
  * - `google::cloud::RestOptionList`
  * - `google::cloud::UnifiedCredentialsOptionList`
+ * - `google::cloud::bigquery_unified::BigQueryConnectionOptionList`
  * - `google::cloud::bigquery_unified::BigQueryJobOptionList`
  * - `google::cloud::bigquery_unified::BigQueryReadOptionList`
  *
  * Additionally, options from the component services can be specified for more
  * fine grained control:
  *  - `google::cloud::bigquerycontrol_v2::JobServicePolicyOptionList`
+ *  - `google::cloud::bigquerycontrol_v2::TableServicePolicyOptionList`
  *  - `google::cloud::bigquery_storage_v1::BigQueryReadPolicyOptionList`
  *
+ * All the asynchronous work of the connection runs on one completion queue,
+ * and its blocking work on threads created on demand. See
+ * `bigquery_unified::BlockingThreadPoolOption` to share both between
+ * connections.
+ *
  * @note Unexpected options will be ignored. To log unexpected options instead,
  *     set `GOOGLE_CLOUD_CPP_ENABLE_CLOG=yes` in the environment.
  *
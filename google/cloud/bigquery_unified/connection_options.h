@@ -0,0 +1,141 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_CONNECTION_OPTIONS_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_CONNECTION_OPTIONS_H
+
+#include "google/cloud/bigquery_unified/blocking_thread_pool.h"
+#include "google/cloud/bigquery_unified/rest_connection_stats.h"
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/options.h"
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace google::cloud::bigquery_unified {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Use with `google::cloud::Options` to configure the maximum number of RPCs a
+ * `Connection` issues concurrently on behalf of a single call.
+ *
+ * Some operations, such as `Client::ReadArrowPartitions()`, issue several
+ * independent RPCs. These RPCs run on a pool of at most this many threads. The
+ * threads are created on demand and released once they become idle.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct MaxConcurrentRpcsOption {
+  using Type = std::size_t;
+};
+
+/**
+ * Use with `google::cloud::Options` to warm up the connection when it is
+ * created.
+ *
+ * When set to `true`, `MakeConnection()` starts `Connection::WarmUp()` in the
+ * background and returns without waiting for it.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct WarmUpOnCreateOption {
+  using Type = bool;
+};
+
+/**
+ * Use with `google::cloud::Options` to run the blocking work of a `Connection`
+ * on a shared pool of threads.
+ *
+ * Each connection runs the blocking RPCs of job polling and of operations that
+ * fan out, and decodes prefetched results, on three pools of threads created
+ * on demand: one for the long polls of `JobCompletionStrategy::kLongPoll`, one
+ * for the other job polls, and one for everything else, each with at most
+ * `MaxConcurrentRpcsOption` threads. When this option is set, all that work
+ * runs on the given pool instead, and `MaxConcurrentRpcsOption` no longer
+ * limits the number of threads. Give the same pool to many connections to
+ * bound the threads of the whole process.
+ *
+ * Each long poll blocks a thread until its job completes or the poll times
+ * out. A long poll only starts if fewer than half of the threads of the shared
+ * pool are busy, otherwise that poll uses `jobs.get`, so the long polls never
+ * take more than half of the pool.
+ *
+ * The asynchronous work (timers, gRPC streams, token refreshes) of a connection
+ * runs on one completion queue. By default it is served by
+ * `GrpcBackgroundThreadPoolSizeOption` threads, started on first use. Set
+ * `google::cloud::GrpcCompletionQueueOption` to serve it with threads owned by
+ * the application, which can be shared with other connections.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct BlockingThreadPoolOption {
+  using Type = std::shared_ptr<BlockingThreadPool>;
+};
+
+/**
+ * Use with `google::cloud::Options` to configure the number of HTTP
+ * connections kept open to the BigQuery REST API.
+ *
+ * Job submission, job polling and table metadata calls use the REST API. Each
+ * call takes a connection from a pool and returns it when it completes, so the
+ * next call skips the TCP and TLS handshakes. A call that finds the pool empty
+ * opens a new connection, and if the pool is full when the call completes, the
+ * connection is closed. Set this to the number of calls the application makes
+ * concurrently, including the job polling of all the jobs it awaits.
+ *
+ * If unset, the default of the REST transport is used.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct RestConnectionPoolSizeOption {
+  using Type = std::size_t;
+};
+
+/**
+ * Use with `google::cloud::Options` to configure the HTTP version used with
+ * the BigQuery REST API.
+ *
+ * The valid values are "1.0", "1.1", "2", and "2TLS". With "2TLS" the
+ * connections negotiate HTTP/2 over TLS when the service supports it, and fall
+ * back to HTTP/1.1 otherwise. If unset, the default of the HTTP library is
+ * used.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct RestHttpVersionOption {
+  using Type = std::string;
+};
+
+/**
+ * Use with `google::cloud::Options` to count the job service HTTP requests of
+ * a `Connection`, and how many of them opened a new connection.
+ *
+ * The application keeps a copy of the pointer and reads the counters at any
+ * time. Several connections may share the same counters.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct RestConnectionStatsOption {
+  using Type = std::shared_ptr<RestConnectionStats>;
+};
+
+using BigQueryConnectionOptionList =
+    OptionList<MaxConcurrentRpcsOption, WarmUpOnCreateOption,
+               BlockingThreadPoolOption, RestConnectionPoolSizeOption,
+               RestHttpVersionOption, RestConnectionStatsOption>;
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_CONNECTION_OPTIONS_H
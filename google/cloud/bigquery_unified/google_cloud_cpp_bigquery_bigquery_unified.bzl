@@ -17,27 +17,81 @@
 """Automatically generated source lists for google_cloud_cpp_bigquery_bigquery_unified - DO NOT EDIT."""
 
 google_cloud_cpp_bigquery_bigquery_unified_hdrs = [
+    "blocking_thread_pool.h",
     "client.h",
     "connection.h",
+    "connection_options.h",
     "idempotency_policy.h",
     "internal/arrow_reader.h",
     "internal/async_rest_long_running_operation_custom.h",
+    "internal/blocking_executor.h",
     "internal/connection_impl.h",
     "internal/default_options.h",
+    "internal/job_long_poll.h",
+    "internal/job_rest_stats_stub.h",
+    "internal/job_watcher.h",
+    "internal/lazy_connection.h",
+    "internal/list_jobs_stream.h",
+    "internal/prepared_options.h",
+    "internal/query_cache.h",
+    "internal/query_cache_connection.h",
+    "internal/read_channel_pool.h",
+    "internal/read_channels.h",
+    "internal/read_metrics.h",
+    "internal/read_metrics_stub.h",
+    "internal/read_rows_watchdog.h",
+    "internal/read_session_cache.h",
+    "internal/read_session_stats_recorder.h",
+    "internal/read_strategy.h",
+    "internal/read_tracing.h",
     "internal/retry_traits.h",
+    "internal/shared_background_threads.h",
+    "internal/table_schema.h",
+    "internal/table_schema_cache.h",
+    "internal/timer_wheel.h",
     "internal/tracing_connection.h",
+    "job_filter.h",
     "job_options.h",
+    "partition_range.h",
     "read_arrow_response.h",
+    "read_channel_stats.h",
     "read_options.h",
+    "read_session_stats.h",
+    "rest_connection_stats.h",
     "retry_policy.h",
 ]
 
 google_cloud_cpp_bigquery_bigquery_unified_srcs = [
+    "blocking_thread_pool.cc",
     "client.cc",
     "connection.cc",
     "idempotency_policy.cc",
     "internal/arrow_reader.cc",
+    "internal/blocking_executor.cc",
     "internal/connection_impl.cc",
     "internal/default_options.cc",
+    "internal/job_long_poll.cc",
+    "internal/job_rest_stats_stub.cc",
+    "internal/job_watcher.cc",
+    "internal/lazy_connection.cc",
+    "internal/list_jobs_stream.cc",
+    "internal/prepared_options.cc",
+    "internal/query_cache.cc",
+    "internal/query_cache_connection.cc",
+    "internal/read_channel_pool.cc",
+    "internal/read_channels.cc",
+    "internal/read_metrics.cc",
+    "internal/read_metrics_stub.cc",
+    "internal/read_rows_watchdog.cc",
+    "internal/read_session_cache.cc",
+    "internal/read_session_stats_recorder.cc",
+    "internal/read_strategy.cc",
+    "internal/read_tracing.cc",
+    "internal/shared_background_threads.cc",
+    "internal/table_schema.cc",
+    "internal/table_schema_cache.cc",
+    "internal/timer_wheel.cc",
     "internal/tracing_connection.cc",
+    "read_channel_stats.cc",
+    "read_session_stats.cc",
 ]
@@ -50,15 +50,20 @@ Idempotency IdempotencyPolicy::DeleteJob(
   return Idempotency::kIdempotent;
 }
 
+// The service rejects a second job with the same id, so inserting a job with
+// a given id is idempotent.
 Idempotency IdempotencyPolicy::InsertJob(
-    google::cloud::bigquery::v2::InsertJobRequest const&, Options) {
-  return Idempotency::kNonIdempotent;
+    google::cloud::bigquery::v2::InsertJobRequest const& request, Options) {
+  return request.job().job_reference().job_id().empty()
+             ? Idempotency::kNonIdempotent
+             : Idempotency::kIdempotent;
 }
 
 Idempotency IdempotencyPolicy::InsertJob(
     google::cloud::NoAwaitTag,
-    google::cloud::bigquery::v2::InsertJobRequest const&, Options) {
-  return Idempotency::kNonIdempotent;
+    google::cloud::bigquery::v2::InsertJobRequest const& request,
+    Options opts) {
+  return InsertJob(request, std::move(opts));
 }
 
 Idempotency IdempotencyPolicy::InsertJob(
@@ -19,6 +19,7 @@
 #include <arrow/io/memory.h>
 #include <arrow/ipc/api.h>
 #include <arrow/status.h>
+#include <chrono>
 
 namespace google::cloud::bigquery_unified_internal {
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
@@ -65,11 +66,13 @@ ArrowRecordBatchReader::ArrowRecordBatchReader(
     std::function<std::shared_ptr<google::cloud::StreamRange<
         google::cloud::bigquery::storage::v1::ReadRowsResponse>>(
         google::cloud::bigquery::storage::v1::ReadRowsRequest const&)>
-        factory)
+        factory,
+    std::shared_ptr<ReadMetrics> metrics)
     : stream_name_(stream_name),
       schema_(std::move(schema)),
       dictionary_(std::move(dictionary)),
-      factory_(std::move(factory)) {}
+      factory_(std::move(factory)),
+      metrics_(std::move(metrics)) {}
 
 absl::variant<Status, std::shared_ptr<arrow::RecordBatch>>
 ArrowRecordBatchReader::operator()(Options const&) {
@@ -78,6 +81,7 @@ ArrowRecordBatchReader::operator()(Options const&) {
   // rpc call on construction rather than delaying the rpc call to the first
   // invocation of operator(). But, if StreamRange calls operator() during its
   // construction, then it's a moot point. Further investigation is required.
+  auto const wait_start = std::chrono::steady_clock::now();
   if (!begun_) {
     begun_ = true;
     request_.set_read_stream(stream_name_);
@@ -95,10 +99,21 @@ ArrowRecordBatchReader::operator()(Options const&) {
   if (!e) return std::move(e).status();
   current_rows_ = *std::move(e);
 
+  auto const decode_start = std::chrono::steady_clock::now();
   StatusOr<std::shared_ptr<arrow::RecordBatch>> record_batch =
       GetArrowRecordBatch(current_rows_.arrow_record_batch(), schema_,
                           dictionary_);
   if (!record_batch) return std::move(record_batch).status();
+  if (metrics_) {
+    ReadBatchMetrics batch;
+    batch.bytes = static_cast<std::int64_t>(
+        current_rows_.arrow_record_batch().serialized_record_batch().size());
+    batch.rows = current_rows_.row_count();
+    batch.wait_time = decode_start - wait_start;
+    batch.decode_time = std::chrono::steady_clock::now() - decode_start;
+    batch.progress = current_rows_.stats().progress().at_response_end();
+    metrics_->RecordBatch(stream_name_, batch);
+  }
   return *record_batch;
 }
 
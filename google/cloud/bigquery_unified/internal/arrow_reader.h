@@ -15,6 +15,7 @@
 #ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_ARROW_READER_H
 #define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_ARROW_READER_H
 
+#include "google/cloud/bigquery_unified/internal/read_metrics.h"
 #include "google/cloud/bigquery_unified/version.h"
 #include "google/cloud/options.h"
 #include "google/cloud/stream_range.h"
@@ -44,7 +45,8 @@ class ArrowRecordBatchReader {
       std::function<std::shared_ptr<google::cloud::StreamRange<
           google::cloud::bigquery::storage::v1::ReadRowsResponse>>(
           google::cloud::bigquery::storage::v1::ReadRowsRequest const&)>
-          factory);
+          factory,
+      std::shared_ptr<ReadMetrics> metrics = nullptr);
 
   absl::variant<Status, std::shared_ptr<arrow::RecordBatch>> operator()(
       Options const&);
@@ -58,6 +60,7 @@ class ArrowRecordBatchReader {
       google::cloud::bigquery::storage::v1::ReadRowsResponse>>(
       google::cloud::bigquery::storage::v1::ReadRowsRequest const&)>
       factory_;
+  std::shared_ptr<ReadMetrics> metrics_;
   bool begun_ = false;
   std::shared_ptr<google::cloud::StreamRange<
       google::cloud::bigquery::storage::v1::ReadRowsResponse>>
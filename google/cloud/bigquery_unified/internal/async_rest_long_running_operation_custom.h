@@ -15,9 +15,11 @@
 #ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_ASYNC_REST_LONG_RUNNING_OPERATION_CUSTOM_H
 #define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_ASYNC_REST_LONG_RUNNING_OPERATION_CUSTOM_H
 
+#include "google/cloud/bigquery_unified/internal/timer_wheel.h"
 #include "google/cloud/bigquery_unified/version.h"
 #include "google/cloud/future.h"
 #include "google/cloud/internal/async_rest_long_running_operation.h"
+#include "google/cloud/internal/opentelemetry.h"
 #include "google/cloud/polling_policy.h"
 #include "google/cloud/status_or.h"
 #include <functional>
@@ -70,7 +72,8 @@ class AsyncRestPollingLoopImpl
           get_request_set_operation_name,
       std::function<void(std::string const&, CancelOperationRequestType&)>
           cancel_request_set_operation_name,
-      std::function<std::string(StatusOr<OperationType> const&)> operation_name)
+      std::function<std::string(StatusOr<OperationType> const&)> operation_name,
+      std::shared_ptr<TimerWheel> timer_wheel = nullptr)
       : cq_(std::move(cq)),
         options_(std::move(options)),
         poll_(std::move(poll)),
@@ -83,7 +86,8 @@ class AsyncRestPollingLoopImpl
             std::move(get_request_set_operation_name)),
         cancel_request_set_operation_name_(
             std::move(cancel_request_set_operation_name)),
-        operation_name_(std::move(operation_name)) {}
+        operation_name_(std::move(operation_name)),
+        timer_wheel_(std::move(timer_wheel)) {}
 
   future<StatusOr<OperationType>> Start(future<StatusOr<OperationType>> op) {
     auto self = this->shared_from_this();
@@ -152,8 +156,26 @@ class AsyncRestPollingLoopImpl
     GCP_LOG(DEBUG) << location_ << "() polling loop waiting "
                    << duration.count() << "ms";
     auto self = this->shared_from_this();
-    internal::TracedAsyncBackoff(cq_, *options_, duration, "Async Backoff")
-        .then([self](TimerResult f) { self->OnTimer(std::move(f)); });
+    MakeBackoffTimer(duration).then(
+        [self](TimerResult f) { self->OnTimer(std::move(f)); });
+  }
+
+  // Uses the shared timer wheel if there is one. With tracing enabled, the
+  // wait gets the same span as `internal::TracedAsyncBackoff()`.
+  TimerResult MakeBackoffTimer(std::chrono::milliseconds duration) {
+    if (!timer_wheel_) {
+      return internal::TracedAsyncBackoff(cq_, *options_, duration,
+                                          "Async Backoff");
+    }
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+    if (internal::TracingEnabled(*options_)) {
+      auto span = internal::MakeSpan("Async Backoff");
+      internal::OTelScope scope(span);
+      return internal::EndSpan(std::move(span),
+                               timer_wheel_->MakeRelativeTimer(cq_, duration));
+    }
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+    return timer_wheel_->MakeRelativeTimer(cq_, duration);
   }
 
   void OnTimer(TimerResult f) {
@@ -216,6 +238,7 @@ class AsyncRestPollingLoopImpl
   std::function<void(std::string const&, CancelOperationRequestType&)>
       cancel_request_set_operation_name_;
   std::function<std::string(StatusOr<OperationType> const&)> operation_name_;
+  std::shared_ptr<TimerWheel> timer_wheel_;
 
   // `delayed_cancel_` and `op_name_`, in contrast, are also used from
   // `DoCancel()`, which is called asynchronously, so they need locking.
@@ -241,13 +264,14 @@ future<StatusOr<OperationType>> AsyncRestPollingLoop(
         get_request_set_operation_name,
     std::function<void(std::string const&, CancelOperationRequestType&)>
         cancel_request_set_operation_name,
-    std::function<std::string(StatusOr<OperationType> const&)> operation_name) {
+    std::function<std::string(StatusOr<OperationType> const&)> operation_name,
+    std::shared_ptr<TimerWheel> timer_wheel = nullptr) {
   auto loop = std::make_shared<AsyncRestPollingLoopImpl<
       OperationType, GetOperationRequestType, CancelOperationRequestType>>(
       std::move(cq), options, std::move(poll), std::move(cancel),
       std::move(polling_policy), std::move(location), is_operation_done,
       get_request_set_operation_name, cancel_request_set_operation_name,
-      operation_name);
+      operation_name, std::move(timer_wheel));
   return loop->Start(std::move(op));
 }
 
@@ -272,7 +296,8 @@ future<StatusOr<ReturnType>> AsyncRestAwaitLongRunningOperation(
         get_request_set_operation_name,
     std::function<void(std::string const&, CancelOperationRequestType&)>
         cancel_request_set_operation_name,
-    std::function<std::string(StatusOr<OperationType> const&)> operation_name) {
+    std::function<std::string(StatusOr<OperationType> const&)> operation_name,
+    std::shared_ptr<TimerWheel> timer_wheel = nullptr) {
   auto loc = std::string{location};
   return AsyncRestPollingLoop<OperationType, GetOperationRequestType,
                               CancelOperationRequestType>(
@@ -281,7 +306,7 @@ future<StatusOr<ReturnType>> AsyncRestAwaitLongRunningOperation(
              std::move(poll), std::move(cancel), std::move(polling_policy),
              std::move(location), is_operation_done,
              get_request_set_operation_name, cancel_request_set_operation_name,
-             operation_name)
+             operation_name, std::move(timer_wheel))
       .then([value_extractor, loc](future<StatusOr<OperationType>> g) {
         return value_extractor(g.get(), loc);
       });
@@ -0,0 +1,157 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/blocking_executor.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+struct BlockingExecutor::State {
+  State(std::size_t m, std::chrono::milliseconds t)
+      : max_threads(m), idle_timeout(t) {}
+
+  std::size_t const max_threads;
+  std::chrono::milliseconds const idle_timeout;
+  std::mutex mu;
+  std::condition_variable work_cv;
+  std::condition_variable exit_cv;
+  std::deque<std::function<void()>> queue;
+  std::size_t threads = 0;
+  std::size_t idle = 0;
+  // The number of tasks being run by the threads.
+  std::size_t running = 0;
+  bool shutdown = false;
+};
+
+namespace {
+// Identifies the executor (if any) that owns the current thread. Used to
+// avoid waiting for ourselves when the executor is destroyed by one of its
+// own tasks.
+thread_local void const* current_executor_state = nullptr;
+}  // namespace
+
+BlockingExecutor::BlockingExecutor(std::size_t max_threads,
+                                   std::chrono::milliseconds idle_timeout)
+    : state_(std::make_shared<State>(std::max<std::size_t>(max_threads, 1),
+                                     idle_timeout)) {}
+
+BlockingExecutor::~BlockingExecutor() {
+  std::unique_lock<std::mutex> lk(state_->mu);
+  state_->shutdown = true;
+  state_->work_cv.notify_all();
+  std::size_t const self = current_executor_state == state_.get() ? 1 : 0;
+  state_->exit_cv.wait(lk, [&] { return state_->threads == self; });
+}
+
+void BlockingExecutor::Schedule(std::function<void()> task) {
+  std::lock_guard<std::mutex> lk(state_->mu);
+  ScheduleLocked(std::move(task));
+}
+
+bool BlockingExecutor::TrySchedule(std::function<void()> task,
+                                   std::size_t max_busy) {
+  std::lock_guard<std::mutex> lk(state_->mu);
+  auto const busy = state_->running + state_->queue.size();
+  // The queued tasks are handed to the idle threads first.
+  auto const free = state_->idle > state_->queue.size() ||
+                    state_->threads < state_->max_threads;
+  if (!free || busy >= max_busy) return false;
+  ScheduleLocked(std::move(task));
+  return true;
+}
+
+void BlockingExecutor::ScheduleLocked(std::function<void()> task) {
+  state_->queue.push_back(std::move(task));
+  // An idle thread stays idle until it wakes up, so it may already be handed
+  // one of the queued tasks. Start a thread unless there is an idle thread for
+  // every queued task.
+  if (state_->queue.size() > state_->idle &&
+      state_->threads < state_->max_threads) {
+    ++state_->threads;
+    std::thread(Worker, state_).detach();
+    return;
+  }
+  state_->work_cv.notify_one();
+}
+
+void BlockingExecutor::RunConcurrently(std::size_t count,
+                                       std::function<void(std::size_t)> fn) {
+  struct Calls {
+    Calls(std::size_t c, std::function<void(std::size_t)> f)
+        : count(c), fn(std::move(f)) {}
+
+    // Claims and runs the calls not yet started, if any.
+    void Run() {
+      for (auto n = next++; n < count; n = next++) {
+        fn(n);
+        std::lock_guard<std::mutex> lk(mu);
+        if (++done == count) cv.notify_all();
+      }
+    }
+
+    std::size_t const count;
+    std::function<void(std::size_t)> const fn;
+    std::atomic<std::size_t> next{0};
+    std::mutex mu;
+    std::condition_variable cv;
+    std::size_t done = 0;  // GUARDED_BY(mu)
+  };
+  if (count == 0) return;
+  auto calls = std::make_shared<Calls>(count, std::move(fn));
+  auto const helpers = std::min(count - 1, max_threads());
+  for (std::size_t i = 0; i != helpers; ++i) {
+    Schedule([calls] { calls->Run(); });
+  }
+  calls->Run();
+  std::unique_lock<std::mutex> lk(calls->mu);
+  calls->cv.wait(lk, [&] { return calls->done == calls->count; });
+}
+
+std::size_t BlockingExecutor::max_threads() const {
+  return state_->max_threads;
+}
+
+void BlockingExecutor::Worker(std::shared_ptr<State> state) {
+  current_executor_state = state.get();
+  std::unique_lock<std::mutex> lk(state->mu);
+  for (;;) {
+    ++state->idle;
+    state->work_cv.wait_for(lk, state->idle_timeout, [&] {
+      return state->shutdown || !state->queue.empty();
+    });
+    --state->idle;
+    // Exit on shutdown, or after waiting `idle_timeout` without work.
+    if (state->queue.empty()) break;
+    auto task = std::move(state->queue.front());
+    state->queue.pop_front();
+    ++state->running;
+    lk.unlock();
+    task();
+    // Release anything captured by the task before reacquiring the lock.
+    task = nullptr;
+    lk.lock();
+    --state->running;
+  }
+  --state->threads;
+  state->exit_cv.notify_all();
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
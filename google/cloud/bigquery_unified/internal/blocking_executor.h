@@ -0,0 +1,120 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_BLOCKING_EXECUTOR_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_BLOCKING_EXECUTOR_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/future.h"
+#include "absl/types/optional.h"
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Runs blocking calls, typically unary RPCs, on a bounded pool of threads.
+ *
+ * The completion queue threads must not block, so operations that fan out
+ * several blocking RPCs (e.g. one `CreateReadSession` per table partition) use
+ * this class to run them concurrently. Threads are created on demand, up to
+ * `max_threads`, and exit after they have been idle for `idle_timeout`, so an
+ * unused executor holds no threads.
+ *
+ * The destructor waits for all scheduled work to complete.
+ */
+class BlockingExecutor {
+ public:
+  explicit BlockingExecutor(
+      std::size_t max_threads,
+      std::chrono::milliseconds idle_timeout = std::chrono::seconds(30));
+  ~BlockingExecutor();
+
+  BlockingExecutor(BlockingExecutor const&) = delete;
+  BlockingExecutor& operator=(BlockingExecutor const&) = delete;
+
+  /// Schedules @p functor and returns a future satisfied with its result.
+  template <typename Functor,
+            typename R = std::invoke_result_t<std::decay_t<Functor>&>>
+  future<R> Run(Functor&& functor) {
+    auto p = std::make_shared<promise<R>>();
+    auto f = p->get_future();
+    Schedule([p, fn = std::forward<Functor>(functor)]() mutable {
+      if constexpr (std::is_void_v<R>) {
+        fn();
+        p->set_value();
+      } else {
+        p->set_value(fn());
+      }
+    });
+    return f;
+  }
+
+  /**
+   * Like `Run()`, but only if @p functor can start without waiting.
+   *
+   * Returns `absl::nullopt` without scheduling @p functor if no thread is free
+   * to run it, or if @p max_busy threads are already busy. Long running tasks
+   * use a @p max_busy lower than `max_threads()` to leave some threads for
+   * the other work.
+   */
+  template <typename Functor,
+            typename R = std::invoke_result_t<std::decay_t<Functor>&>>
+  absl::optional<future<R>> TryRun(Functor&& functor, std::size_t max_busy) {
+    auto p = std::make_shared<promise<R>>();
+    auto f = p->get_future();
+    auto task = [p, fn = std::forward<Functor>(functor)]() mutable {
+      p->set_value(fn());
+    };
+    if (!TrySchedule(std::move(task), max_busy)) return absl::nullopt;
+    return f;
+  }
+
+  /// Schedules @p task to run on one of the pool threads.
+  void Schedule(std::function<void()> task);
+
+  /// Like `Schedule()`, but see `TryRun()`. Returns true if @p task is
+  /// scheduled.
+  bool TrySchedule(std::function<void()> task, std::size_t max_busy);
+
+  /**
+   * Calls @p fn for each index in `[0, count)` and waits for all the calls.
+   *
+   * The calling thread runs some of the calls itself, and only waits for the
+   * calls already running on the pool. This is safe to use from a task running
+   * on this executor, even if all the other threads are busy.
+   */
+  void RunConcurrently(std::size_t count, std::function<void(std::size_t)> fn);
+
+  /// The maximum number of threads used by this executor.
+  std::size_t max_threads() const;
+
+ private:
+  struct State;
+  static void Worker(std::shared_ptr<State> state);
+  // Queues @p task and starts a thread for it if needed. Requires `state_->mu`.
+  void ScheduleLocked(std::function<void()> task);
+
+  std::shared_ptr<State> state_;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_BLOCKING_EXECUTOR_H
@@ -0,0 +1,193 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/blocking_executor.h"
+#include <gmock/gmock.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::Le;
+
+TEST(BlockingExecutor, RunReturnsValue) {
+  BlockingExecutor executor(2);
+  auto f = executor.Run([] { return 42; });
+  EXPECT_EQ(f.get(), 42);
+  auto v = executor.Run([] {});
+  v.get();
+}
+
+TEST(BlockingExecutor, RunsConcurrently) {
+  BlockingExecutor executor(4);
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  std::atomic<int> started{0};
+
+  std::vector<future<int>> results;
+  for (int i = 0; i != 4; ++i) {
+    results.push_back(executor.Run([&started, released, i] {
+      ++started;
+      released.get();
+      return i;
+    }));
+  }
+  // All four tasks must be running at the same time before any completes.
+  while (started.load() != 4) std::this_thread::yield();
+  release.set_value();
+
+  std::vector<int> values;
+  for (auto& f : results) values.push_back(f.get());
+  EXPECT_THAT(values, ElementsAre(0, 1, 2, 3));
+}
+
+TEST(BlockingExecutor, BurstWithIdleThreadRunsConcurrently) {
+  BlockingExecutor executor(4);
+  // Leave one idle thread in the pool.
+  executor.Run([] {}).get();
+
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  std::atomic<int> started{0};
+  std::vector<future<void>> results;
+  for (int i = 0; i != 4; ++i) {
+    results.push_back(executor.Run([&started, released] {
+      ++started;
+      released.get();
+    }));
+  }
+  // The tasks block until released, they only all start if they run on
+  // different threads.
+  auto const deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (started.load() != 4 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(started.load(), 4);
+  release.set_value();
+  for (auto& f : results) f.get();
+}
+
+TEST(BlockingExecutor, BoundsConcurrency) {
+  BlockingExecutor executor(2);
+  EXPECT_EQ(executor.max_threads(), 2U);
+  std::atomic<int> running{0};
+  std::atomic<int> max_running{0};
+
+  std::vector<future<void>> results;
+  for (int i = 0; i != 16; ++i) {
+    results.push_back(executor.Run([&] {
+      auto const r = ++running;
+      auto m = max_running.load();
+      while (r > m && !max_running.compare_exchange_weak(m, r)) {
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      --running;
+    }));
+  }
+  for (auto& f : results) f.get();
+  EXPECT_THAT(max_running.load(), Le(2));
+}
+
+TEST(BlockingExecutor, TryRunLimitsBusyThreads) {
+  BlockingExecutor executor(4);
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  std::vector<future<int>> results;
+  for (int i = 0; i != 2; ++i) {
+    auto f = executor.TryRun(
+        [released] {
+          released.get();
+          return 42;
+        },
+        2);
+    ASSERT_TRUE(f.has_value());
+    results.push_back(*std::move(f));
+  }
+  // Two threads are busy, only `Run()` may use the other two.
+  EXPECT_FALSE(executor.TryRun([] { return 0; }, 2).has_value());
+  EXPECT_EQ(executor.Run([] { return 7; }).get(), 7);
+
+  release.set_value();
+  for (auto& f : results) EXPECT_EQ(f.get(), 42);
+}
+
+TEST(BlockingExecutor, TryRunWithoutFreeThread) {
+  BlockingExecutor executor(1);
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  auto busy = executor.Run([released] { released.get(); });
+  EXPECT_FALSE(executor.TryRun([] { return 0; }, 2).has_value());
+  release.set_value();
+  busy.get();
+}
+
+TEST(BlockingExecutor, IdleThreadsExit) {
+  BlockingExecutor executor(2, std::chrono::milliseconds(1));
+  EXPECT_EQ(executor.Run([] { return 1; }).get(), 1);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  // A new thread is created on demand after the previous one exits.
+  EXPECT_EQ(executor.Run([] { return 2; }).get(), 2);
+}
+
+TEST(BlockingExecutor, DestructorDrainsWork) {
+  std::atomic<int> count{0};
+  {
+    BlockingExecutor executor(1);
+    for (int i = 0; i != 8; ++i) {
+      executor.Schedule([&count] { ++count; });
+    }
+  }
+  EXPECT_EQ(count.load(), 8);
+}
+
+TEST(BlockingExecutor, RunConcurrently) {
+  BlockingExecutor executor(3);
+  std::vector<std::atomic<int>> calls(10);
+  executor.RunConcurrently(calls.size(),
+                           [&calls](std::size_t i) { ++calls[i]; });
+  for (auto const& c : calls) EXPECT_EQ(c.load(), 1);
+  executor.RunConcurrently(0, [](std::size_t) { FAIL(); });
+}
+
+TEST(BlockingExecutor, RunConcurrentlyFromBusyPool) {
+  // Every thread in the pool waits for its own nested calls, which cannot be
+  // scheduled on the pool.
+  BlockingExecutor executor(2);
+  std::atomic<int> count{0};
+  std::vector<future<void>> outer;
+  for (int i = 0; i != 2; ++i) {
+    outer.push_back(executor.Run([&executor, &count] {
+      executor.RunConcurrently(4, [&count](std::size_t) { ++count; });
+    }));
+  }
+  for (auto& f : outer) f.get();
+  EXPECT_EQ(count.load(), 8);
+}
+
+TEST(BlockingExecutor, ZeroThreadsUsesOne) {
+  BlockingExecutor executor(0);
+  EXPECT_EQ(executor.max_threads(), 1U);
+  EXPECT_EQ(executor.Run([] { return 7; }).get(), 7);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -15,12 +15,32 @@
 #include "google/cloud/bigquery_unified/internal/connection_impl.h"
 #include "google/cloud/bigquery/storage/v1/internal/bigquery_read_connection_impl.h"
 #include "google/cloud/bigquery/storage/v1/internal/bigquery_read_option_defaults.h"
-#include "google/cloud/bigquery/storage/v1/internal/bigquery_read_stub_factory.h"
+#include "google/cloud/bigquery/storage/v1/internal/bigquery_read_auth_decorator.h"
+#include "google/cloud/bigquery/storage/v1/internal/bigquery_read_logging_decorator.h"
+#include "google/cloud/bigquery/storage/v1/internal/bigquery_read_metadata_decorator.h"
+#include "google/cloud/bigquery/storage/v1/internal/bigquery_read_stub.h"
+#include "google/cloud/bigquery/storage/v1/internal/bigquery_read_tracing_stub.h"
 #include "google/cloud/bigquery/storage/v1/internal/bigquery_read_tracing_connection.h"
 #include "google/cloud/bigquery_unified/idempotency_policy.h"
+#include "google/cloud/bigquery_unified/connection_options.h"
 #include "google/cloud/bigquery_unified/internal/arrow_reader.h"
 #include "google/cloud/bigquery_unified/internal/async_rest_long_running_operation_custom.h"
 #include "google/cloud/bigquery_unified/internal/default_options.h"
+#include "google/cloud/bigquery_unified/internal/job_long_poll.h"
+#include "google/cloud/bigquery_unified/internal/job_rest_stats_stub.h"
+#include "google/cloud/bigquery_unified/internal/lazy_connection.h"
+#include "google/cloud/bigquery_unified/internal/list_jobs_stream.h"
+#include "google/cloud/bigquery_unified/internal/query_cache_connection.h"
+#include "google/cloud/bigquery_unified/internal/read_channel_pool.h"
+#include "google/cloud/bigquery_unified/internal/read_channels.h"
+#include "google/cloud/bigquery_unified/internal/read_metrics.h"
+#include "google/cloud/bigquery_unified/internal/read_metrics_stub.h"
+#include "google/cloud/bigquery_unified/internal/read_rows_watchdog.h"
+#include "google/cloud/bigquery_unified/internal/read_session_stats_recorder.h"
+#include "google/cloud/bigquery_unified/internal/read_tracing.h"
+#include "google/cloud/bigquery_unified/internal/read_strategy.h"
+#include "google/cloud/bigquery_unified/internal/shared_background_threads.h"
+#include "google/cloud/bigquery_unified/internal/table_schema.h"
 #include "google/cloud/bigquery_unified/internal/tracing_connection.h"
 #include "google/cloud/bigquery_unified/job_options.h"
 #include "google/cloud/bigquery_unified/read_options.h"
@@ -29,10 +49,37 @@
 #include "google/cloud/bigquerycontrol/v2/internal/job_rest_connection_impl.h"
 #include "google/cloud/bigquerycontrol/v2/internal/job_rest_stub_factory.h"
 #include "google/cloud/bigquerycontrol/v2/internal/job_tracing_connection.h"
+#include "google/cloud/bigquerycontrol/v2/internal/table_option_defaults.h"
+#include "google/cloud/bigquerycontrol/v2/internal/table_rest_connection_impl.h"
+#include "google/cloud/bigquerycontrol/v2/internal/table_rest_stub_factory.h"
+#include "google/cloud/bigquerycontrol/v2/internal/table_tracing_connection.h"
 #include "google/cloud/background_threads.h"
 #include "google/cloud/grpc_options.h"
-#include "google/cloud/internal/rest_background_threads_impl.h"
+#include "google/cloud/internal/absl_str_cat_quiet.h"
+#include "google/cloud/internal/algorithm.h"
+#include "google/cloud/internal/curl_options.h"
+#include "google/cloud/internal/opentelemetry.h"
+#include "google/cloud/internal/random.h"
 #include "google/cloud/internal/rest_retry_loop.h"
+#include "google/cloud/internal/unified_grpc_credentials.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/strip.h"
+#include <arrow/util/key_value_metadata.h>
+#include <grpc/grpc.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+#include <opentelemetry/context/runtime_context.h>
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
 
 namespace google::cloud::bigquery_unified_internal {
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
@@ -56,6 +103,349 @@ std::unique_ptr<PollingPolicy> polling_policy(Options const& options) {
   return options.get<bigquery_unified::PollingPolicyOption>()->clone();
 }
 
+// Creates a read session, or reuses a cached one if the cache is enabled.
+StatusOr<google::cloud::bigquery::storage::v1::ReadSession> CreateReadSession(
+    bigquery_storage_v1::BigQueryReadConnection& read_connection,
+    ReadSessionCache& cache,
+    google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+        request,
+    Options const& options) {
+  auto const capacity =
+      options.get<bigquery_unified::ReadSessionCacheSizeOption>();
+  if (capacity == 0) return read_connection.CreateReadSession(request);
+  return cache.GetOrCreate(
+      request,
+      options.get<bigquery_unified::ReadSessionCacheExpiryMarginOption>(),
+      capacity,
+      [&read_connection](
+          google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+              r) { return read_connection.CreateReadSession(r); });
+}
+
+// Lists a single job of the billing project, so the REST connection is
+// established and the credentials are ready before the first job request.
+//
+// Without a billing project there is no valid call to make, and the REST
+// connection is not warmed up. A principal may create jobs without permission
+// to list them. A permission error still proves that the service accepted the
+// credentials, so it is not an error here.
+Status WarmUpJobConnection(
+    bigquerycontrol_v2_internal::JobServiceRestStub& stub,
+    Options const& options) {
+  if (!options.has<bigquery_unified::BillingProjectOption>()) return Status{};
+  google::cloud::bigquery::v2::ListJobsRequest request;
+  request.set_project_id(options.get<bigquery_unified::BillingProjectOption>());
+  request.mutable_max_results()->set_value(1);
+  request.set_projection(google::cloud::bigquery::v2::ListJobsRequest::MINIMAL);
+  rest_internal::RestContext context;
+  auto status = stub.ListJobs(context, options, request).status();
+  if (status.code() == StatusCode::kPermissionDenied) return Status{};
+  return status;
+}
+
+// Creates the `ReadArrowResponse` for `session`, with one reader per stream.
+// If `batch_metadata` is not null it is added to the schema of each record
+// batch. Creating a reader starts reading its stream, if `executor` is not
+// null the streams are started concurrently. If `tracer` is not null each
+// stream is traced. The metrics of the read are recorded with `instruments`,
+// if it is not null and `EnableReadMetricsOption` is set.
+StatusOr<bigquery_unified::ReadArrowResponse> MakeReadArrowResponse(
+    std::shared_ptr<bigquery_storage_v1::BigQueryReadConnection> const&
+        read_connection,
+    google::cloud::bigquery::storage::v1::ReadSession const& session,
+    internal::ImmutableOptions const& current_options,
+    std::shared_ptr<arrow::KeyValueMetadata const> const& batch_metadata,
+    BlockingExecutor* executor, std::shared_ptr<ReadTracer> const& tracer,
+    std::shared_ptr<ReadMetricsInstruments> const& instruments) {
+  bigquery_unified::ReadArrowResponse read_response;
+  auto arrow_schema = GetArrowSchema(session.arrow_schema());
+  if (!arrow_schema) return std::move(arrow_schema).status();
+  read_response.estimated_total_bytes_scanned =
+      session.estimated_total_bytes_scanned();
+  read_response.estimated_total_physical_file_size =
+      session.estimated_total_physical_file_size();
+  read_response.estimated_row_count = session.estimated_row_count();
+  read_response.expire_time = session.expire_time();
+  read_response.schema = arrow_schema->first;
+
+  // The decoded record batches share their schema, so the metadata is attached
+  // once per session instead of once per batch.
+  auto batch_schema = arrow_schema->first;
+  if (batch_metadata) {
+    auto const& metadata = batch_schema->metadata();
+    batch_schema = batch_schema->WithMetadata(
+        metadata ? metadata->Merge(*batch_metadata) : batch_metadata);
+  }
+
+  auto const& streams = session.streams();
+  std::vector<std::string> stream_names;
+  stream_names.reserve(streams.size());
+  for (auto const& s : streams) stream_names.push_back(s.name());
+  read_response.stats = std::make_shared<bigquery_unified::ReadSessionStats>(
+      std::move(stream_names));
+  std::shared_ptr<ReadMetrics> table_metrics;
+  if (current_options->get<bigquery_unified::EnableReadMetricsOption>()) {
+    table_metrics = MakeReadMetrics(instruments, session.table());
+  }
+  std::shared_ptr<ReadMetrics> metrics =
+      std::make_shared<ReadSessionStatsRecorder>(
+          read_response.stats,
+          CombineReadMetrics({tracer, std::move(table_metrics)}));
+  // The stub counts the resumes of each stream with the recorder it finds in
+  // the options of the call.
+  auto read_rows_options = std::make_shared<Options const>(
+      Options(*current_options).set<ReadMetricsOption>(metrics));
+
+  auto make_reader = [&](std::string const& stream_name) {
+    // It's important to call ReadRows from read_connection_ in order to
+    // leverage the existing ResumableStreamingRead that it creates around
+    // the call to ReadRows in its stub.
+    auto factory =
+        [connection = read_connection, read_rows_options](
+            google::cloud::bigquery::storage::v1::ReadRowsRequest const& r) {
+      google::cloud::internal::OptionsSpan span(*read_rows_options);
+      return std::make_shared<
+          StreamRange<google::cloud::bigquery::storage::v1::ReadRowsResponse>>(
+          connection->ReadRows(r));
+    };
+
+    auto make_stream = [&] {
+      return google::cloud::internal::MakeStreamRange<
+          std::shared_ptr<arrow::RecordBatch>>(
+          current_options,
+          ArrowRecordBatchReader(stream_name, batch_schema,
+                                 arrow_schema->second, std::move(factory),
+                                 metrics));
+    };
+    if (!tracer) return make_stream();
+    return tracer->TraceStream(stream_name, make_stream);
+  };
+
+  if (executor == nullptr || streams.size() < 2) {
+    for (auto const& s : streams) {
+      read_response.readers.push_back(make_reader(s.name()));
+    }
+    return read_response;
+  }
+  read_response.readers.resize(streams.size());
+  executor->RunConcurrently(read_response.readers.size(), [&](std::size_t i) {
+    read_response.readers[i] =
+        make_reader(streams.Get(static_cast<int>(i)).name());
+  });
+  return read_response;
+}
+
+bool EarlierThan(google::protobuf::Timestamp const& a,
+                 google::protobuf::Timestamp const& b) {
+  return std::make_tuple(a.seconds(), a.nanos()) <
+         std::make_tuple(b.seconds(), b.nanos());
+}
+
+// The resolution of the timers used by the job polling loops. The polling
+// policies wait at least a second between polls by default.
+auto constexpr kPollingTimerTick = std::chrono::milliseconds(50);
+
+// The OpenTelemetry context of the operation that awaits a job. The polls run
+// on executor threads, started by timers on the completion queue threads, so
+// the context is captured when the operation starts to wait and restored in
+// each poll. Their RPCs are then traced as children of its span.
+class PollTraceContext {
+ public:
+  PollTraceContext()
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+      : context_(opentelemetry::context::RuntimeContext::GetCurrent())
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+  {
+  }
+
+  template <typename F>
+  auto Run(F&& f) const {
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+    auto token = opentelemetry::context::RuntimeContext::Attach(context_);
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+    return std::forward<F>(f)();
+  }
+
+ private:
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+  opentelemetry::context::Context context_;
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+};
+
+// The state needed to await a job. It is copied into the polling loops, which
+// may outlive the connection.
+struct JobPollContext {
+  CompletionQueue cq;
+  std::shared_ptr<bigquerycontrol_v2_internal::JobServiceRestStub> stub;
+  std::shared_ptr<BlockingExecutor> executor;
+  // Runs the long polls, see `MakeLongPollExecutor()`.
+  std::shared_ptr<BlockingExecutor> long_poll_executor;
+  // The maximum number of busy threads in `long_poll_executor` for a long poll
+  // to start, see `LongPollLimit()`.
+  std::size_t long_poll_limit;
+  std::shared_ptr<JobWatcher> watcher;
+  std::shared_ptr<TimerWheel> timers;
+};
+
+future<StatusOr<google::cloud::bigquery::v2::Job>> AwaitJob(
+    JobPollContext const& poll_context,
+    google::cloud::bigquery::v2::Job const& operation,
+    std::shared_ptr<Options const> const& current_options,
+    std::string operation_name) {
+  if (current_options->get<bigquery_unified::JobCompletionStrategyOption>() ==
+      bigquery_unified::JobCompletionStrategy::kWatch) {
+    if (operation.status().state() == "DONE") {
+      return make_ready_future(
+          StatusOr<google::cloud::bigquery::v2::Job>(operation));
+    }
+    return poll_context.watcher->Watch(poll_context.cq, operation,
+                                       current_options,
+                                       polling_policy(*current_options));
+  }
+
+  using PollFunction = AsyncRestPollLongRunningOperation<
+      google::cloud::bigquery::v2::Job,
+      google::cloud::bigquery::v2::GetJobRequest>;
+  PollTraceContext const trace_context;
+  // The REST stub blocks, so the polls and cancels run on the executor. The
+  // completion queue threads only run the timers and the continuations.
+  PollFunction poll =
+      [stub = poll_context.stub, executor = poll_context.executor,
+       trace_context](
+          CompletionQueue&, std::unique_ptr<rest_internal::RestContext>,
+          google::cloud::internal::ImmutableOptions options,
+          google::cloud::bigquery::v2::GetJobRequest const& request) {
+        return executor->Run(
+            [stub, trace_context, options = std::move(options), request] {
+              return trace_context.Run([&] {
+                rest_internal::RestContext context;
+                return stub->GetJob(context, *options, request);
+              });
+            });
+      };
+  auto policy = polling_policy(*current_options);
+  if (operation.configuration().job_type() == "QUERY" &&
+      current_options->get<bigquery_unified::JobCompletionStrategyOption>() ==
+          bigquery_unified::JobCompletionStrategy::kLongPoll) {
+    // The long polls wait in the service, so there is no need to wait before
+    // the first one either. They block a thread for a while, so they only
+    // start if a thread is free for them. Otherwise the poll uses `jobs.get`,
+    // and the next one waits for the backoff of the polling policy.
+    auto const timeout =
+        current_options->get<bigquery_unified::JobLongPollTimeoutOption>();
+    auto skip_wait = std::make_shared<std::atomic<bool>>(true);
+    policy = std::make_unique<LongPollPollingPolicy>(std::move(policy),
+                                                     skip_wait, timeout);
+    poll = [stub = poll_context.stub,
+            executor = poll_context.long_poll_executor,
+            limit = poll_context.long_poll_limit, get_job = std::move(poll),
+            skip_wait, trace_context, timeout](
+               CompletionQueue& cq,
+               std::unique_ptr<rest_internal::RestContext> context,
+               google::cloud::internal::ImmutableOptions options,
+               google::cloud::bigquery::v2::GetJobRequest const& request) {
+      auto f = executor->TryRun(
+          [stub, skip_wait, timeout, trace_context, options, request] {
+            return trace_context.Run([&] {
+              return LongPollJob(*stub, *skip_wait, timeout, *options,
+                                 request);
+            });
+          },
+          limit);
+      if (f) return *std::move(f);
+      *skip_wait = false;
+      return get_job(cq, std::move(context), std::move(options), request);
+    };
+  }
+
+  return bigquery_unified_internal::AsyncRestAwaitLongRunningOperation<
+      google::cloud::bigquery::v2::Job, google::cloud::bigquery::v2::Job,
+      google::cloud::bigquery::v2::GetJobRequest,
+      google::cloud::bigquery::v2::CancelJobRequest>(
+      poll_context.cq, current_options, operation, std::move(poll),
+      [stub = poll_context.stub, executor = poll_context.executor,
+       trace_context](
+          CompletionQueue&, std::unique_ptr<rest_internal::RestContext>,
+          google::cloud::internal::ImmutableOptions options,
+          google::cloud::bigquery::v2::CancelJobRequest const& request) {
+        return executor->Run([stub, trace_context, options = std::move(options),
+                              request]() -> Status {
+          return trace_context.Run([&] {
+            rest_internal::RestContext context;
+            return stub->CancelJob(context, *options, request).status();
+          });
+        });
+      },
+      [](StatusOr<google::cloud::bigquery::v2::Job> op, std::string const&) {
+        return op;
+      },
+      std::move(policy), __func__,
+      [](google::cloud::bigquery::v2::Job const& op) {
+        return op.status().state() == "DONE";
+      },
+      [ref = operation.job_reference()](
+          std::string const&, google::cloud::bigquery::v2::GetJobRequest& r) {
+        r.set_project_id(ref.project_id());
+        r.set_job_id(ref.job_id());
+        r.set_location(ref.location().value());
+      },
+      [ref = operation.job_reference()](
+          std::string const&,
+          google::cloud::bigquery::v2::CancelJobRequest& r) {
+        r.set_project_id(ref.project_id());
+        r.set_job_id(ref.job_id());
+        r.set_location(ref.location().value());
+      },
+      [op_name = std::move(operation_name)](
+          StatusOr<google::cloud::bigquery::v2::Job> const&) {
+        return op_name;
+      },
+      poll_context.timers);
+}
+
+StatusOr<google::cloud::bigquery::v2::JobCancelResponse> CancelJobWithRetry(
+    bigquerycontrol_v2_internal::JobServiceRestStub& stub,
+    google::cloud::bigquery::v2::CancelJobRequest const& cancel_request,
+    Options const& current_options) {
+  auto idempotency = idempotency_policy(current_options)
+                         ->CancelJob(cancel_request, current_options);
+  return rest_internal::RestRetryLoop(
+      retry_policy(current_options), backoff_policy(current_options),
+      std::move(idempotency),
+      [&stub](rest_internal::RestContext& rest_context, Options const& options,
+              google::cloud::bigquery::v2::CancelJobRequest const& request) {
+        return stub.CancelJob(rest_context, options, request);
+      },
+      current_options, cancel_request, __func__);
+}
+
+// Returns the pool shared through `BlockingThreadPoolOption`, or a new pool
+// for this connection.
+std::shared_ptr<BlockingExecutor> MakeBlockingExecutor(Options const& options) {
+  auto const& pool = options.get<bigquery_unified::BlockingThreadPoolOption>();
+  if (pool) return GetBlockingExecutor(*pool);
+  return std::make_shared<BlockingExecutor>(
+      options.get<bigquery_unified::MaxConcurrentRpcsOption>());
+}
+
+// Returns the pool for the long polls of the jobs awaited by a connection: the
+// pool shared through `BlockingThreadPoolOption`, or a new pool of
+// `MaxConcurrentRpcsOption` threads for this connection.
+std::shared_ptr<BlockingExecutor> MakeLongPollExecutor(Options const& options) {
+  return MakeBlockingExecutor(options);
+}
+
+// Each long poll holds a thread until the job completes or the poll times out.
+// The long polls only start if fewer threads are busy than this limit, so they
+// never queue, and a shared pool keeps half of its threads for other work.
+std::size_t LongPollLimit(Options const& options,
+                          BlockingExecutor const& executor) {
+  if (!options.get<bigquery_unified::BlockingThreadPoolOption>()) {
+    return executor.max_threads();
+  }
+  return std::max<std::size_t>(executor.max_threads() / 2, 1);
+}
+
 }  // namespace
 
 ConnectionImpl::ConnectionImpl(
@@ -63,39 +453,72 @@ ConnectionImpl::ConnectionImpl(
         read_connection,
     std::shared_ptr<google::cloud::bigquerycontrol_v2::JobServiceConnection>
         job_connection,
+    std::shared_ptr<google::cloud::bigquerycontrol_v2::TableServiceConnection>
+        table_connection,
     google::cloud::Options read_options, google::cloud::Options job_options,
+    google::cloud::Options table_options,
     std::shared_ptr<bigquerycontrol_v2_internal::JobServiceRestStub> job_stub,
     std::unique_ptr<google::cloud::BackgroundThreads> background,
-    google::cloud::Options options)
+    google::cloud::Options options,
+    std::function<Status()> connect_read_channels)
     : read_connection_(std::move(read_connection)),
       job_connection_(std::move(job_connection)),
+      table_connection_(std::move(table_connection)),
       job_stub_(std::move(job_stub)),
       read_options_(std::move(read_options)),
       job_options_(std::move(job_options)),
+      table_options_(std::move(table_options)),
       background_(std::move(background)),
-      options_(std::move(options)) {}
+      options_(std::move(options)),
+      prepared_job_options_(internal::MergeOptions(options_, job_options_)),
+      prepared_read_options_(read_options_),
+      prepared_table_options_(internal::MergeOptions(options_, table_options_)),
+      blocking_executor_(MakeBlockingExecutor(options_)),
+      read_session_cache_(std::make_shared<ReadSessionCache>()),
+      table_schema_cache_(std::make_shared<TableSchemaCache>()),
+      read_metrics_instruments_(MakeReadMetricsInstruments(read_options_)),
+      job_watcher_(std::make_shared<JobWatcher>(
+          job_stub_, blocking_executor_,
+          options_.get<bigquery_unified::JobWatchPeriodOption>())),
+      polling_timers_(std::make_shared<TimerWheel>(kPollingTimerTick)),
+      poll_executor_(MakeBlockingExecutor(options_)),
+      long_poll_executor_(MakeLongPollExecutor(options_)),
+      long_poll_limit_(LongPollLimit(options_, *long_poll_executor_)),
+      connect_read_channels_(std::move(connect_read_channels)) {}
+
+future<Status> ConnectionImpl::WarmUp(Options opts) {
+  // This connects all the read channels, `QueryArrow()` has nothing to add.
+  read_warm_up_started_ = true;
+  auto job_options = prepared_job_options_.ForCall(std::move(opts));
+  return blocking_executor_->Run([executor = blocking_executor_,
+                                  connect = connect_read_channels_,
+                                  job_stub = job_stub_, job_options] {
+    std::array<Status, 2> results;
+    executor->RunConcurrently(results.size(), [&](std::size_t i) {
+      if (i == 0) {
+        if (connect) results[i] = connect();
+        return;
+      }
+      internal::OptionsSpan span(*job_options);
+      results[i] = WarmUpJobConnection(*job_stub, *job_options);
+    });
+    for (auto& status : results) {
+      if (!status.ok()) return std::move(status);
+    }
+    return Status{};
+  });
+}
 
 future<StatusOr<google::cloud::bigquery::v2::Job>> ConnectionImpl::CancelJob(
     google::cloud::bigquery::v2::CancelJobRequest const& request,
     Options opts) {
   // TODO: Instead of creating an OptionsSpan, pass opts when job_connection_
   // supports it.
-  internal::OptionsSpan span(internal::MergeOptions(
-      std::move(opts), internal::MergeOptions(options_, job_options_)));
+  internal::OptionsSpan span(prepared_job_options_.ForCall(std::move(opts)));
   auto current_options = google::cloud::internal::SaveCurrentOptions();
 
-  auto idempotency = idempotency_policy(*current_options)
-                         ->CancelJob(request, *current_options);
-  auto cancel_response = rest_internal::RestRetryLoop(
-      retry_policy(*current_options), backoff_policy(*current_options),
-      std::move(idempotency),
-      [stub = job_stub_](
-          rest_internal::RestContext& rest_context, Options const& options,
-          google::cloud::bigquery::v2::CancelJobRequest const& request) {
-        return stub->CancelJob(rest_context, options, request);
-      },
-      *current_options, request, __func__);
-
+  auto cancel_response =
+      CancelJobWithRetry(*job_stub_, request, *current_options);
   if (!cancel_response) {
     return make_ready_future(
         StatusOr<google::cloud::bigquery::v2::Job>(cancel_response.status()));
@@ -110,8 +533,7 @@ StatusOr<google::cloud::bigquery::v2::JobReference> ConnectionImpl::CancelJob(
     Options opts) {
   // TODO: Instead of creating an OptionsSpan, pass opts when job_connection_
   // supports it.
-  internal::OptionsSpan span(internal::MergeOptions(
-      std::move(opts), internal::MergeOptions(options_, job_options_)));
+  internal::OptionsSpan span(prepared_job_options_.ForCall(std::move(opts)));
   auto current_options = google::cloud::internal::SaveCurrentOptions();
 
   auto cancel_response = job_connection_->CancelJob(request);
@@ -126,8 +548,7 @@ future<StatusOr<google::cloud::bigquery::v2::Job>> ConnectionImpl::CancelJob(
     Options opts) {
   // TODO: Instead of creating an OptionsSpan, pass opts when job_connection_
   // supports it.
-  internal::OptionsSpan span(internal::MergeOptions(
-      std::move(opts), internal::MergeOptions(options_, job_options_)));
+  internal::OptionsSpan span(prepared_job_options_.ForCall(std::move(opts)));
   auto current_options = google::cloud::internal::SaveCurrentOptions();
 
   google::cloud::bigquery::v2::GetJobRequest get_job_request;
@@ -148,8 +569,7 @@ Status ConnectionImpl::DeleteJob(
     Options opts) {
   // TODO: Instead of creating an OptionsSpan, pass opts when job_connection_
   // supports it.
-  internal::OptionsSpan span(internal::MergeOptions(
-      std::move(opts), internal::MergeOptions(options_, job_options_)));
+  internal::OptionsSpan span(prepared_job_options_.ForCall(std::move(opts)));
   return job_connection_->DeleteJob(request);
 }
 
@@ -157,8 +577,7 @@ StatusOr<google::cloud::bigquery::v2::Job> ConnectionImpl::GetJob(
     google::cloud::bigquery::v2::GetJobRequest const& request, Options opts) {
   // TODO: Instead of creating an OptionsSpan, pass opts when job_connection_
   // supports it.
-  internal::OptionsSpan span(internal::MergeOptions(
-      std::move(opts), internal::MergeOptions(options_, job_options_)));
+  internal::OptionsSpan span(prepared_job_options_.ForCall(std::move(opts)));
   return job_connection_->GetJob(request);
 }
 
@@ -166,57 +585,10 @@ future<StatusOr<google::cloud::bigquery::v2::Job>> ConnectionImpl::JobPoll(
     google::cloud::bigquery::v2::Job const& operation,
     std::shared_ptr<Options const> const& current_options,
     std::string operation_name) {
-  return bigquery_unified_internal::AsyncRestAwaitLongRunningOperation<
-      google::cloud::bigquery::v2::Job, google::cloud::bigquery::v2::Job,
-      google::cloud::bigquery::v2::GetJobRequest,
-      google::cloud::bigquery::v2::CancelJobRequest>(
-      background_->cq(), current_options, operation,
-      [stub = job_stub_](
-          CompletionQueue& cq,
-          std::unique_ptr<rest_internal::RestContext> context,
-          google::cloud::internal::ImmutableOptions options,
-          google::cloud::bigquery::v2::GetJobRequest const& request)
-          -> future<StatusOr<google::cloud::bigquery::v2::Job>> {
-        return make_ready_future(
-            stub->GetJob(*std::move(context), *std::move(options), request));
-      },
-      [stub = job_stub_](
-          CompletionQueue& cq,
-          std::unique_ptr<rest_internal::RestContext> context,
-          google::cloud::internal::ImmutableOptions options,
-          google::cloud::bigquery::v2::CancelJobRequest const& request)
-          -> future<Status> {
-        auto cancel_response =
-            stub->CancelJob(*std::move(context), *std::move(options), request);
-        if (!cancel_response) {
-          return make_ready_future(std::move(cancel_response).status());
-        }
-        return make_ready_future(Status{});
-      },
-      [](StatusOr<google::cloud::bigquery::v2::Job> op, std::string const&) {
-        return op;
-      },
-      polling_policy(*current_options), __func__,
-      [](google::cloud::bigquery::v2::Job const& op) {
-        return op.status().state() == "DONE";
-      },
-      [ref = operation.job_reference()](
-          std::string const&, google::cloud::bigquery::v2::GetJobRequest& r) {
-        r.set_project_id(ref.project_id());
-        r.set_job_id(ref.job_id());
-        r.set_location(ref.location().value());
-      },
-      [ref = operation.job_reference()](
-          std::string const&,
-          google::cloud::bigquery::v2::CancelJobRequest& r) {
-        r.set_project_id(ref.project_id());
-        r.set_job_id(ref.job_id());
-        r.set_location(ref.location().value());
-      },
-      [op_name = std::move(operation_name)](
-          StatusOr<google::cloud::bigquery::v2::Job> const&) {
-        return op_name;
-      });
+  return AwaitJob(JobPollContext{background_->cq(), job_stub_, poll_executor_,
+                                 long_poll_executor_, long_poll_limit_,
+                                 job_watcher_, polling_timers_},
+                  operation, current_options, std::move(operation_name));
 }
 
 std::string DetermineBillingProject(
@@ -238,22 +610,92 @@ std::string DetermineBillingProject(
   return "";
 }
 
-future<StatusOr<google::cloud::bigquery::v2::Job>> ConnectionImpl::InsertJob(
-    google::cloud::bigquery::v2::Job const& job, Options opts) {
-  // TODO: Instead of creating an OptionsSpan, pass opts when job_connection_
-  // supports it.
-  internal::OptionsSpan span(internal::MergeOptions(
-      std::move(opts), internal::MergeOptions(options_, job_options_)));
-  auto current_options = google::cloud::internal::SaveCurrentOptions();
+namespace {
+
+// Job ids may contain letters, numbers, underscores and dashes. 32 random
+// characters make collisions with other jobs practically impossible.
+std::string MakeJobId() {
+  thread_local auto generator = internal::MakeDefaultPRNG();
+  return "job_" + internal::Sample(generator, 32,
+                                   "abcdefghijklmnopqrstuvwxyz0123456789");
+}
+
+google::cloud::bigquery::v2::InsertJobRequest MakeInsertJobRequest(
+    google::cloud::bigquery::v2::Job const& job, Options const& options) {
   google::cloud::bigquery::v2::InsertJobRequest insert_request;
   auto const billing_project =
-      current_options->has<bigquery_unified::BillingProjectOption>()
-          ? current_options->get<bigquery_unified::BillingProjectOption>()
+      options.has<bigquery_unified::BillingProjectOption>()
+          ? options.get<bigquery_unified::BillingProjectOption>()
           : DetermineBillingProject(job);
 
   insert_request.set_project_id(billing_project);
   *insert_request.mutable_job() = job;
-  auto insert_response = job_connection_->InsertJob(insert_request);
+  // With a job id the request can be retried safely, the service rejects any
+  // attempt to create the same job twice.
+  auto& job_reference = *insert_request.mutable_job()->mutable_job_reference();
+  if (job_reference.job_id().empty()) job_reference.set_job_id(MakeJobId());
+  return insert_request;
+}
+
+// Returns true if @p status reports that the job id is already in use.
+//
+// The service reports duplicate jobs with HTTP 409 and the "duplicate" reason,
+// the REST transport maps HTTP 409 to `kAborted`. The transport may not keep
+// the reason, but the message of these errors starts with "Already Exists".
+bool IsDuplicateJob(Status const& status) {
+  if (status.code() == StatusCode::kAlreadyExists) return true;
+  if (status.code() != StatusCode::kAborted) return false;
+  return status.error_info().reason() == "duplicate" ||
+         absl::StartsWith(status.message(), "Already Exists");
+}
+
+// Inserts a job, retrying transient failures if the request is idempotent.
+//
+// If an attempt fails with an ambiguous error the job may have been created
+// anyway, and the next attempt fails because the job id is in use. In that
+// case the job is fetched and returned as if the insertion succeeded. Such an
+// error on the first attempt is returned as-is, the job id is used by some
+// other job.
+StatusOr<google::cloud::bigquery::v2::Job> InsertJobWithRetry(
+    std::shared_ptr<bigquerycontrol_v2_internal::JobServiceRestStub> const&
+        stub,
+    google::cloud::bigquery::v2::InsertJobRequest const& insert_request,
+    Options const& current_options) {
+  auto idempotency = idempotency_policy(current_options)
+                         ->InsertJob(insert_request, current_options);
+  auto attempts = 0;
+  return rest_internal::RestRetryLoop(
+      retry_policy(current_options), backoff_policy(current_options),
+      std::move(idempotency),
+      [&stub, &attempts](
+          rest_internal::RestContext& rest_context, Options const& options,
+          google::cloud::bigquery::v2::InsertJobRequest const& request)
+          -> StatusOr<google::cloud::bigquery::v2::Job> {
+        auto response = stub->InsertJob(rest_context, options, request);
+        if (++attempts == 1 || !IsDuplicateJob(response.status())) {
+          return response;
+        }
+        google::cloud::bigquery::v2::GetJobRequest get_job_request;
+        get_job_request.set_project_id(request.project_id());
+        get_job_request.set_job_id(request.job().job_reference().job_id());
+        get_job_request.set_location(
+            request.job().job_reference().location().value());
+        rest_internal::RestContext get_job_context;
+        return stub->GetJob(get_job_context, options, get_job_request);
+      },
+      current_options, insert_request, __func__);
+}
+
+}  // namespace
+
+future<StatusOr<google::cloud::bigquery::v2::Job>> ConnectionImpl::InsertJob(
+    google::cloud::bigquery::v2::Job const& job, Options opts) {
+  // TODO: Instead of creating an OptionsSpan, pass opts when job_connection_
+  // supports it.
+  internal::OptionsSpan span(prepared_job_options_.ForCall(std::move(opts)));
+  auto current_options = google::cloud::internal::SaveCurrentOptions();
+  auto insert_response = InsertJobWithRetry(
+      job_stub_, MakeInsertJobRequest(job, *current_options), *current_options);
 
   if (!insert_response) {
     return make_ready_future(
@@ -268,18 +710,10 @@ StatusOr<google::cloud::bigquery::v2::JobReference> ConnectionImpl::InsertJob(
     Options opts) {
   // TODO: Instead of creating an OptionsSpan, pass opts when job_connection_
   // supports it.
-  internal::OptionsSpan span(internal::MergeOptions(
-      std::move(opts), internal::MergeOptions(options_, job_options_)));
+  internal::OptionsSpan span(prepared_job_options_.ForCall(std::move(opts)));
   auto current_options = google::cloud::internal::SaveCurrentOptions();
-  google::cloud::bigquery::v2::InsertJobRequest insert_request;
-  auto const billing_project =
-      current_options->has<bigquery_unified::BillingProjectOption>()
-          ? current_options->get<bigquery_unified::BillingProjectOption>()
-          : DetermineBillingProject(job);
-
-  insert_request.set_project_id(billing_project);
-  *insert_request.mutable_job() = job;
-  auto insert_response = job_connection_->InsertJob(insert_request);
+  auto insert_response = InsertJobWithRetry(
+      job_stub_, MakeInsertJobRequest(job, *current_options), *current_options);
   if (!insert_response) {
     return insert_response.status();
   }
@@ -289,8 +723,7 @@ StatusOr<google::cloud::bigquery::v2::JobReference> ConnectionImpl::InsertJob(
 future<StatusOr<google::cloud::bigquery::v2::Job>> ConnectionImpl::InsertJob(
     google::cloud::bigquery::v2::JobReference const& job_reference,
     Options opts) {
-  internal::OptionsSpan span(internal::MergeOptions(
-      std::move(opts), internal::MergeOptions(options_, job_options_)));
+  internal::OptionsSpan span(prepared_job_options_.ForCall(std::move(opts)));
   auto current_options = google::cloud::internal::SaveCurrentOptions();
 
   google::cloud::bigquery::v2::GetJobRequest get_job_request;
@@ -306,14 +739,313 @@ future<StatusOr<google::cloud::bigquery::v2::Job>> ConnectionImpl::InsertJob(
   return JobPoll(*get_job_response, current_options, "InsertJob");
 }
 
+namespace {
+
+// The jobs of an `InsertJobs()` call, shared by its submitters.
+struct InsertJobsState {
+  InsertJobsState(std::shared_ptr<BlockingExecutor> e, JobPollContext p,
+                  std::shared_ptr<Options const> o,
+                  std::vector<google::cloud::bigquery::v2::Job> j)
+      : executor(std::move(e)),
+        poll_context(std::move(p)),
+        options(std::move(o)),
+        jobs(std::move(j)),
+        promises(jobs.size()) {}
+
+  std::shared_ptr<BlockingExecutor> executor;
+  JobPollContext poll_context;
+  std::shared_ptr<Options const> options;
+  // The context of the call, so the inserts and the polls are traced as its
+  // children.
+  PollTraceContext trace_context;
+  std::vector<google::cloud::bigquery::v2::Job> jobs;
+  std::vector<promise<StatusOr<google::cloud::bigquery::v2::Job>>> promises;
+  std::atomic<std::size_t> next{0};
+};
+
+// Inserts the next job not yet submitted and starts awaiting it, without
+// waiting for it to complete. The next job is inserted by a new task, queued
+// behind the tasks scheduled meanwhile, so a long list of jobs does not hold
+// the pool threads until all the jobs are submitted.
+void SubmitNextJob(std::shared_ptr<InsertJobsState> state) {
+  auto const n = state->next++;
+  if (n >= state->jobs.size()) return;
+  {
+    internal::OptionsSpan span(*state->options);
+    state->trace_context.Run([&] {
+      auto insert_response = InsertJobWithRetry(
+          state->poll_context.stub,
+          MakeInsertJobRequest(state->jobs[n], *state->options),
+          *state->options);
+      if (!insert_response) {
+        state->promises[n].set_value(std::move(insert_response).status());
+        return;
+      }
+      AwaitJob(state->poll_context, *insert_response, state->options,
+               "InsertJob")
+          .then([state, n](
+                    future<StatusOr<google::cloud::bigquery::v2::Job>> f) {
+            state->promises[n].set_value(f.get());
+          });
+    });
+  }
+  auto executor = state->executor;
+  executor->Schedule([state = std::move(state)]() mutable {
+    SubmitNextJob(std::move(state));
+  });
+}
+
+}  // namespace
+
+std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>>
+ConnectionImpl::InsertJobs(std::vector<google::cloud::bigquery::v2::Job> jobs,
+                           Options opts) {
+  internal::OptionsSpan span(prepared_job_options_.ForCall(std::move(opts)));
+  auto current_options = google::cloud::internal::SaveCurrentOptions();
+
+  auto state = std::make_shared<InsertJobsState>(
+      blocking_executor_,
+      JobPollContext{background_->cq(), job_stub_, poll_executor_,
+                     long_poll_executor_, long_poll_limit_, job_watcher_,
+                     polling_timers_},
+      current_options, std::move(jobs));
+  std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>> futures;
+  futures.reserve(state->promises.size());
+  for (auto& p : state->promises) futures.push_back(p.get_future());
+
+  // Up to `MaxConcurrentRpcsOption` submitters insert the jobs concurrently,
+  // but at most half of the pool threads, leaving the others for the polls,
+  // the `ListJobs()` prefetch and the reads sharing the pool.
+  auto const submitters = std::min(
+      {state->jobs.size(),
+       std::max<std::size_t>(
+           current_options->get<bigquery_unified::MaxConcurrentRpcsOption>(),
+           1),
+       std::max<std::size_t>(blocking_executor_->max_threads() / 2, 1)});
+  for (std::size_t i = 0; i != submitters; ++i) {
+    blocking_executor_->Schedule([state] { SubmitNextJob(state); });
+  }
+  return futures;
+}
+
+namespace {
+
+google::cloud::bigquery::v2::ListJobsRequest::StateFilter ToStateFilter(
+    bigquery_unified::JobState state) {
+  switch (state) {
+    case bigquery_unified::JobState::kPending:
+      return google::cloud::bigquery::v2::ListJobsRequest::PENDING;
+    case bigquery_unified::JobState::kRunning:
+      return google::cloud::bigquery::v2::ListJobsRequest::RUNNING;
+    case bigquery_unified::JobState::kDone:
+      break;
+  }
+  return google::cloud::bigquery::v2::ListJobsRequest::DONE;
+}
+
+void ApplyListJobsOptions(google::cloud::bigquery::v2::ListJobsRequest& request,
+                          Options const& options) {
+  if (options.has<bigquery_unified::ListJobsProjectionOption>()) {
+    request.set_projection(
+        options.get<bigquery_unified::ListJobsProjectionOption>() ==
+                bigquery_unified::ListJobsProjection::kFull
+            ? google::cloud::bigquery::v2::ListJobsRequest::FULL
+            : google::cloud::bigquery::v2::ListJobsRequest::MINIMAL);
+  }
+  if (request.state_filter().empty()) {
+    for (auto state :
+         options.get<bigquery_unified::ListJobsStateFilterOption>()) {
+      request.add_state_filter(ToStateFilter(state));
+    }
+  }
+}
+
+StatusOr<google::cloud::bigquery::v2::JobList> ListJobsPage(
+    bigquerycontrol_v2_internal::JobServiceRestStub& stub,
+    Options const& current_options,
+    google::cloud::bigquery::v2::ListJobsRequest const& list_request) {
+  return rest_internal::RestRetryLoop(
+      retry_policy(current_options), backoff_policy(current_options),
+      idempotency_policy(current_options)
+          ->ListJobs(list_request, current_options),
+      [&stub](rest_internal::RestContext& rest_context, Options const& options,
+              google::cloud::bigquery::v2::ListJobsRequest const& request) {
+        return stub.ListJobs(rest_context, options, request);
+      },
+      current_options, list_request, __func__);
+}
+
+// Lists the jobs for all @p requests, fetching the next pages in the
+// background. Up to `MaxConcurrentRpcsOption` requests are listed in parallel.
+StreamRange<google::cloud::bigquery::v2::ListFormatJob> PrefetchListJobs(
+    std::shared_ptr<bigquerycontrol_v2_internal::JobServiceRestStub> stub,
+    std::shared_ptr<BlockingExecutor> executor,
+    std::vector<google::cloud::bigquery::v2::ListJobsRequest> requests,
+    std::shared_ptr<Options const> current_options) {
+  for (auto& request : requests) {
+    ApplyListJobsOptions(request, *current_options);
+  }
+  auto const max_pages = std::min(
+      requests.size(),
+      std::max<std::size_t>(
+          current_options->get<bigquery_unified::MaxConcurrentRpcsOption>(),
+          1));
+  return MakeListJobsStreamRange(
+      std::move(requests),
+      [stub = std::move(stub), current_options](
+          google::cloud::bigquery::v2::ListJobsRequest const& request) {
+        internal::OptionsSpan span(*current_options);
+        return ListJobsPage(*stub, *current_options, request);
+      },
+      std::move(executor), max_pages);
+}
+
+// Lists the jobs matched by `filter`, using `default_states` if the filter
+// has no states. The `jobs.list` RPC cannot filter by label, so the labels are
+// matched here, and the job configuration is only listed if needed.
+StatusOr<std::vector<google::cloud::bigquery::v2::JobReference>>
+ListFilteredJobs(
+    std::shared_ptr<bigquerycontrol_v2_internal::JobServiceRestStub> stub,
+    std::shared_ptr<BlockingExecutor> executor,
+    bigquery_unified::JobFilter const& filter,
+    std::vector<bigquery_unified::JobState> const& default_states,
+    Options current_options) {
+  google::cloud::bigquery::v2::ListJobsRequest request;
+  request.set_project_id(filter.project_id);
+  request.set_all_users(filter.all_users);
+  for (auto state : filter.states.empty() ? default_states : filter.states) {
+    request.add_state_filter(ToStateFilter(state));
+  }
+  current_options.set<bigquery_unified::ListJobsProjectionOption>(
+      filter.labels.empty() ? bigquery_unified::ListJobsProjection::kMinimal
+                            : bigquery_unified::ListJobsProjection::kFull);
+  current_options.unset<bigquery_unified::ListJobsStateFilterOption>();
+
+  std::vector<google::cloud::bigquery::v2::JobReference> jobs;
+  for (auto& job : PrefetchListJobs(
+           std::move(stub), std::move(executor), {std::move(request)},
+           std::make_shared<Options const>(std::move(current_options)))) {
+    if (!job) return std::move(job).status();
+    auto const& labels = job->configuration().labels();
+    auto const matches = std::all_of(
+        filter.labels.begin(), filter.labels.end(), [&labels](auto const& kv) {
+          auto l = labels.find(kv.first);
+          return l != labels.end() && l->second == kv.second;
+        });
+    if (matches) jobs.push_back(job->job_reference());
+  }
+  return jobs;
+}
+
+// Applies `operation` to each of `jobs`, running up to the size of `executor`
+// operations at a time. The operation receives the index of the job.
+std::vector<bigquery_unified::JobOperationResult> ForEachJob(
+    BlockingExecutor& executor,
+    std::vector<google::cloud::bigquery::v2::JobReference> jobs,
+    Options const& current_options,
+    std::function<Status(std::size_t,
+                         google::cloud::bigquery::v2::JobReference const&)>
+        operation) {
+  std::vector<bigquery_unified::JobOperationResult> results(jobs.size());
+  executor.RunConcurrently(jobs.size(), [&](std::size_t i) {
+    internal::OptionsSpan span(current_options);
+    results[i].job_reference = std::move(jobs[i]);
+    results[i].status = operation(i, results[i].job_reference);
+  });
+  return results;
+}
+
+}  // namespace
+
 StreamRange<google::cloud::bigquery::v2::ListFormatJob>
 ConnectionImpl::ListJobs(google::cloud::bigquery::v2::ListJobsRequest request,
                          Options opts) {
-  // TODO: Instead of creating an OptionsSpan, pass opts when job_connection_
-  // supports it.
-  internal::OptionsSpan span(internal::MergeOptions(
-      std::move(opts), internal::MergeOptions(options_, job_options_)));
-  return job_connection_->ListJobs(request);
+  internal::OptionsSpan span(prepared_job_options_.ForCall(std::move(opts)));
+  auto current_options = google::cloud::internal::SaveCurrentOptions();
+  std::vector<google::cloud::bigquery::v2::ListJobsRequest> requests;
+  requests.push_back(std::move(request));
+  return PrefetchListJobs(job_stub_, blocking_executor_, std::move(requests),
+                          std::move(current_options));
+}
+
+StreamRange<google::cloud::bigquery::v2::ListFormatJob>
+ConnectionImpl::ListJobsInProjects(
+    std::vector<google::cloud::bigquery::v2::ListJobsRequest> requests,
+    Options opts) {
+  internal::OptionsSpan span(prepared_job_options_.ForCall(std::move(opts)));
+  auto current_options = google::cloud::internal::SaveCurrentOptions();
+  return PrefetchListJobs(job_stub_, blocking_executor_, std::move(requests),
+                          std::move(current_options));
+}
+
+StatusOr<std::vector<bigquery_unified::JobOperationResult>>
+ConnectionImpl::CancelJobs(bigquery_unified::JobFilter const& filter,
+                           Options opts) {
+  internal::OptionsSpan span(prepared_job_options_.ForCall(std::move(opts)));
+  auto current_options = google::cloud::internal::SaveCurrentOptions();
+  auto jobs = ListFilteredJobs(
+      job_stub_, blocking_executor_, filter,
+      {bigquery_unified::JobState::kPending,
+       bigquery_unified::JobState::kRunning},
+      *current_options);
+  if (!jobs) return std::move(jobs).status();
+
+  // Unless requested, do not start a polling loop for each job.
+  auto const await =
+      current_options->get<bigquery_unified::CancelJobsAwaitOption>();
+  std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>> polls(
+      jobs->size());
+  auto results = ForEachJob(
+      *blocking_executor_, *std::move(jobs), *current_options,
+      [&](std::size_t i,
+          google::cloud::bigquery::v2::JobReference const& job) -> Status {
+        google::cloud::bigquery::v2::CancelJobRequest request;
+        request.set_project_id(job.project_id());
+        request.set_job_id(job.job_id());
+        request.set_location(job.location().value());
+        auto response =
+            CancelJobWithRetry(*job_stub_, request, *current_options);
+        if (!response) return std::move(response).status();
+        if (!await) return Status{};
+        polls[i] = JobPoll(response->job(), current_options, "CancelJob");
+        return Status{};
+      });
+  // The polling loops need the executor threads, possibly the ones running the
+  // cancels above. Wait for them on the calling thread instead.
+  for (std::size_t i = 0; i != polls.size(); ++i) {
+    if (polls[i].valid()) results[i].status = polls[i].get().status();
+  }
+  return results;
+}
+
+StatusOr<std::vector<bigquery_unified::JobOperationResult>>
+ConnectionImpl::DeleteJobs(bigquery_unified::JobFilter const& filter,
+                           Options opts) {
+  internal::OptionsSpan span(prepared_job_options_.ForCall(std::move(opts)));
+  auto current_options = google::cloud::internal::SaveCurrentOptions();
+  auto jobs = ListFilteredJobs(job_stub_, blocking_executor_, filter, {},
+                               *current_options);
+  if (!jobs) return std::move(jobs).status();
+
+  return ForEachJob(
+      *blocking_executor_, *std::move(jobs), *current_options,
+      [&](std::size_t, google::cloud::bigquery::v2::JobReference const& job) {
+        google::cloud::bigquery::v2::DeleteJobRequest request;
+        request.set_project_id(job.project_id());
+        request.set_job_id(job.job_id());
+        request.set_location(job.location().value());
+        return rest_internal::RestRetryLoop(
+            retry_policy(*current_options), backoff_policy(*current_options),
+            idempotency_policy(*current_options)
+                ->DeleteJob(request, *current_options),
+            [this](
+                rest_internal::RestContext& rest_context,
+                Options const& options,
+                google::cloud::bigquery::v2::DeleteJobRequest const& request) {
+              return job_stub_->DeleteJob(rest_context, options, request);
+            },
+            *current_options, request, __func__);
+      });
 }
 
 StatusOr<bigquery_unified::ReadArrowResponse> ConnectionImpl::ReadArrow(
@@ -322,46 +1054,186 @@ StatusOr<bigquery_unified::ReadArrowResponse> ConnectionImpl::ReadArrow(
     Options opts) {
   // TODO: Instead of creating an OptionsSpan, pass opts when job_connection_
   // supports it.
-  internal::OptionsSpan span(
-      internal::MergeOptions(std::move(opts), read_options_));
+  internal::OptionsSpan span(prepared_read_options_.ForCall(std::move(opts)));
   auto current_options = google::cloud::internal::SaveCurrentOptions();
 
-  auto session = read_connection_->CreateReadSession(read_session_request);
+  auto session = CreateReadSession(*read_connection_, *read_session_cache_,
+                                   read_session_request, *current_options);
   if (!session) return std::move(session).status();
+  return MakeReadArrowResponse(
+      read_connection_, *session, current_options, nullptr,
+      blocking_executor_.get(), MakeReadTracer(*current_options),
+      read_metrics_instruments_);
+}
 
-  bigquery_unified::ReadArrowResponse read_response;
-  auto arrow_schema = GetArrowSchema(session->arrow_schema());
-  if (!arrow_schema) return std::move(arrow_schema).status();
-  read_response.estimated_total_bytes_scanned =
-      session->estimated_total_bytes_scanned();
-  read_response.estimated_total_physical_file_size =
-      session->estimated_total_physical_file_size();
-  read_response.estimated_row_count = session->estimated_row_count();
-  read_response.expire_time = session->expire_time();
-  read_response.schema = arrow_schema->first;
+StatusOr<bigquery_unified::ReadArrowPartitionsResponse>
+ConnectionImpl::ReadArrowPartitions(
+    std::map<std::string,
+             google::cloud::bigquery::storage::v1::CreateReadSessionRequest>
+        partition_requests,
+    Options opts) {
+  internal::OptionsSpan span(prepared_read_options_.ForCall(std::move(opts)));
+  auto current_options = google::cloud::internal::SaveCurrentOptions();
 
-  for (auto const& s : session->streams()) {
-    // It's important to call ReadRows from read_connection_ in order to
-    // leverage the existing ResumableStreamingRead that it creates around
-    // the call to ReadRows in its stub.
-    auto factory = [connection = read_connection_,
-                    current_options](google::cloud::bigquery::storage::v1::
-                                         ReadRowsRequest const& r) mutable {
-      google::cloud::internal::OptionsSpan span(*current_options);
-      return std::make_shared<
-          StreamRange<google::cloud::bigquery::storage::v1::ReadRowsResponse>>(
-          connection->ReadRows(r));
-    };
+  // Each partition is an independent unit of work. Creating its session and
+  // opening its streams are blocking calls, so run them concurrently.
+  auto tracer = MakeReadTracer(*current_options);
+  std::vector<future<StatusOr<bigquery_unified::ReadArrowResponse>>> pending;
+  pending.reserve(partition_requests.size());
+  for (auto& kv : partition_requests) {
+    auto metadata = std::make_shared<arrow::KeyValueMetadata const>(
+        std::vector<std::string>{bigquery_unified::kPartitionIdMetadataKey},
+        std::vector<std::string>{kv.first});
+    pending.push_back(blocking_executor_->Run(
+        [connection = read_connection_, cache = read_session_cache_,
+         current_options, tracer, instruments = read_metrics_instruments_,
+         request = std::move(kv.second), metadata = std::move(metadata)]()
+            -> StatusOr<bigquery_unified::ReadArrowResponse> {
+          google::cloud::internal::OptionsSpan span(*current_options);
+          auto session = CreateReadSession(*connection, *cache, request,
+                                           *current_options);
+          if (!session) return std::move(session).status();
+          // Partitions without data have no streams, and their schema is of
+          // no interest.
+          if (session->streams().empty()) {
+            bigquery_unified::ReadArrowResponse empty;
+            empty.estimated_total_bytes_scanned = 0;
+            empty.estimated_total_physical_file_size = 0;
+            empty.estimated_row_count = 0;
+            empty.expire_time = session->expire_time();
+            return empty;
+          }
+          return MakeReadArrowResponse(connection, *session, current_options,
+                                       metadata, nullptr, tracer, instruments);
+        }));
+  }
 
-    auto arrow_stream_range = google::cloud::internal::MakeStreamRange<
-        std::shared_ptr<arrow::RecordBatch>>(
-        google::cloud::internal::MakeImmutableOptions(*current_options),
-        ArrowRecordBatchReader(s.name(), arrow_schema->first,
-                               arrow_schema->second, std::move(factory)));
-    read_response.readers.push_back(std::move(arrow_stream_range));
+  bigquery_unified::ReadArrowPartitionsResponse response;
+  response.estimated_total_bytes_scanned = 0;
+  response.estimated_row_count = 0;
+  // Wait for all the partitions, even after a failure, so no work is left
+  // running once this function returns.
+  std::vector<StatusOr<bigquery_unified::ReadArrowResponse>> results;
+  results.reserve(pending.size());
+  for (auto& f : pending) results.push_back(f.get());
+
+  auto partition = partition_requests.begin();
+  for (auto& result : results) {
+    auto const& partition_id = (partition++)->first;
+    if (!result) return std::move(result).status();
+    response.estimated_total_bytes_scanned +=
+        result->estimated_total_bytes_scanned;
+    response.estimated_row_count += result->estimated_row_count;
+    if (!response.schema) response.schema = result->schema;
+    if (&result == &results.front() ||
+        EarlierThan(result->expire_time, response.expire_time)) {
+      response.expire_time = result->expire_time;
+    }
+    for (auto& reader : result->readers) {
+      response.readers.push_back(bigquery_unified::PartitionReader{
+          partition_id, result->estimated_row_count, std::move(reader)});
+    }
   }
+  return response;
+}
 
-  return read_response;
+future<StatusOr<bigquery_unified::ReadArrowResponse>>
+ConnectionImpl::QueryArrow(google::cloud::bigquery::v2::Job const& job,
+                           Options opts) {
+  using ResponseType = StatusOr<bigquery_unified::ReadArrowResponse>;
+  if (!job.configuration().has_query()) {
+    return make_ready_future<ResponseType>(internal::InvalidArgumentError(
+        "QueryArrow() requires a query job", GCP_ERROR_INFO()));
+  }
+  auto read_options = prepared_read_options_.ForCall(opts);
+  // The streams are traced as children of the active span, which is lost once
+  // the job completes.
+  auto tracer = MakeReadTracer(*read_options);
+  // Prepare the read path while the first query runs. The channels stay
+  // connected, there is no need to do this again.
+  if (!read_warm_up_started_.exchange(true)) {
+    if (connect_read_channels_) {
+      blocking_executor_->Schedule(
+          [connect = connect_read_channels_] { (void)connect(); });
+    }
+  }
+
+  return InsertJob(job, std::move(opts))
+      .then([connection = read_connection_, cache = read_session_cache_,
+             executor = blocking_executor_, read_options, tracer,
+             instruments = read_metrics_instruments_](
+                future<StatusOr<google::cloud::bigquery::v2::Job>> f)
+                -> future<ResponseType> {
+        auto done = f.get();
+        if (!done) return make_ready_future<ResponseType>(done.status());
+        if (done->status().has_error_result()) {
+          auto const& error = done->status().error_result();
+          return make_ready_future<ResponseType>(internal::UnknownError(
+              absl::StrCat("Job ", done->job_reference().job_id(),
+                           " failed: ", error.message()),
+              GCP_ERROR_INFO().WithMetadata("reason", error.reason())));
+        }
+        auto billing_project =
+            read_options->has<bigquery_unified::BillingProjectOption>()
+                ? read_options->get<bigquery_unified::BillingProjectOption>()
+                : done->job_reference().project_id();
+        auto request = MakeReadSessionRequest(
+            done->configuration().query().destination_table(),
+            std::move(billing_project), *read_options,
+            EstimateJobResultRows(*done));
+        // Create the session, and start reading its streams, as soon as the
+        // job completes.
+        return executor->Run([connection, cache, executor, read_options,
+                              tracer, instruments,
+                              request = std::move(request)]() -> ResponseType {
+          internal::OptionsSpan span(*read_options);
+          auto session =
+              CreateReadSession(*connection, *cache, request, *read_options);
+          if (!session) return std::move(session).status();
+          return MakeReadArrowResponse(connection, *session, read_options,
+                                       nullptr, executor.get(), tracer,
+                                       instruments);
+        });
+      });
+}
+
+StatusOr<std::shared_ptr<arrow::Schema>> ConnectionImpl::GetArrowSchema(
+    google::cloud::bigquery::v2::GetTableRequest const& request,
+    Options opts) {
+  // TODO: Instead of creating an OptionsSpan, pass opts when table_connection_
+  // supports it.
+  internal::OptionsSpan span(prepared_table_options_.ForCall(std::move(opts)));
+  auto current_options = google::cloud::internal::SaveCurrentOptions();
+
+  std::vector<std::string> selected_fields;
+  for (auto field : absl::StrSplit(request.selected_fields(), ',',
+                                   absl::SkipWhitespace())) {
+    selected_fields.emplace_back(absl::StripAsciiWhitespace(field));
+  }
+
+  // The full schema is cached, so any selection of fields from the same table
+  // is served by a single GetTable call.
+  auto const ttl =
+      current_options->get<bigquery_unified::TableSchemaCacheTtlOption>();
+  auto const capacity =
+      current_options->get<bigquery_unified::TableSchemaCacheSizeOption>();
+  auto const use_cache = ttl.count() > 0 && capacity > 0;
+  auto const key = absl::StrCat(request.project_id(), ".",
+                                request.dataset_id(), ".", request.table_id());
+  auto schema = use_cache ? table_schema_cache_->Lookup(key) : absl::nullopt;
+  if (!schema) {
+    auto get_request = request;
+    get_request.clear_selected_fields();
+    get_request.set_view(google::cloud::bigquery::v2::GetTableRequest::BASIC);
+    auto table = table_connection_->GetTable(get_request);
+    if (!table) return std::move(table).status();
+    schema = table->schema();
+    if (use_cache) table_schema_cache_->Insert(key, *schema, ttl, capacity);
+  }
+
+  auto selected = SelectFields(*schema, selected_fields);
+  if (!selected) return std::move(selected).status();
+  return ToArrowSchema(*selected);
 }
 
 Options ApplyUnifiedPolicyOptionsToJobServicePolicyOptions(Options options) {
@@ -399,59 +1271,233 @@ Options ApplyUnifiedPolicyOptionsToJobServicePolicyOptions(Options options) {
   return options;
 }
 
+Options ApplyUnifiedRestOptions(Options options) {
+  if (options.has<bigquery_unified::RestConnectionPoolSizeOption>() &&
+      !options.has<rest_internal::ConnectionPoolSizeOption>()) {
+    options.set<rest_internal::ConnectionPoolSizeOption>(
+        options.get<bigquery_unified::RestConnectionPoolSizeOption>());
+  }
+  if (options.has<bigquery_unified::RestHttpVersionOption>() &&
+      !options.has<rest_internal::HttpVersionOption>()) {
+    options.set<rest_internal::HttpVersionOption>(
+        options.get<bigquery_unified::RestHttpVersionOption>());
+  }
+  return options;
+}
+
+Options ApplyUnifiedReadChannelOptions(Options options) {
+  auto const has_max_receive =
+      options.has<bigquery_unified::ReadMaxReceiveMessageSizeOption>();
+  auto const has_window =
+      options.has<bigquery_unified::ReadInitialWindowSizeOption>();
+  auto const has_bdp_probe =
+      options.has<bigquery_unified::ReadBdpProbeOption>();
+  if (!has_max_receive && !has_window && !has_bdp_probe) return options;
+
+  auto& args = options.lookup<GrpcChannelArgumentsNativeOption>();
+  if (has_max_receive) {
+    args.SetMaxReceiveMessageSize(
+        options.get<bigquery_unified::ReadMaxReceiveMessageSizeOption>());
+  }
+  if (has_window) {
+    args.SetInt(GRPC_ARG_HTTP2_STREAM_LOOKAHEAD_BYTES,
+                options.get<bigquery_unified::ReadInitialWindowSizeOption>());
+  }
+  if (has_bdp_probe) {
+    args.SetInt(GRPC_ARG_HTTP2_BDP_PROBE,
+                options.get<bigquery_unified::ReadBdpProbeOption>() ? 1 : 0);
+  }
+  return options;
+}
+
+namespace {
+
+// The read channels are connected by the warm-up before the first read.
+auto constexpr kReadChannelsConnectTimeout = std::chrono::seconds(30);
+
+// Creates the channels of the Storage Read API, one channel per stub of the
+// pool if `ReadChannelPoolSizeOption` is set.
+ReadChannels::Channels CreateReadChannels(CompletionQueue cq,
+                                          Options const& read_options) {
+  ReadChannels::Channels result;
+  result.auth = google::cloud::internal::CreateAuthenticationStrategy(
+      std::move(cq), read_options);
+  auto const pool_size =
+      read_options.get<bigquery_unified::ReadChannelPoolSizeOption>();
+  if (pool_size == 0) {
+    result.channels.push_back(result.auth->CreateChannel(
+        read_options.get<EndpointOption>(),
+        google::cloud::internal::MakeChannelArguments(read_options)));
+    return result;
+  }
+  result.channels.reserve(pool_size);
+  for (std::size_t i = 0; i != pool_size; ++i) {
+    // gRPC shares the connections of channels with identical arguments, a
+    // distinct argument gives each channel its own connection.
+    auto channel_options = read_options;
+    channel_options.lookup<GrpcChannelArgumentsOption>().emplace(
+        "bigquery_unified.read_channel", std::to_string(i));
+    result.channels.push_back(result.auth->CreateChannel(
+        read_options.get<EndpointOption>(),
+        google::cloud::internal::MakeChannelArguments(channel_options)));
+  }
+  return result;
+}
+
+// Creates a Storage Read API stub on an existing channel, with the same
+// decorators as `CreateDefaultBigQueryReadStub()`.
+std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub>
+CreateReadChannelStub(
+    std::shared_ptr<google::cloud::internal::GrpcAuthenticationStrategy> auth,
+    std::shared_ptr<grpc::Channel> channel, Options const& read_options) {
+  std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub> stub =
+      std::make_shared<bigquery_storage_v1_internal::DefaultBigQueryReadStub>(
+          google::cloud::bigquery::storage::v1::BigQueryRead::NewStub(
+              std::move(channel)));
+  if (auth->RequiresConfigureContext()) {
+    stub = std::make_shared<bigquery_storage_v1_internal::BigQueryReadAuth>(
+        std::move(auth), std::move(stub));
+  }
+  stub = std::make_shared<bigquery_storage_v1_internal::BigQueryReadMetadata>(
+      std::move(stub), std::multimap<std::string, std::string>{});
+  if (google::cloud::internal::Contains(
+          read_options.get<LoggingComponentsOption>(), "rpc")) {
+    stub = std::make_shared<bigquery_storage_v1_internal::BigQueryReadLogging>(
+        std::move(stub), read_options.get<GrpcTracingOptionsOption>(),
+        read_options.get<LoggingComponentsOption>());
+  }
+  if (google::cloud::internal::TracingEnabled(read_options)) {
+    stub = bigquery_storage_v1_internal::MakeBigQueryReadTracingStub(
+        std::move(stub));
+  }
+  return stub;
+}
+
+// Creates the Storage Read API stub on @p channels, with a pool of stubs if
+// there is more than one channel or `ReadChannelStatsOption` is set, and a
+// watchdog for stalled streams if `ReadRowsIdleTimeoutOption` is set. The
+// outermost stub reports each `ReadRows` attempt to the statistics of its
+// read.
+std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub> CreateReadStub(
+    ReadChannels::Channels const& channels, CompletionQueue cq,
+    Options const& read_options) {
+  std::vector<std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub>>
+      children;
+  children.reserve(channels.channels.size());
+  for (auto const& channel : channels.channels) {
+    children.push_back(
+        CreateReadChannelStub(channels.auth, channel, read_options));
+  }
+  auto const& stats =
+      read_options.get<bigquery_unified::ReadChannelStatsOption>();
+  std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub> stub;
+  if (children.size() == 1 && !stats) {
+    stub = std::move(children.front());
+  } else {
+    auto pool = std::make_shared<ReadChannelPool>(std::move(children));
+    if (stats) AttachReadChannelPool(*stats, pool);
+    stub = std::move(pool);
+  }
+  auto const idle_timeout =
+      read_options.get<bigquery_unified::ReadRowsIdleTimeoutOption>();
+  if (idle_timeout.count() > 0) {
+    stub = std::make_shared<ReadRowsWatchdogStub>(std::move(stub),
+                                                  std::move(cq), idle_timeout);
+  }
+  return std::make_shared<ReadMetricsStub>(std::move(stub));
+}
+
+}  // namespace
+
 std::shared_ptr<bigquery_unified::Connection> MakeDefaultConnectionImpl(
     Options options) {
   internal::CheckExpectedOptions<
       CommonOptionList, GrpcOptionList, google::cloud::RestOptionList,
       UnifiedCredentialsOptionList,
+      google::cloud::bigquery_unified::BigQueryConnectionOptionList,
       google::cloud::bigquery_unified::BigQueryJobOptionList,
       google::cloud::bigquery_unified::BigQueryReadOptionList,
       google::cloud::bigquerycontrol_v2::JobServicePolicyOptionList,
+      google::cloud::bigquerycontrol_v2::TableServicePolicyOptionList,
       google::cloud::bigquery_storage_v1::BigQueryReadPolicyOptionList>(
       options, __func__);
 
-  auto background = std::make_unique<
-      rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
-
   options =
       ApplyUnifiedPolicyOptionsToJobServicePolicyOptions(std::move(options));
+  options = ApplyUnifiedRestOptions(std::move(options));
 
-  auto read_options =
-      bigquery_storage_v1_internal::BigQueryReadDefaultOptions(options);
-  auto read_background =
-      google::cloud::internal::MakeBackgroundThreadsFactory(read_options)();
-  auto read_auth = google::cloud::internal::CreateAuthenticationStrategy(
-      read_background->cq(), read_options);
-  auto read_stub = google::cloud::bigquery_storage_v1_internal::
-      CreateDefaultBigQueryReadStub(std::move(read_auth), read_options);
-  auto read_connection =
-      bigquery_storage_v1_internal::MakeBigQueryReadTracingConnection(
-          std::make_shared<
-              bigquery_storage_v1_internal::BigQueryReadConnectionImpl>(
-              std::move(read_background), std::move(read_stub), read_options));
+  auto read_options = ApplyUnifiedReadChannelOptions(
+      bigquery_storage_v1_internal::BigQueryReadDefaultOptions(options));
+  // All the connections share one set of background threads, started by the
+  // first operation that needs them. The Storage Read API needs a completion
+  // queue that supports gRPC, which serves the REST connections too.
+  auto background = std::make_shared<SharedBackgroundThreads>(
+      google::cloud::internal::MakeBackgroundThreadsFactory(read_options));
+
+  // Each subsystem is built on its first call, so applications that only use
+  // one of them do not pay for the others.
+  // The read channels are shared by the read connection and the warm-up,
+  // which connects them without creating the connection.
+  auto read_channels =
+      std::make_shared<ReadChannels>([background, read_options] {
+        return CreateReadChannels(background->cq(), read_options);
+      });
+  auto read_connection = std::make_shared<LazyBigQueryReadConnection>(
+      read_options, [background, read_channels, read_options] {
+        auto read_stub = CreateReadStub(read_channels->Get(), background->cq(),
+                                        read_options);
+        return bigquery_storage_v1_internal::MakeBigQueryReadTracingConnection(
+            std::make_shared<
+                bigquery_storage_v1_internal::BigQueryReadConnectionImpl>(
+                background->Share(), std::move(read_stub), read_options));
+      });
 
   auto job_options =
       bigquerycontrol_v2_internal::JobServiceDefaultOptions(options);
-  // TODO: JobServiceRestConnectionImpl requires background threads, but does it
-  // actually use them? Needs further investigation.
-  auto job_background = std::make_unique<
-      rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
-  auto job_stub =
+  // Creating the REST stub opens no connections, `ConnectionImpl` uses it
+  // directly to poll jobs.
+  std::shared_ptr<bigquerycontrol_v2_internal::JobServiceRestStub> job_stub =
       bigquerycontrol_v2_internal::CreateDefaultJobServiceRestStub(job_options);
-  std::shared_ptr<bigquerycontrol_v2::JobServiceConnection> job_connection =
-      bigquerycontrol_v2_internal::MakeJobServiceTracingConnection(
-          std::make_shared<
-              bigquerycontrol_v2_internal::JobServiceRestConnectionImpl>(
-              std::move(job_background), job_stub, job_options));
+  if (auto stats = options.get<bigquery_unified::RestConnectionStatsOption>()) {
+    job_stub = std::make_shared<JobServiceRestStatsStub>(std::move(job_stub),
+                                                         std::move(stats));
+  }
+  auto job_connection = std::make_shared<LazyJobServiceConnection>(
+      job_options, [background, job_stub, job_options] {
+        return bigquerycontrol_v2_internal::MakeJobServiceTracingConnection(
+            std::make_shared<
+                bigquerycontrol_v2_internal::JobServiceRestConnectionImpl>(
+                background->Share(), job_stub, job_options));
+      });
+
+  auto table_options =
+      bigquerycontrol_v2_internal::TableServiceDefaultOptions(options);
+  auto table_connection = std::make_shared<LazyTableServiceConnection>(
+      table_options, [background, table_options] {
+        auto table_stub =
+            bigquerycontrol_v2_internal::CreateDefaultTableServiceRestStub(
+                table_options);
+        return bigquerycontrol_v2_internal::MakeTableServiceTracingConnection(
+            std::make_shared<
+                bigquerycontrol_v2_internal::TableServiceRestConnectionImpl>(
+                background->Share(), std::move(table_stub), table_options));
+      });
 
-  // TODO: We should probably add a TracingConnection decorator in order to
-  //  associate all the various rpcs that are called as part of these
-  //  operations.
-  return MakeTracingConnection(
+  auto const warm_up =
+      options.get<google::cloud::bigquery_unified::WarmUpOnCreateOption>();
+  auto connection = MakeTracingConnection(MakeQueryCacheConnection(
       std::make_shared<bigquery_unified_internal::ConnectionImpl>(
           std::move(read_connection), std::move(job_connection),
-          std::move(read_options), std::move(job_options), std::move(job_stub),
-          std::move(background), std::move(options)));
+          std::move(table_connection), std::move(read_options),
+          std::move(job_options), std::move(table_options),
+          std::move(job_stub), background->Share(), std::move(options),
+          [read_channels] {
+            return read_channels->Connect(std::chrono::system_clock::now() +
+                                          kReadChannelsConnectTimeout);
+          })));
+  // The warm-up runs in the background, it keeps what it uses alive.
+  if (warm_up) (void)connection->WarmUp({});
+  return connection;
 }
 
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
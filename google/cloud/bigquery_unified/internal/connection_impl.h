@@ -17,10 +17,20 @@
 
 #include "google/cloud/bigquery/storage/v1/bigquery_read_connection.h"
 #include "google/cloud/bigquery_unified/connection.h"
+#include "google/cloud/bigquery_unified/internal/blocking_executor.h"
+#include "google/cloud/bigquery_unified/internal/job_watcher.h"
+#include "google/cloud/bigquery_unified/internal/prepared_options.h"
+#include "google/cloud/bigquery_unified/internal/read_metrics.h"
+#include "google/cloud/bigquery_unified/internal/read_session_cache.h"
+#include "google/cloud/bigquery_unified/internal/table_schema_cache.h"
+#include "google/cloud/bigquery_unified/internal/timer_wheel.h"
 #include "google/cloud/bigquery_unified/version.h"
 #include "google/cloud/bigquerycontrol/v2/internal/job_rest_stub.h"
 #include "google/cloud/bigquerycontrol/v2/job_connection.h"
+#include "google/cloud/bigquerycontrol/v2/table_connection.h"
 #include "google/cloud/background_threads.h"
+#include <atomic>
+#include <functional>
 
 namespace google::cloud::bigquery_unified_internal {
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
@@ -33,15 +43,21 @@ class ConnectionImpl : public bigquery_unified::Connection {
           read_connection,
       std::shared_ptr<google::cloud::bigquerycontrol_v2::JobServiceConnection>
           job_connection,
+      std::shared_ptr<google::cloud::bigquerycontrol_v2::TableServiceConnection>
+          table_connection,
       google::cloud::Options read_options, google::cloud::Options job_options,
+      google::cloud::Options table_options,
       std::shared_ptr<bigquerycontrol_v2_internal::JobServiceRestStub> job_stub,
       std::unique_ptr<google::cloud::BackgroundThreads> background,
-      google::cloud::Options options);
+      google::cloud::Options options,
+      std::function<Status()> connect_read_channels = {});
 
   ~ConnectionImpl() override = default;
 
   Options options() override { return options_; }
 
+  future<Status> WarmUp(Options opts) override;
+
   future<StatusOr<google::cloud::bigquery::v2::Job>> CancelJob(
       google::cloud::bigquery::v2::CancelJobRequest const& request,
       Options opts) override;
@@ -70,18 +86,45 @@ class ConnectionImpl : public bigquery_unified::Connection {
       google::cloud::bigquery::v2::JobReference const& job_reference,
       Options opts) override;
 
+  std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>> InsertJobs(
+      std::vector<google::cloud::bigquery::v2::Job> jobs,
+      Options opts) override;
+
   Status DeleteJob(google::cloud::bigquery::v2::DeleteJobRequest const& request,
                    Options opts) override;
 
+  StatusOr<std::vector<bigquery_unified::JobOperationResult>> CancelJobs(
+      bigquery_unified::JobFilter const& filter, Options opts) override;
+
+  StatusOr<std::vector<bigquery_unified::JobOperationResult>> DeleteJobs(
+      bigquery_unified::JobFilter const& filter, Options opts) override;
+
   StreamRange<google::cloud::bigquery::v2::ListFormatJob> ListJobs(
       google::cloud::bigquery::v2::ListJobsRequest request,
       Options opts) override;
 
+  StreamRange<google::cloud::bigquery::v2::ListFormatJob> ListJobsInProjects(
+      std::vector<google::cloud::bigquery::v2::ListJobsRequest> requests,
+      Options opts) override;
+
   StatusOr<bigquery_unified::ReadArrowResponse> ReadArrow(
       google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
           read_session,
       Options opts) override;
 
+  StatusOr<bigquery_unified::ReadArrowPartitionsResponse> ReadArrowPartitions(
+      std::map<std::string,
+               google::cloud::bigquery::storage::v1::CreateReadSessionRequest>
+          partition_requests,
+      Options opts) override;
+
+  future<StatusOr<bigquery_unified::ReadArrowResponse>> QueryArrow(
+      google::cloud::bigquery::v2::Job const& job, Options opts) override;
+
+  StatusOr<std::shared_ptr<arrow::Schema>> GetArrowSchema(
+      google::cloud::bigquery::v2::GetTableRequest const& request,
+      Options opts) override;
+
  private:
   future<StatusOr<google::cloud::bigquery::v2::Job>> JobPoll(
       google::cloud::bigquery::v2::Job const& operation,
@@ -90,11 +133,52 @@ class ConnectionImpl : public bigquery_unified::Connection {
 
   std::shared_ptr<bigquery_storage_v1::BigQueryReadConnection> read_connection_;
   std::shared_ptr<bigquerycontrol_v2::JobServiceConnection> job_connection_;
+  std::shared_ptr<bigquerycontrol_v2::TableServiceConnection>
+      table_connection_;
   std::shared_ptr<bigquerycontrol_v2_internal::JobServiceRestStub> job_stub_;
   Options read_options_;
   Options job_options_;
+  Options table_options_;
   std::unique_ptr<google::cloud::BackgroundThreads> background_;
   Options options_;
+  // The options of each service, merged once. Calls without options of their
+  // own use these as is.
+  PreparedOptions prepared_job_options_;
+  PreparedOptions prepared_read_options_;
+  PreparedOptions prepared_table_options_;
+  // Runs the blocking RPCs of operations that fan out, such as creating the
+  // read sessions for several partitions.
+  std::shared_ptr<BlockingExecutor> blocking_executor_;
+  // Only used if `bigquery_unified::ReadSessionCacheSizeOption` is set.
+  std::shared_ptr<ReadSessionCache> read_session_cache_;
+  // Only used if `bigquery_unified::TableSchemaCacheTtlOption` and
+  // `bigquery_unified::TableSchemaCacheSizeOption` are not zero.
+  std::shared_ptr<TableSchemaCache> table_schema_cache_;
+  // The instruments of the read metrics, created with the connection. Null
+  // unless `bigquery_unified::EnableReadMetricsOption` is set.
+  std::shared_ptr<ReadMetricsInstruments> read_metrics_instruments_;
+  // Only used with `bigquery_unified::JobCompletionStrategy::kWatch`.
+  std::shared_ptr<JobWatcher> job_watcher_;
+  // Drives the waits of all the job polling loops.
+  std::shared_ptr<TimerWheel> polling_timers_;
+  // Runs the blocking RPCs of the job polling loops, so they do not block the
+  // completion queue threads or queue behind other blocking work. With
+  // `bigquery_unified::BlockingThreadPoolOption` this is the shared pool, the
+  // same as `blocking_executor_`.
+  std::shared_ptr<BlockingExecutor> poll_executor_;
+  // Runs the long polls of `JobCompletionStrategy::kLongPoll`. With
+  // `bigquery_unified::BlockingThreadPoolOption` this is the shared pool.
+  std::shared_ptr<BlockingExecutor> long_poll_executor_;
+  // The long polls only start if fewer threads of `long_poll_executor_` are
+  // busy, the other polls use `jobs.get`.
+  std::size_t long_poll_limit_;
+  // Connects the channels of `read_connection_` and fetches their access
+  // token. Not set if the channels are not known, then the read connection is
+  // not warmed up.
+  std::function<Status()> connect_read_channels_;
+  // Set once the read connection is warmed up by `WarmUp()` or the first
+  // `QueryArrow()`.
+  std::atomic<bool> read_warm_up_started_{false};
 };
 
 // Checks if `options` contains bigquerycontrol_v2 Policy Options. If not sets
@@ -104,6 +188,14 @@ class ConnectionImpl : public bigquery_unified::Connection {
 //   - JobServiceRetryPolicyOption
 Options ApplyUnifiedPolicyOptionsToJobServicePolicyOptions(Options options);
 
+// Sets the options of the REST transport from the corresponding
+// bigquery_unified options, unless they are already set.
+Options ApplyUnifiedRestOptions(Options options);
+
+// Adds the gRPC channel arguments for the bigquery_unified options that tune
+// the Storage Read API channels to `GrpcChannelArgumentsNativeOption`.
+Options ApplyUnifiedReadChannelOptions(Options options);
+
 // Interrogates the required fields in the JobConfiguration in the supplied Job,
 // to determine the billing project.
 std::string DetermineBillingProject(
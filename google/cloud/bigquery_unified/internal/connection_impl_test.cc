@@ -13,22 +13,53 @@
 // limitations under the License.
 
 #include "google/cloud/bigquery_unified/internal/connection_impl.h"
+#include "google/cloud/bigquery_unified/blocking_thread_pool.h"
+#include "google/cloud/bigquery_unified/connection_options.h"
 #include "google/cloud/bigquery_unified/internal/default_options.h"
 #include "google/cloud/bigquery_unified/job_options.h"
+#include "google/cloud/bigquery_unified/read_options.h"
+#include "google/cloud/bigquery_unified/testing_util/opentelemetry_matchers.h"
 #include "google/cloud/bigquery_unified/testing_util/status_matchers.h"
 #include "google/cloud/bigquerycontrol/v2/job_connection.h"
 #include "google/cloud/bigquerycontrol/v2/job_options.h"
+#include "google/cloud/bigquerycontrol/v2/table_connection.h"
+#include "google/cloud/grpc_options.h"
+#include "google/cloud/internal/curl_options.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/internal/opentelemetry.h"
 #include "google/cloud/internal/rest_background_threads_impl.h"
+#include "google/cloud/internal/rest_response.h"
+#include <arrow/api.h>
+#include <arrow/ipc/api.h>
 #include <gmock/gmock.h>
+#include <grpc/grpc.h>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <thread>
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+#include <opentelemetry/context/runtime_context.h>
+#include <opentelemetry/trace/context.h>
+#include <opentelemetry/trace/scope.h>
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
 
 namespace google::cloud::bigquery_unified_internal {
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
 namespace {
 
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+using ::google::cloud::bigquery_unified::testing_util::InstallSpanCatcher;
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
 using ::google::cloud::bigquery_unified::testing_util::IsOk;
 using ::google::cloud::bigquery_unified::testing_util::StatusIs;
+using ::testing::ElementsAre;
 using ::testing::Eq;
+using ::testing::Field;
+using ::testing::NotNull;
 using ::testing::Return;
+using ::testing::SizeIs;
+using ::testing::StartsWith;
 
 class MockBackoffPolicy : public google::cloud::BackoffPolicy {
  public:
@@ -174,6 +205,56 @@ TEST(ApplyUnifiedPolicyOptionsToJobServicePolicyOptions,
               Eq(8675309));
 }
 
+TEST(ApplyUnifiedRestOptions, SetsTransportOptions) {
+  auto result = ApplyUnifiedRestOptions(
+      Options{}
+          .set<bigquery_unified::RestConnectionPoolSizeOption>(16)
+          .set<bigquery_unified::RestHttpVersionOption>("2TLS"));
+  EXPECT_EQ(result.get<rest_internal::ConnectionPoolSizeOption>(), 16U);
+  EXPECT_EQ(result.get<rest_internal::HttpVersionOption>(), "2TLS");
+
+  EXPECT_FALSE(ApplyUnifiedRestOptions(Options{})
+                   .has<rest_internal::ConnectionPoolSizeOption>());
+}
+
+TEST(ApplyUnifiedRestOptions, TransportOptionsSpecified) {
+  auto result = ApplyUnifiedRestOptions(
+      Options{}
+          .set<bigquery_unified::RestConnectionPoolSizeOption>(16)
+          .set<rest_internal::ConnectionPoolSizeOption>(4));
+  EXPECT_EQ(result.get<rest_internal::ConnectionPoolSizeOption>(), 4U);
+}
+
+// Returns the value of the integer channel argument @p key, if set.
+absl::optional<int> GetIntArg(grpc::ChannelArguments const& args,
+                              std::string const& key) {
+  auto const c_args = args.c_channel_args();
+  for (std::size_t i = 0; i != c_args.num_args; ++i) {
+    auto const& arg = c_args.args[i];
+    if (key == arg.key && arg.type == GRPC_ARG_INTEGER) {
+      return arg.value.integer;
+    }
+  }
+  return absl::nullopt;
+}
+
+TEST(ApplyUnifiedReadChannelOptions, SetsChannelArguments) {
+  auto result = ApplyUnifiedReadChannelOptions(
+      Options{}
+          .set<bigquery_unified::ReadMaxReceiveMessageSizeOption>(-1)
+          .set<bigquery_unified::ReadInitialWindowSizeOption>(8 << 20)
+          .set<bigquery_unified::ReadBdpProbeOption>(false));
+  auto const& args = result.get<GrpcChannelArgumentsNativeOption>();
+  EXPECT_EQ(GetIntArg(args, GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH), -1);
+  EXPECT_EQ(GetIntArg(args, GRPC_ARG_HTTP2_STREAM_LOOKAHEAD_BYTES), 8 << 20);
+  EXPECT_EQ(GetIntArg(args, GRPC_ARG_HTTP2_BDP_PROBE), 0);
+}
+
+TEST(ApplyUnifiedReadChannelOptions, Unset) {
+  auto result = ApplyUnifiedReadChannelOptions(Options{});
+  EXPECT_FALSE(result.has<GrpcChannelArgumentsNativeOption>());
+}
+
 TEST(DetermineBillingProject, UseCorrectFieldDependingOnJobType) {
   google::cloud::bigquery::v2::Job job;
 
@@ -283,6 +364,15 @@ class MockJobServiceConnection
               (override));
 };
 
+class MockTableServiceConnection
+    : public bigquerycontrol_v2::TableServiceConnection {
+ public:
+  MOCK_METHOD(Options, options, (), (override));
+  MOCK_METHOD(StatusOr<google::cloud::bigquery::v2::Table>, GetTable,
+              (google::cloud::bigquery::v2::GetTableRequest const& request),
+              (override));
+};
+
 class MockBigQueryReadConnection
     : public bigquery_storage_v1::BigQueryReadConnection {
  public:
@@ -319,6 +409,7 @@ class ConnectionImplTest : public ::testing::Test {
   void SetUp() override {
     mock_read_connection_ = std::make_shared<MockBigQueryReadConnection>();
     mock_job_connection_ = std::make_shared<MockJobServiceConnection>();
+    mock_table_connection_ = std::make_shared<MockTableServiceConnection>();
     mock_job_stub_ = std::make_shared<MockJobServiceRestStub>();
     mock_background_ = std::make_unique<MockBackgroundThreads>();
   }
@@ -342,29 +433,107 @@ class ConnectionImplTest : public ::testing::Test {
 
   std::shared_ptr<MockBigQueryReadConnection> mock_read_connection_;
   std::shared_ptr<MockJobServiceConnection> mock_job_connection_;
+  std::shared_ptr<MockTableServiceConnection> mock_table_connection_;
   std::shared_ptr<MockJobServiceRestStub> mock_job_stub_;
   std::unique_ptr<MockBackgroundThreads> mock_background_;
 };
 
+TEST_F(ConnectionImplTest, WarmUp) {
+  EXPECT_CALL(*mock_read_connection_, SplitReadStream).Times(0);
+  EXPECT_CALL(*mock_job_stub_, ListJobs)
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   google::cloud::bigquery::v2::ListJobsRequest const&
+                       request) {
+        EXPECT_THAT(request.project_id(), Eq("billing-project"));
+        EXPECT_THAT(request.max_results().value(), Eq(1U));
+        EXPECT_THAT(
+            request.projection(),
+            Eq(google::cloud::bigquery::v2::ListJobsRequest::MINIMAL));
+        return google::cloud::bigquery::v2::JobList{};
+      });
+
+  int connect_calls = 0;
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_),
+      DefaultOptions(Options{}.set<bigquery_unified::BillingProjectOption>(
+          "billing-project")),
+      [&connect_calls] {
+        ++connect_calls;
+        return Status{};
+      });
+  EXPECT_THAT(connection_impl.WarmUp({}).get(), IsOk());
+  EXPECT_EQ(connect_calls, 1);
+}
+
+TEST_F(ConnectionImplTest, WarmUpPermissionDenied) {
+  // Listing jobs may require more permissions than running them, the
+  // credentials were still accepted.
+  EXPECT_CALL(*mock_job_stub_, ListJobs)
+      .WillOnce(Return(internal::PermissionDeniedError("cannot list jobs")));
+
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_),
+      DefaultOptions(Options{}.set<bigquery_unified::BillingProjectOption>(
+          "billing-project")));
+  EXPECT_THAT(connection_impl.WarmUp({}).get(), IsOk());
+}
+
+TEST_F(ConnectionImplTest, WarmUpWithoutBillingProject) {
+  EXPECT_CALL(*mock_job_stub_, ListJobs).Times(0);
+  EXPECT_CALL(*mock_job_stub_, GetJob).Times(0);
+
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_), DefaultOptions({}));
+  EXPECT_THAT(connection_impl.WarmUp({}).get(), IsOk());
+}
+
+TEST_F(ConnectionImplTest, WarmUpJobError) {
+  EXPECT_CALL(*mock_job_stub_, ListJobs)
+      .WillOnce(Return(internal::UnauthenticatedError("bad token")));
+
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_),
+      DefaultOptions(Options{}.set<bigquery_unified::BillingProjectOption>(
+          "billing-project")),
+      [] { return Status{}; });
+  EXPECT_THAT(connection_impl.WarmUp({}).get(),
+              StatusIs(StatusCode::kUnauthenticated));
+}
+
+TEST_F(ConnectionImplTest, WarmUpReadError) {
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_), DefaultOptions({}),
+      [] { return internal::UnavailableError("cannot connect"); });
+  EXPECT_THAT(connection_impl.WarmUp({}).get(),
+              StatusIs(StatusCode::kUnavailable));
+}
+
 TEST_F(ConnectionImplTest, InsertJobNoAwait) {
   std::string const project_id = "my-project";
   std::string const job_id = "my_job";
 
-  EXPECT_CALL(*mock_job_connection_, InsertJob)
-      .WillOnce(
-          [&](google::cloud::bigquery::v2::InsertJobRequest const& request) {
-            EXPECT_THAT(request.job().job_reference().project_id(),
-                        Eq(project_id));
-            EXPECT_THAT(request.job().job_reference().job_id(), Eq(job_id));
-            google::cloud::bigquery::v2::Job job;
-            job.mutable_job_reference()->set_project_id(project_id);
-            job.mutable_job_reference()->set_job_id(job_id);
-            return job;
-          });
+  EXPECT_CALL(*mock_job_stub_, InsertJob)
+      .WillOnce([&](rest_internal::RestContext&, Options const&,
+                    google::cloud::bigquery::v2::InsertJobRequest const&
+                        request) {
+        EXPECT_THAT(request.job().job_reference().project_id(),
+                    Eq(project_id));
+        EXPECT_THAT(request.job().job_reference().job_id(), Eq(job_id));
+        google::cloud::bigquery::v2::Job job;
+        job.mutable_job_reference()->set_project_id(project_id);
+        job.mutable_job_reference()->set_job_id(job_id);
+        return job;
+      });
 
   auto connection_impl =
-      ConnectionImpl(mock_read_connection_, mock_job_connection_, {}, {},
-                     mock_job_stub_, std::move(mock_background_), {});
+      ConnectionImpl(mock_read_connection_, mock_job_connection_,
+                     mock_table_connection_, {}, {}, {}, mock_job_stub_,
+                     std::move(mock_background_), DefaultOptions({}));
 
   google::cloud::bigquery::v2::Job job;
   job.mutable_job_reference()->set_project_id(project_id);
@@ -375,6 +544,143 @@ TEST_F(ConnectionImplTest, InsertJobNoAwait) {
   EXPECT_THAT(result->job_id(), Eq(job_id));
 }
 
+TEST_F(ConnectionImplTest, InsertJobNoAwaitGeneratesJobId) {
+  std::string job_id;
+  EXPECT_CALL(*mock_job_stub_, InsertJob)
+      .WillOnce([&](rest_internal::RestContext&, Options const&,
+                    google::cloud::bigquery::v2::InsertJobRequest const&
+                        request) {
+        job_id = request.job().job_reference().job_id();
+        return request.job();
+      });
+
+  auto connection_impl =
+      ConnectionImpl(mock_read_connection_, mock_job_connection_,
+                     mock_table_connection_, {}, {}, {}, mock_job_stub_,
+                     std::move(mock_background_), DefaultOptions({}));
+
+  google::cloud::bigquery::v2::Job job;
+  job.mutable_job_reference()->set_project_id("my-project");
+  auto result = connection_impl.InsertJob(NoAwaitTag{}, job, {});
+  ASSERT_STATUS_OK(result);
+  EXPECT_THAT(job_id, StartsWith("job_"));
+  EXPECT_THAT(result->job_id(), Eq(job_id));
+}
+
+TEST_F(ConnectionImplTest, InsertJobNoAwaitRetryAlreadyExists) {
+  std::string const project_id = "my-project";
+  std::string const job_id = "my_job";
+
+  EXPECT_CALL(*mock_job_stub_, InsertJob)
+      .WillOnce(Return(internal::UnavailableError("try-again")))
+      .WillOnce(Return(internal::AlreadyExistsError("duplicate")));
+  EXPECT_CALL(*mock_job_stub_, GetJob)
+      .WillOnce([&](rest_internal::RestContext&, Options const&,
+                    google::cloud::bigquery::v2::GetJobRequest const&
+                        request) {
+        EXPECT_THAT(request.project_id(), Eq(project_id));
+        EXPECT_THAT(request.job_id(), Eq(job_id));
+        EXPECT_THAT(request.location(), Eq("us-east1"));
+        google::cloud::bigquery::v2::Job job;
+        job.mutable_job_reference()->set_project_id(project_id);
+        job.mutable_job_reference()->set_job_id(job_id);
+        return job;
+      });
+
+  auto connection_impl =
+      ConnectionImpl(mock_read_connection_, mock_job_connection_,
+                     mock_table_connection_, {}, {}, {}, mock_job_stub_,
+                     std::move(mock_background_), DefaultOptions({}));
+
+  google::cloud::bigquery::v2::Job job;
+  job.mutable_job_reference()->set_project_id(project_id);
+  job.mutable_job_reference()->set_job_id(job_id);
+  job.mutable_job_reference()->mutable_location()->set_value("us-east1");
+  auto result = connection_impl.InsertJob(NoAwaitTag{}, job, {});
+  ASSERT_STATUS_OK(result);
+  EXPECT_THAT(result->job_id(), Eq(job_id));
+}
+
+TEST_F(ConnectionImplTest, InsertJobNoAwaitRetryConflict) {
+  // The error returned by the service for a duplicate job, as mapped by the
+  // REST transport.
+  auto const conflict = rest_internal::AsStatus(
+      rest_internal::HttpStatusCode::kConflict, R"js({
+        "error": {
+          "code": 409,
+          "message": "Already Exists: Job my-project:us-east1.my_job",
+          "errors": [{
+            "message": "Already Exists: Job my-project:us-east1.my_job",
+            "domain": "global",
+            "reason": "duplicate"
+          }],
+          "status": "ALREADY_EXISTS"
+        }
+      })js");
+  ASSERT_THAT(conflict, StatusIs(StatusCode::kAborted));
+
+  EXPECT_CALL(*mock_job_stub_, InsertJob)
+      .WillOnce(Return(internal::UnavailableError("try-again")))
+      .WillOnce(Return(conflict));
+  EXPECT_CALL(*mock_job_stub_, GetJob)
+      .WillOnce([&](rest_internal::RestContext&, Options const&,
+                    google::cloud::bigquery::v2::GetJobRequest const&
+                        request) {
+        EXPECT_THAT(request.job_id(), Eq("my_job"));
+        google::cloud::bigquery::v2::Job job;
+        job.mutable_job_reference()->set_project_id("my-project");
+        job.mutable_job_reference()->set_job_id("my_job");
+        return job;
+      });
+
+  auto connection_impl =
+      ConnectionImpl(mock_read_connection_, mock_job_connection_,
+                     mock_table_connection_, {}, {}, {}, mock_job_stub_,
+                     std::move(mock_background_), DefaultOptions({}));
+
+  google::cloud::bigquery::v2::Job job;
+  job.mutable_job_reference()->set_project_id("my-project");
+  job.mutable_job_reference()->set_job_id("my_job");
+  job.mutable_job_reference()->mutable_location()->set_value("us-east1");
+  auto result = connection_impl.InsertJob(NoAwaitTag{}, job, {});
+  ASSERT_STATUS_OK(result);
+  EXPECT_THAT(result->job_id(), Eq("my_job"));
+}
+
+TEST_F(ConnectionImplTest, InsertJobNoAwaitConflict) {
+  EXPECT_CALL(*mock_job_stub_, InsertJob)
+      .WillOnce(Return(internal::AbortedError("Already Exists: Job my_job")));
+  EXPECT_CALL(*mock_job_stub_, GetJob).Times(0);
+
+  auto connection_impl =
+      ConnectionImpl(mock_read_connection_, mock_job_connection_,
+                     mock_table_connection_, {}, {}, {}, mock_job_stub_,
+                     std::move(mock_background_), DefaultOptions({}));
+
+  google::cloud::bigquery::v2::Job job;
+  job.mutable_job_reference()->set_project_id("my-project");
+  job.mutable_job_reference()->set_job_id("my_job");
+  auto result = connection_impl.InsertJob(NoAwaitTag{}, job, {});
+  EXPECT_THAT(result, StatusIs(StatusCode::kAborted));
+}
+
+TEST_F(ConnectionImplTest, InsertJobNoAwaitAlreadyExists) {
+  EXPECT_CALL(*mock_job_stub_, InsertJob)
+      .WillOnce(Return(internal::AlreadyExistsError("duplicate")));
+  EXPECT_CALL(*mock_job_stub_, GetJob).Times(0);
+
+  auto connection_impl =
+      ConnectionImpl(mock_read_connection_, mock_job_connection_,
+                     mock_table_connection_, {}, {}, {}, mock_job_stub_,
+                     std::move(mock_background_), DefaultOptions({}));
+
+  google::cloud::bigquery::v2::Job job;
+  job.mutable_job_reference()->set_project_id("my-project");
+  job.mutable_job_reference()->set_job_id("my_job");
+  auto result = connection_impl.InsertJob(NoAwaitTag{}, job, {});
+  EXPECT_THAT(result, StatusIs(StatusCode::kAlreadyExists));
+}
+
 TEST_F(ConnectionImplTest, InsertJobAwaitImmediatelyDone) {
   std::string const project_id = "my-project";
   std::string const job_id = "my_job";
@@ -396,8 +702,9 @@ TEST_F(ConnectionImplTest, InsertJobAwaitImmediatelyDone) {
           std::make_unique<bigquery_unified::LimitedErrorCountRetryPolicy>(3));
 
   auto connection_impl = ConnectionImpl(
-      mock_read_connection_, mock_job_connection_, {}, {}, mock_job_stub_,
-      std::move(mock_background_), DefaultOptions(bigquery_unified_options));
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_),
+      DefaultOptions(bigquery_unified_options));
 
   google::cloud::bigquery::v2::JobReference job_reference;
   job_reference.set_project_id(project_id);
@@ -461,8 +768,9 @@ TEST_F(ConnectionImplTest, InsertJobAwaitPollForDone) {
   auto unified_background = std::make_unique<
       rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
   auto connection_impl = ConnectionImpl(
-      mock_read_connection_, mock_job_connection_, {}, {}, mock_job_stub_,
-      std::move(unified_background), DefaultOptions(bigquery_unified_options));
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(unified_background),
+      DefaultOptions(bigquery_unified_options));
 
   google::cloud::bigquery::v2::JobReference job_reference;
   job_reference.set_project_id(project_id);
@@ -471,6 +779,56 @@ TEST_F(ConnectionImplTest, InsertJobAwaitPollForDone) {
   EXPECT_THAT(result, IsOk());
 }
 
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+TEST_F(ConnectionImplTest, InsertJobAwaitPollTracedAsChild) {
+  auto span_catcher = InstallSpanCatcher();
+  auto parent = internal::MakeSpan("parent");
+
+  EXPECT_CALL(*mock_job_connection_, GetJob)
+      .WillOnce([](google::cloud::bigquery::v2::GetJobRequest const&) {
+        google::cloud::bigquery::v2::Job job;
+        job.mutable_job_reference()->set_project_id("my-project");
+        job.mutable_job_reference()->set_job_id("my_job");
+        job.mutable_status()->set_state("PENDING");
+        return job;
+      });
+  // The polls run on the executor threads, they are still traced as children
+  // of the span active when the job is awaited.
+  EXPECT_CALL(*mock_job_stub_, GetJob)
+      .WillOnce([&](rest_internal::RestContext&, google::cloud::Options const&,
+                    google::cloud::bigquery::v2::GetJobRequest const&)
+                    -> StatusOr<google::cloud::bigquery::v2::Job> {
+        auto current = opentelemetry::trace::GetSpan(
+            opentelemetry::context::RuntimeContext::GetCurrent());
+        EXPECT_EQ(current->GetContext().span_id(),
+                  parent->GetContext().span_id());
+        google::cloud::bigquery::v2::Job job;
+        job.mutable_job_reference()->set_project_id("my-project");
+        job.mutable_job_reference()->set_job_id("my_job");
+        job.mutable_status()->set_state("DONE");
+        return job;
+      });
+
+  auto unified_background = std::make_unique<
+      rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(unified_background),
+      DefaultOptions(SetQuickPollingOptions({})));
+
+  google::cloud::bigquery::v2::JobReference job_reference;
+  job_reference.set_project_id("my-project");
+  job_reference.set_job_id("my_job");
+  future<StatusOr<google::cloud::bigquery::v2::Job>> result;
+  {
+    auto scope = opentelemetry::trace::Scope(parent);
+    result = connection_impl.InsertJob(job_reference, {});
+  }
+  EXPECT_THAT(result.get(), IsOk());
+  parent->End();
+}
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+
 TEST_F(ConnectionImplTest, InsertJobAwaitPollDeadlineExceeded) {
   std::string const project_id = "my-project";
   std::string const job_id = "my_job";
@@ -505,8 +863,9 @@ TEST_F(ConnectionImplTest, InsertJobAwaitPollDeadlineExceeded) {
   auto unified_background = std::make_unique<
       rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
   auto connection_impl = ConnectionImpl(
-      mock_read_connection_, mock_job_connection_, {}, {}, mock_job_stub_,
-      std::move(unified_background), DefaultOptions(bigquery_unified_options));
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(unified_background),
+      DefaultOptions(bigquery_unified_options));
 
   google::cloud::bigquery::v2::JobReference job_reference;
   job_reference.set_project_id(project_id);
@@ -515,6 +874,438 @@ TEST_F(ConnectionImplTest, InsertJobAwaitPollDeadlineExceeded) {
   EXPECT_THAT(result, StatusIs(StatusCode::kDeadlineExceeded));
 }
 
+google::cloud::bigquery::v2::Job MakeQueryJob(std::string const& state) {
+  google::cloud::bigquery::v2::Job job;
+  job.mutable_job_reference()->set_project_id("my-project");
+  job.mutable_job_reference()->set_job_id("my_job");
+  job.mutable_configuration()->set_job_type("QUERY");
+  job.mutable_status()->set_state(state);
+  return job;
+}
+
+StatusOr<google::cloud::bigquery::v2::GetQueryResultsResponse>
+MakeQueryResults(bool complete) {
+  google::cloud::bigquery::v2::GetQueryResultsResponse response;
+  *response.mutable_job_reference() = MakeQueryJob("").job_reference();
+  response.mutable_job_complete()->set_value(complete);
+  return response;
+}
+
+TEST_F(ConnectionImplTest, InsertJobAwaitLongPoll) {
+  EXPECT_CALL(*mock_job_connection_, GetJob)
+      .WillOnce(Return(MakeQueryJob("PENDING")));
+
+  EXPECT_CALL(*mock_job_stub_, GetQueryResults)
+      .WillOnce(
+          [&](rest_internal::RestContext&, google::cloud::Options const&,
+              google::cloud::bigquery::v2::GetQueryResultsRequest const&
+                  request) {
+            EXPECT_THAT(request.project_id(), Eq("my-project"));
+            EXPECT_THAT(request.job_id(), Eq("my_job"));
+            EXPECT_THAT(request.max_results().value(), Eq(0U));
+            EXPECT_THAT(request.timeout_ms().value(), Eq(2000U));
+            return MakeQueryResults(false);
+          })
+      .WillOnce(Return(MakeQueryResults(true)));
+  EXPECT_CALL(*mock_job_stub_, GetJob).WillOnce(Return(MakeQueryJob("DONE")));
+
+  // The polling policy gives up 500ms after the first poll. Each blind wait is
+  // 1 second, so the test fails unless the long polls skip the waits.
+  auto options = DefaultOptions(
+      Options{}.set<bigquery_unified::JobLongPollTimeoutOption>(
+          std::chrono::seconds(2)));
+  options.set<bigquery_unified::PollingPolicyOption>(
+      std::make_shared<
+          GenericPollingPolicy<bigquery_unified::RetryPolicyOption::Type,
+                               bigquery_unified::BackoffPolicyOption::Type>>(
+          bigquery_unified::LimitedTimeRetryPolicy(
+              std::chrono::milliseconds(500))
+              .clone(),
+          ExponentialBackoffPolicy(std::chrono::seconds(1),
+                                   std::chrono::seconds(1), 2.0)
+              .clone()));
+
+  auto unified_background = std::make_unique<
+      rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(unified_background), options);
+
+  google::cloud::bigquery::v2::JobReference job_reference;
+  job_reference.set_project_id("my-project");
+  job_reference.set_job_id("my_job");
+  auto result = connection_impl.InsertJob(job_reference, {}).get();
+  ASSERT_STATUS_OK(result);
+  EXPECT_THAT(result->status().state(), Eq("DONE"));
+}
+
+TEST_F(ConnectionImplTest, InsertJobAwaitLongPollMoreJobsThanThreads) {
+  auto constexpr kJobs = 3;
+  auto make_job = [](std::string const& job_id, std::string const& state) {
+    auto job = MakeQueryJob(state);
+    job.mutable_job_reference()->set_job_id(job_id);
+    return job;
+  };
+  EXPECT_CALL(*mock_job_connection_, GetJob)
+      .Times(kJobs)
+      .WillRepeatedly(
+          [&](google::cloud::bigquery::v2::GetJobRequest const& request) {
+            return make_job(request.job_id(), "PENDING");
+          });
+
+  // There is a single thread for the long polls. The first long poll waits
+  // for the other jobs, which must use `jobs.get` instead of waiting for it.
+  std::mutex mu;
+  std::condition_variable cv;
+  int get_jobs = 0;
+  EXPECT_CALL(*mock_job_stub_, GetQueryResults)
+      .WillOnce(
+          [&](rest_internal::RestContext&, google::cloud::Options const&,
+              google::cloud::bigquery::v2::GetQueryResultsRequest const&
+                  request) {
+            std::unique_lock<std::mutex> lk(mu);
+            EXPECT_TRUE(cv.wait_for(lk, std::chrono::seconds(5),
+                                    [&] { return get_jobs == kJobs - 1; }));
+            auto response = MakeQueryResults(true);
+            response->mutable_job_reference()->set_job_id(request.job_id());
+            return response;
+          });
+  EXPECT_CALL(*mock_job_stub_, GetJob)
+      .Times(kJobs)
+      .WillRepeatedly(
+          [&](rest_internal::RestContext&, google::cloud::Options const&,
+              google::cloud::bigquery::v2::GetJobRequest const& request) {
+            std::lock_guard<std::mutex> lk(mu);
+            ++get_jobs;
+            cv.notify_all();
+            return make_job(request.job_id(), "DONE");
+          });
+
+  auto options = DefaultOptions(SetQuickPollingOptions(
+      Options{}.set<bigquery_unified::MaxConcurrentRpcsOption>(1)));
+  auto unified_background = std::make_unique<
+      rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(unified_background), options);
+
+  std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>> pending;
+  for (int i = 0; i != kJobs; ++i) {
+    google::cloud::bigquery::v2::JobReference job_reference;
+    job_reference.set_project_id("my-project");
+    job_reference.set_job_id("my_job_" + std::to_string(i));
+    pending.push_back(connection_impl.InsertJob(job_reference, {}));
+  }
+  for (auto& p : pending) {
+    auto result = p.get();
+    ASSERT_STATUS_OK(result);
+    EXPECT_THAT(result->status().state(), Eq("DONE"));
+  }
+}
+
+TEST_F(ConnectionImplTest, InsertJobAwaitLongPollSharedPool) {
+  auto constexpr kJobs = 2;
+  auto make_job = [](std::string const& job_id, std::string const& state) {
+    auto job = MakeQueryJob(state);
+    job.mutable_job_reference()->set_job_id(job_id);
+    return job;
+  };
+  EXPECT_CALL(*mock_job_connection_, GetJob)
+      .Times(kJobs)
+      .WillRepeatedly(
+          [&](google::cloud::bigquery::v2::GetJobRequest const& request) {
+            return make_job(request.job_id(), "PENDING");
+          });
+
+  // The long polls may use half of the shared pool, a single thread. The
+  // first long poll waits for the other job, which uses `jobs.get`.
+  std::mutex mu;
+  std::condition_variable cv;
+  int get_jobs = 0;
+  EXPECT_CALL(*mock_job_stub_, GetQueryResults)
+      .WillOnce(
+          [&](rest_internal::RestContext&, google::cloud::Options const&,
+              google::cloud::bigquery::v2::GetQueryResultsRequest const&
+                  request) {
+            std::unique_lock<std::mutex> lk(mu);
+            EXPECT_TRUE(cv.wait_for(lk, std::chrono::seconds(5),
+                                    [&] { return get_jobs == kJobs - 1; }));
+            auto response = MakeQueryResults(true);
+            response->mutable_job_reference()->set_job_id(request.job_id());
+            return response;
+          });
+  EXPECT_CALL(*mock_job_stub_, GetJob)
+      .Times(kJobs)
+      .WillRepeatedly(
+          [&](rest_internal::RestContext&, google::cloud::Options const&,
+              google::cloud::bigquery::v2::GetJobRequest const& request) {
+            std::lock_guard<std::mutex> lk(mu);
+            ++get_jobs;
+            cv.notify_all();
+            return make_job(request.job_id(), "DONE");
+          });
+
+  auto options = DefaultOptions(SetQuickPollingOptions(
+      Options{}.set<bigquery_unified::BlockingThreadPoolOption>(
+          std::make_shared<bigquery_unified::BlockingThreadPool>(2))));
+  auto unified_background = std::make_unique<
+      rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(unified_background), options);
+
+  std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>> pending;
+  for (int i = 0; i != kJobs; ++i) {
+    google::cloud::bigquery::v2::JobReference job_reference;
+    job_reference.set_project_id("my-project");
+    job_reference.set_job_id("my_job_" + std::to_string(i));
+    pending.push_back(connection_impl.InsertJob(job_reference, {}));
+  }
+  for (auto& p : pending) {
+    auto result = p.get();
+    ASSERT_STATUS_OK(result);
+    EXPECT_THAT(result->status().state(), Eq("DONE"));
+  }
+}
+
+TEST_F(ConnectionImplTest, InsertJobAwaitLongPollDisabled) {
+  EXPECT_CALL(*mock_job_connection_, GetJob)
+      .WillOnce(Return(MakeQueryJob("PENDING")));
+  EXPECT_CALL(*mock_job_stub_, GetQueryResults).Times(0);
+  EXPECT_CALL(*mock_job_stub_, GetJob)
+      .WillOnce(Return(MakeQueryJob("RUNNING")))
+      .WillOnce(Return(MakeQueryJob("DONE")));
+
+  auto options = SetQuickPollingOptions(
+      Options{}.set<bigquery_unified::JobCompletionStrategyOption>(
+          bigquery_unified::JobCompletionStrategy::kPoll));
+
+  auto unified_background = std::make_unique<
+      rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(unified_background),
+      DefaultOptions(options));
+
+  google::cloud::bigquery::v2::JobReference job_reference;
+  job_reference.set_project_id("my-project");
+  job_reference.set_job_id("my_job");
+  auto result = connection_impl.InsertJob(job_reference, {}).get();
+  ASSERT_STATUS_OK(result);
+  EXPECT_THAT(result->status().state(), Eq("DONE"));
+}
+
+TEST_F(ConnectionImplTest, InsertJobAwaitPollsOffCompletionQueue) {
+  CompletionQueue cq;
+  std::thread runner([cq]() mutable { cq.Run(); });
+  auto const cq_thread = runner.get_id();
+  EXPECT_CALL(*mock_background_, cq).WillRepeatedly(Return(cq));
+
+  EXPECT_CALL(*mock_job_connection_, GetJob)
+      .WillOnce(Return(MakeQueryJob("PENDING")));
+  EXPECT_CALL(*mock_job_stub_, GetJob)
+      .WillOnce([&](rest_internal::RestContext&, google::cloud::Options const&,
+                    google::cloud::bigquery::v2::GetJobRequest const&) {
+        EXPECT_NE(std::this_thread::get_id(), cq_thread);
+        return MakeQueryJob("RUNNING");
+      })
+      .WillOnce([&](rest_internal::RestContext&, google::cloud::Options const&,
+                    google::cloud::bigquery::v2::GetJobRequest const&) {
+        EXPECT_NE(std::this_thread::get_id(), cq_thread);
+        return MakeQueryJob("DONE");
+      });
+
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_),
+      DefaultOptions(SetQuickPollingOptions(
+          Options{}.set<bigquery_unified::JobCompletionStrategyOption>(
+              bigquery_unified::JobCompletionStrategy::kPoll))));
+
+  google::cloud::bigquery::v2::JobReference job_reference;
+  job_reference.set_project_id("my-project");
+  job_reference.set_job_id("my_job");
+  auto result = connection_impl.InsertJob(job_reference, {}).get();
+  ASSERT_STATUS_OK(result);
+  EXPECT_THAT(result->status().state(), Eq("DONE"));
+
+  cq.Shutdown();
+  runner.join();
+}
+
+TEST_F(ConnectionImplTest, InsertJobAwaitWatch) {
+  EXPECT_CALL(*mock_job_connection_, GetJob)
+      .WillOnce(Return(MakeQueryJob("PENDING")));
+  EXPECT_CALL(*mock_job_stub_, GetQueryResults).Times(0);
+  EXPECT_CALL(*mock_job_stub_, ListJobs)
+      .WillOnce(
+          [](rest_internal::RestContext&, google::cloud::Options const&,
+             google::cloud::bigquery::v2::ListJobsRequest const& request) {
+            EXPECT_THAT(request.project_id(), Eq("my-project"));
+            google::cloud::bigquery::v2::JobList list;
+            list.add_jobs()->mutable_job_reference()->set_job_id("my_job");
+            return list;
+          });
+  EXPECT_CALL(*mock_job_stub_, GetJob).WillOnce(Return(MakeQueryJob("DONE")));
+
+  auto options = DefaultOptions(
+      Options{}
+          .set<bigquery_unified::JobCompletionStrategyOption>(
+              bigquery_unified::JobCompletionStrategy::kWatch)
+          .set<bigquery_unified::JobWatchPeriodOption>(
+              std::chrono::milliseconds(1)));
+
+  auto unified_background = std::make_unique<
+      rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(unified_background), options);
+
+  google::cloud::bigquery::v2::JobReference job_reference;
+  job_reference.set_project_id("my-project");
+  job_reference.set_job_id("my_job");
+  auto result = connection_impl.InsertJob(job_reference, {}).get();
+  ASSERT_STATUS_OK(result);
+  EXPECT_THAT(result->status().state(), Eq("DONE"));
+}
+
+TEST_F(ConnectionImplTest, ListJobsAppliesOptions) {
+  EXPECT_CALL(*mock_job_stub_, ListJobs)
+      .WillOnce(
+          [](rest_internal::RestContext&, google::cloud::Options const&,
+             google::cloud::bigquery::v2::ListJobsRequest const& request) {
+            EXPECT_THAT(request.page_token(), Eq(""));
+            EXPECT_THAT(request.projection(),
+                        Eq(google::cloud::bigquery::v2::ListJobsRequest::FULL));
+            EXPECT_THAT(
+                request.state_filter(),
+                ElementsAre(
+                    google::cloud::bigquery::v2::ListJobsRequest::RUNNING));
+            google::cloud::bigquery::v2::JobList list;
+            list.add_jobs()->set_id("job-1");
+            list.set_next_page_token("page-2");
+            return list;
+          })
+      .WillOnce(
+          [](rest_internal::RestContext&, google::cloud::Options const&,
+             google::cloud::bigquery::v2::ListJobsRequest const& request) {
+            EXPECT_THAT(request.page_token(), Eq("page-2"));
+            google::cloud::bigquery::v2::JobList list;
+            list.add_jobs()->set_id("job-2");
+            return list;
+          });
+
+  auto options = DefaultOptions(
+      Options{}
+          .set<bigquery_unified::ListJobsProjectionOption>(
+              bigquery_unified::ListJobsProjection::kFull)
+          .set<bigquery_unified::ListJobsStateFilterOption>(
+              {bigquery_unified::JobState::kRunning}));
+  auto unified_background = std::make_unique<
+      rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(unified_background), options);
+
+  google::cloud::bigquery::v2::ListJobsRequest request;
+  request.set_project_id("my-project");
+  std::vector<std::string> ids;
+  for (auto& job : connection_impl.ListJobs(request, {})) {
+    ASSERT_STATUS_OK(job);
+    ids.push_back(job->id());
+  }
+  EXPECT_THAT(ids, ElementsAre("job-1", "job-2"));
+}
+
+TEST_F(ConnectionImplTest, InsertJobs) {
+  EXPECT_CALL(*mock_job_stub_, InsertJob)
+      .Times(3)
+      .WillRepeatedly(
+          [](rest_internal::RestContext&, Options const&,
+             google::cloud::bigquery::v2::InsertJobRequest const& request)
+              -> StatusOr<google::cloud::bigquery::v2::Job> {
+            EXPECT_THAT(request.project_id(), Eq("billing-project"));
+            if (request.job().job_reference().job_id() == "bad") {
+              return internal::InvalidArgumentError("uh-oh");
+            }
+            auto job = request.job();
+            job.mutable_status()->set_state("DONE");
+            return job;
+          });
+
+  auto options = DefaultOptions(
+      Options{}
+          .set<bigquery_unified::BillingProjectOption>("billing-project")
+          .set<bigquery_unified::MaxConcurrentRpcsOption>(2));
+
+  auto unified_background = std::make_unique<
+      rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(unified_background), options);
+
+  std::vector<google::cloud::bigquery::v2::Job> jobs(3);
+  jobs[0].mutable_job_reference()->set_job_id("a");
+  jobs[1].mutable_job_reference()->set_job_id("bad");
+  jobs[2].mutable_job_reference()->set_job_id("c");
+  auto result = connection_impl.InsertJobs(jobs, {});
+  ASSERT_EQ(result.size(), 3U);
+  auto a = result[0].get();
+  ASSERT_STATUS_OK(a);
+  EXPECT_THAT(a->job_reference().job_id(), Eq("a"));
+  EXPECT_THAT(result[1].get(), StatusIs(StatusCode::kInvalidArgument));
+  auto c = result[2].get();
+  ASSERT_STATUS_OK(c);
+  EXPECT_THAT(c->job_reference().job_id(), Eq("c"));
+}
+
+TEST_F(ConnectionImplTest, InsertJobsSharedPool) {
+  // The submitters use at most half of the shared pool, a single thread.
+  std::atomic<int> inserting{0};
+  std::atomic<int> max_inserting{0};
+  EXPECT_CALL(*mock_job_stub_, InsertJob)
+      .Times(4)
+      .WillRepeatedly(
+          [&](rest_internal::RestContext&, Options const&,
+              google::cloud::bigquery::v2::InsertJobRequest const& request)
+              -> StatusOr<google::cloud::bigquery::v2::Job> {
+            auto const n = ++inserting;
+            auto m = max_inserting.load();
+            while (m < n && !max_inserting.compare_exchange_weak(m, n)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            --inserting;
+            auto job = request.job();
+            job.mutable_status()->set_state("DONE");
+            return job;
+          });
+
+  auto options = DefaultOptions(
+      Options{}
+          .set<bigquery_unified::BillingProjectOption>("billing-project")
+          .set<bigquery_unified::MaxConcurrentRpcsOption>(4)
+          .set<bigquery_unified::BlockingThreadPoolOption>(
+              std::make_shared<bigquery_unified::BlockingThreadPool>(2)));
+  auto unified_background = std::make_unique<
+      rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(unified_background), options);
+
+  std::vector<google::cloud::bigquery::v2::Job> jobs(4);
+  for (std::size_t i = 0; i != jobs.size(); ++i) {
+    jobs[i].mutable_job_reference()->set_job_id("job-" + std::to_string(i));
+  }
+  auto result = connection_impl.InsertJobs(jobs, {});
+  ASSERT_EQ(result.size(), 4U);
+  for (std::size_t i = 0; i != result.size(); ++i) {
+    auto job = result[i].get();
+    ASSERT_STATUS_OK(job);
+    EXPECT_THAT(job->job_reference().job_id(), Eq("job-" + std::to_string(i)));
+  }
+  EXPECT_EQ(max_inserting.load(), 1);
+}
+
 TEST_F(ConnectionImplTest, CancelJobNoAwait) {
   std::string const project_id = "my-project";
   std::string const job_id = "my_job";
@@ -533,8 +1324,9 @@ TEST_F(ConnectionImplTest, CancelJobNoAwait) {
           });
 
   auto connection_impl =
-      ConnectionImpl(mock_read_connection_, mock_job_connection_, {}, {},
-                     mock_job_stub_, std::move(mock_background_), {});
+      ConnectionImpl(mock_read_connection_, mock_job_connection_,
+                     mock_table_connection_, {}, {}, {}, mock_job_stub_,
+                     std::move(mock_background_), {});
 
   google::cloud::bigquery::v2::CancelJobRequest request;
   request.set_job_id(job_id);
@@ -566,8 +1358,9 @@ TEST_F(ConnectionImplTest, CancelJobAwaitImmediatelyDone) {
           std::make_unique<bigquery_unified::LimitedErrorCountRetryPolicy>(3));
 
   auto connection_impl = ConnectionImpl(
-      mock_read_connection_, mock_job_connection_, {}, {}, mock_job_stub_,
-      std::move(mock_background_), DefaultOptions(bigquery_unified_options));
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_),
+      DefaultOptions(bigquery_unified_options));
 
   google::cloud::bigquery::v2::JobReference job_reference;
   job_reference.set_project_id(project_id);
@@ -631,8 +1424,9 @@ TEST_F(ConnectionImplTest, CancelJobAwaitPollForDone) {
   auto unified_background = std::make_unique<
       rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
   auto connection_impl = ConnectionImpl(
-      mock_read_connection_, mock_job_connection_, {}, {}, mock_job_stub_,
-      std::move(unified_background), DefaultOptions(bigquery_unified_options));
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(unified_background),
+      DefaultOptions(bigquery_unified_options));
 
   google::cloud::bigquery::v2::JobReference job_reference;
   job_reference.set_project_id(project_id);
@@ -675,8 +1469,9 @@ TEST_F(ConnectionImplTest, CancelJobAwaitPollDeadlineExceeded) {
   auto unified_background = std::make_unique<
       rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
   auto connection_impl = ConnectionImpl(
-      mock_read_connection_, mock_job_connection_, {}, {}, mock_job_stub_,
-      std::move(unified_background), DefaultOptions(bigquery_unified_options));
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(unified_background),
+      DefaultOptions(bigquery_unified_options));
 
   google::cloud::bigquery::v2::JobReference job_reference;
   job_reference.set_project_id(project_id);
@@ -685,6 +1480,548 @@ TEST_F(ConnectionImplTest, CancelJobAwaitPollDeadlineExceeded) {
   EXPECT_THAT(result, StatusIs(StatusCode::kDeadlineExceeded));
 }
 
+google::cloud::bigquery::v2::ListFormatJob MakeListedJob(
+    std::string const& job_id, std::string const& run) {
+  google::cloud::bigquery::v2::ListFormatJob job;
+  job.mutable_job_reference()->set_project_id("my-project");
+  job.mutable_job_reference()->set_job_id(job_id);
+  (*job.mutable_configuration()->mutable_labels())["run"] = run;
+  return job;
+}
+
+TEST_F(ConnectionImplTest, CancelJobs) {
+  EXPECT_CALL(*mock_job_stub_, ListJobs)
+      .WillOnce(
+          [](rest_internal::RestContext&, google::cloud::Options const&,
+             google::cloud::bigquery::v2::ListJobsRequest const& request) {
+            EXPECT_THAT(request.project_id(), Eq("my-project"));
+            EXPECT_THAT(
+                request.projection(),
+                Eq(google::cloud::bigquery::v2::ListJobsRequest::FULL));
+            EXPECT_THAT(
+                request.state_filter(),
+                ElementsAre(
+                    google::cloud::bigquery::v2::ListJobsRequest::PENDING,
+                    google::cloud::bigquery::v2::ListJobsRequest::RUNNING));
+            google::cloud::bigquery::v2::JobList list;
+            *list.add_jobs() = MakeListedJob("a", "r1");
+            *list.add_jobs() = MakeListedJob("b", "r2");
+            *list.add_jobs() = MakeListedJob("c", "r1");
+            return list;
+          });
+  EXPECT_CALL(*mock_job_stub_, CancelJob)
+      .Times(2)
+      .WillRepeatedly(
+          [](rest_internal::RestContext&, google::cloud::Options const&,
+             google::cloud::bigquery::v2::CancelJobRequest const& request)
+              -> StatusOr<google::cloud::bigquery::v2::JobCancelResponse> {
+            EXPECT_THAT(request.project_id(), Eq("my-project"));
+            if (request.job_id() == "c") {
+              return internal::PermissionDeniedError("uh-oh");
+            }
+            google::cloud::bigquery::v2::JobCancelResponse response;
+            response.mutable_job()->mutable_job_reference()->set_job_id(
+                request.job_id());
+            response.mutable_job()->mutable_status()->set_state("RUNNING");
+            return response;
+          });
+  // The cancelled jobs are not awaited.
+  EXPECT_CALL(*mock_job_stub_, GetJob).Times(0);
+
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_),
+      DefaultOptions(SetQuickPollingOptions(
+          Options{}.set<bigquery_unified::MaxConcurrentRpcsOption>(2))));
+
+  bigquery_unified::JobFilter filter;
+  filter.project_id = "my-project";
+  filter.labels = {{"run", "r1"}};
+  auto result = connection_impl.CancelJobs(filter, {});
+  ASSERT_STATUS_OK(result);
+  ASSERT_THAT(*result, SizeIs(2));
+  EXPECT_THAT((*result)[0].job_reference.job_id(), Eq("a"));
+  EXPECT_THAT((*result)[0].status, IsOk());
+  EXPECT_THAT((*result)[1].job_reference.job_id(), Eq("c"));
+  EXPECT_THAT((*result)[1].status, StatusIs(StatusCode::kPermissionDenied));
+}
+
+TEST_F(ConnectionImplTest, CancelJobsAwaitWatchSingleThread) {
+  EXPECT_CALL(*mock_job_stub_, ListJobs)
+      .WillRepeatedly(
+          [](rest_internal::RestContext&, google::cloud::Options const&,
+             google::cloud::bigquery::v2::ListJobsRequest const&) {
+            // The same jobs are listed to cancel them, and once they are done.
+            google::cloud::bigquery::v2::JobList list;
+            *list.add_jobs() = MakeListedJob("a", "r1");
+            *list.add_jobs() = MakeListedJob("b", "r1");
+            return list;
+          });
+  EXPECT_CALL(*mock_job_stub_, CancelJob)
+      .Times(2)
+      .WillRepeatedly(
+          [](rest_internal::RestContext&, google::cloud::Options const&,
+             google::cloud::bigquery::v2::CancelJobRequest const& request) {
+            google::cloud::bigquery::v2::JobCancelResponse response;
+            auto& job = *response.mutable_job();
+            job.mutable_job_reference()->set_project_id("my-project");
+            job.mutable_job_reference()->set_job_id(request.job_id());
+            job.mutable_status()->set_state("RUNNING");
+            return response;
+          });
+  EXPECT_CALL(*mock_job_stub_, GetJob)
+      .Times(2)
+      .WillRepeatedly(
+          [](rest_internal::RestContext&, google::cloud::Options const&,
+             google::cloud::bigquery::v2::GetJobRequest const& request) {
+            google::cloud::bigquery::v2::Job job;
+            job.mutable_job_reference()->set_project_id("my-project");
+            job.mutable_job_reference()->set_job_id(request.job_id());
+            job.mutable_status()->set_state("DONE");
+            return job;
+          });
+
+  // The cancels and the watcher share a single thread. Waiting for a job on
+  // that thread would block the watcher forever.
+  auto options = DefaultOptions(SetQuickPollingOptions(
+      Options{}
+          .set<bigquery_unified::BlockingThreadPoolOption>(
+              std::make_shared<bigquery_unified::BlockingThreadPool>(1))
+          .set<bigquery_unified::CancelJobsAwaitOption>(true)
+          .set<bigquery_unified::JobCompletionStrategyOption>(
+              bigquery_unified::JobCompletionStrategy::kWatch)
+          .set<bigquery_unified::JobWatchPeriodOption>(
+              std::chrono::milliseconds(1))));
+  auto unified_background = std::make_unique<
+      rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(unified_background), options);
+
+  bigquery_unified::JobFilter filter;
+  filter.project_id = "my-project";
+  auto result = connection_impl.CancelJobs(filter, {});
+  ASSERT_STATUS_OK(result);
+  ASSERT_THAT(*result, SizeIs(2));
+  EXPECT_THAT((*result)[0].status, IsOk());
+  EXPECT_THAT((*result)[1].status, IsOk());
+}
+
+TEST_F(ConnectionImplTest, DeleteJobs) {
+  EXPECT_CALL(*mock_job_stub_, ListJobs)
+      .WillOnce(
+          [](rest_internal::RestContext&, google::cloud::Options const&,
+             google::cloud::bigquery::v2::ListJobsRequest const& request) {
+            // Without labels the job configuration is not needed, and the
+            // state filter option does not apply.
+            EXPECT_THAT(
+                request.projection(),
+                Eq(google::cloud::bigquery::v2::ListJobsRequest::MINIMAL));
+            EXPECT_THAT(request.state_filter(), SizeIs(0));
+            EXPECT_TRUE(request.all_users());
+            google::cloud::bigquery::v2::JobList list;
+            *list.add_jobs() = MakeListedJob("a", "r1");
+            *list.add_jobs() = MakeListedJob("b", "r2");
+            return list;
+          });
+  EXPECT_CALL(*mock_job_stub_, DeleteJob)
+      .Times(2)
+      .WillRepeatedly(Return(Status{}));
+
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_),
+      DefaultOptions(SetQuickPollingOptions(
+          Options{}.set<bigquery_unified::ListJobsStateFilterOption>(
+              {bigquery_unified::JobState::kDone}))));
+
+  bigquery_unified::JobFilter filter;
+  filter.project_id = "my-project";
+  filter.all_users = true;
+  auto result = connection_impl.DeleteJobs(filter, {});
+  ASSERT_STATUS_OK(result);
+  ASSERT_THAT(*result, SizeIs(2));
+  EXPECT_THAT((*result)[0].status, IsOk());
+  EXPECT_THAT((*result)[1].status, IsOk());
+}
+
+TEST_F(ConnectionImplTest, DeleteJobsListError) {
+  EXPECT_CALL(*mock_job_stub_, ListJobs)
+      .WillOnce(Return(internal::PermissionDeniedError("uh-oh")));
+  EXPECT_CALL(*mock_job_stub_, DeleteJob).Times(0);
+
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_),
+      DefaultOptions(SetQuickPollingOptions({})));
+
+  bigquery_unified::JobFilter filter;
+  filter.project_id = "my-project";
+  EXPECT_THAT(connection_impl.DeleteJobs(filter, {}),
+              StatusIs(StatusCode::kPermissionDenied));
+}
+
+std::shared_ptr<arrow::RecordBatch> MakeTestRecordBatch() {
+  arrow::Int64Builder builder;
+  EXPECT_TRUE(builder.AppendValues({1, 2, 3}).ok());
+  std::shared_ptr<arrow::Array> array;
+  EXPECT_TRUE(builder.Finish(&array).ok());
+  return arrow::RecordBatch::Make(
+      arrow::schema({arrow::field("x", arrow::int64())}), 3, {array});
+}
+
+google::cloud::bigquery::storage::v1::ReadSession MakeTestReadSession(
+    std::string const& name, int stream_count, std::int64_t rows,
+    std::int64_t expire_seconds) {
+  auto schema = arrow::ipc::SerializeSchema(*MakeTestRecordBatch()->schema());
+  EXPECT_TRUE(schema.ok());
+  google::cloud::bigquery::storage::v1::ReadSession session;
+  session.set_name(name);
+  session.mutable_arrow_schema()->set_serialized_schema(
+      (*schema)->ToString());
+  session.set_estimated_row_count(rows);
+  session.set_estimated_total_bytes_scanned(10 * rows);
+  session.mutable_expire_time()->set_seconds(expire_seconds);
+  for (int i = 0; i != stream_count; ++i) {
+    session.add_streams()->set_name(name + "/streams/" + std::to_string(i));
+  }
+  return session;
+}
+
+TEST_F(ConnectionImplTest, ReadArrowPartitions) {
+  EXPECT_CALL(*mock_read_connection_, CreateReadSession)
+      .Times(3)
+      .WillRepeatedly(
+          [](google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+                 request) {
+            auto const& restriction =
+                request.read_session().read_options().row_restriction();
+            if (restriction == "p1") return MakeTestReadSession("s1", 2, 6, 20);
+            if (restriction == "p2") return MakeTestReadSession("s2", 0, 0, 30);
+            return MakeTestReadSession("s3", 1, 3, 10);
+          });
+  EXPECT_CALL(*mock_read_connection_, ReadRows)
+      .Times(3)
+      .WillRepeatedly(
+          [](google::cloud::bigquery::storage::v1::ReadRowsRequest const&) {
+            auto batch = arrow::ipc::SerializeRecordBatch(
+                *MakeTestRecordBatch(), arrow::ipc::IpcWriteOptions::Defaults());
+            EXPECT_TRUE(batch.ok());
+            google::cloud::bigquery::storage::v1::ReadRowsResponse response;
+            response.set_row_count(3);
+            response.mutable_arrow_record_batch()->set_serialized_record_batch(
+                (*batch)->ToString());
+            return google::cloud::internal::MakeStreamRange<
+                google::cloud::bigquery::storage::v1::ReadRowsResponse>(
+                [response, sent = false]() mutable
+                -> absl::variant<
+                    Status,
+                    google::cloud::bigquery::storage::v1::ReadRowsResponse> {
+                  if (sent) return Status{};
+                  sent = true;
+                  return response;
+                });
+          });
+
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_),
+      Options{}.set<bigquery_unified::MaxConcurrentRpcsOption>(2));
+
+  std::map<std::string,
+           google::cloud::bigquery::storage::v1::CreateReadSessionRequest>
+      requests;
+  for (auto const* id : {"p1", "p2", "p3"}) {
+    requests[id].mutable_read_session()->mutable_read_options()
+        ->set_row_restriction(id);
+  }
+  auto result = connection_impl.ReadArrowPartitions(requests, {});
+  ASSERT_STATUS_OK(result);
+  EXPECT_THAT(result->estimated_row_count, Eq(9));
+  EXPECT_THAT(result->estimated_total_bytes_scanned, Eq(90));
+  EXPECT_THAT(result->expire_time.seconds(), Eq(10));
+  ASSERT_TRUE(result->schema);
+  EXPECT_FALSE(result->schema->HasMetadata());
+  EXPECT_THAT(
+      result->readers,
+      ElementsAre(
+          Field(&bigquery_unified::PartitionReader::partition_id, "p1"),
+          Field(&bigquery_unified::PartitionReader::partition_id, "p1"),
+          Field(&bigquery_unified::PartitionReader::partition_id, "p3")));
+
+  for (auto& r : result->readers) {
+    for (auto const& batch : r.reader) {
+      ASSERT_STATUS_OK(batch);
+      auto const& metadata = (*batch)->schema()->metadata();
+      ASSERT_TRUE(metadata);
+      EXPECT_THAT(metadata->Get(bigquery_unified::kPartitionIdMetadataKey)
+                      .ValueOr(""),
+                  Eq(r.partition_id));
+    }
+  }
+}
+
+TEST_F(ConnectionImplTest, ReadArrowPartitionsError) {
+  EXPECT_CALL(*mock_read_connection_, CreateReadSession)
+      .Times(2)
+      .WillRepeatedly(
+          [](google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+                 request)
+              -> StatusOr<google::cloud::bigquery::storage::v1::ReadSession> {
+            if (request.read_session().read_options().row_restriction() ==
+                "p2") {
+              return internal::PermissionDeniedError("uh-oh");
+            }
+            return MakeTestReadSession("s1", 0, 0, 10);
+          });
+
+  auto connection_impl =
+      ConnectionImpl(mock_read_connection_, mock_job_connection_,
+                     mock_table_connection_, {}, {}, {}, mock_job_stub_,
+                     std::move(mock_background_), {});
+
+  std::map<std::string,
+           google::cloud::bigquery::storage::v1::CreateReadSessionRequest>
+      requests;
+  for (auto const* id : {"p1", "p2"}) {
+    requests[id].mutable_read_session()->mutable_read_options()
+        ->set_row_restriction(id);
+  }
+  auto result = connection_impl.ReadArrowPartitions(requests, {});
+  EXPECT_THAT(result, StatusIs(StatusCode::kPermissionDenied));
+}
+
+TEST_F(ConnectionImplTest, ReadArrowSessionCache) {
+  EXPECT_CALL(*mock_read_connection_, CreateReadSession)
+      .WillOnce(Return(MakeTestReadSession("s1", 0, 0,
+                                           std::numeric_limits<int>::max())));
+
+  // In production the read options include all the connection options.
+  auto read_options = DefaultOptions(
+      Options{}.set<bigquery_unified::ReadSessionCacheSizeOption>(8));
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_,
+      read_options, {}, {}, mock_job_stub_, std::move(mock_background_),
+      read_options);
+
+  google::cloud::bigquery::storage::v1::CreateReadSessionRequest request;
+  request.mutable_read_session()->set_table("my-table");
+  for (int i = 0; i != 3; ++i) {
+    auto result = connection_impl.ReadArrow(request, {});
+    ASSERT_STATUS_OK(result);
+    EXPECT_THAT(result->estimated_row_count, Eq(0));
+  }
+}
+
+TEST_F(ConnectionImplTest, ReadArrowSessionCacheDisabled) {
+  EXPECT_CALL(*mock_read_connection_, CreateReadSession)
+      .Times(2)
+      .WillRepeatedly(Return(
+          MakeTestReadSession("s1", 0, 0, std::numeric_limits<int>::max())));
+
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_,
+      DefaultOptions({}), {}, {}, mock_job_stub_, std::move(mock_background_),
+      DefaultOptions({}));
+
+  google::cloud::bigquery::storage::v1::CreateReadSessionRequest request;
+  request.mutable_read_session()->set_table("my-table");
+  ASSERT_STATUS_OK(connection_impl.ReadArrow(request, {}));
+  ASSERT_STATUS_OK(connection_impl.ReadArrow(request, {}));
+}
+
+TEST_F(ConnectionImplTest, QueryArrow) {
+  EXPECT_CALL(*mock_job_stub_, InsertJob)
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   google::cloud::bigquery::v2::InsertJobRequest const&
+                       request) {
+        auto job = request.job();
+        job.mutable_job_reference()->set_project_id("my-project");
+        job.mutable_status()->set_state("DONE");
+        auto& table = *job.mutable_configuration()
+                           ->mutable_query()
+                           ->mutable_destination_table();
+        table.set_project_id("my-project");
+        table.set_dataset_id("_anon");
+        table.set_table_id("anon-table");
+        return job;
+      });
+  EXPECT_CALL(*mock_read_connection_, CreateReadSession)
+      .WillOnce(
+          [](google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+                 request) {
+            EXPECT_THAT(request.parent(), Eq("projects/my-project"));
+            EXPECT_THAT(
+                request.read_session().table(),
+                Eq("projects/my-project/datasets/_anon/tables/anon-table"));
+            return MakeTestReadSession("s1", 2, 6, 20);
+          });
+  EXPECT_CALL(*mock_read_connection_, ReadRows)
+      .Times(2)
+      .WillRepeatedly(
+          [](google::cloud::bigquery::storage::v1::ReadRowsRequest const&) {
+            return google::cloud::internal::MakeStreamRange<
+                google::cloud::bigquery::storage::v1::ReadRowsResponse>(
+                [] { return Status{}; });
+          });
+
+  auto options = DefaultOptions(
+      Options{}.set<bigquery_unified::MaxConcurrentRpcsOption>(2));
+  auto unified_background = std::make_unique<
+      rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
+  // The warm-up is not required to succeed.
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_,
+      options, {}, {}, mock_job_stub_, std::move(unified_background), options,
+      [] { return internal::UnavailableError("cannot connect"); });
+
+  google::cloud::bigquery::v2::Job job;
+  job.mutable_configuration()->mutable_query()->set_query("SELECT 1");
+  auto result = connection_impl.QueryArrow(job, {}).get();
+  ASSERT_STATUS_OK(result);
+  EXPECT_THAT(result->estimated_row_count, Eq(6));
+  EXPECT_THAT(result->readers, SizeIs(2));
+  ASSERT_THAT(result->stats, NotNull());
+  EXPECT_EQ(result->stats->stream_count(), 2U);
+}
+
+TEST_F(ConnectionImplTest, QueryArrowWarmsUpOnce) {
+  EXPECT_CALL(*mock_job_stub_, InsertJob)
+      .Times(3)
+      .WillRepeatedly([](rest_internal::RestContext&, Options const&,
+                         google::cloud::bigquery::v2::InsertJobRequest const&
+                             request) {
+        auto job = request.job();
+        job.mutable_status()->set_state("DONE");
+        job.mutable_status()->mutable_error_result()->set_message("uh-oh");
+        return job;
+      });
+  EXPECT_CALL(*mock_read_connection_, CreateReadSession).Times(0);
+
+  std::atomic<int> connect_calls{0};
+  promise<void> connected;
+  auto options = DefaultOptions({});
+  auto unified_background = std::make_unique<
+      rest_internal::AutomaticallyCreatedRestBackgroundThreads>();
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_,
+      options, {}, {}, mock_job_stub_, std::move(unified_background), options,
+      [&] {
+        if (connect_calls++ == 0) connected.set_value();
+        return Status{};
+      });
+
+  google::cloud::bigquery::v2::Job job;
+  job.mutable_configuration()->mutable_query()->set_query("SELECT 1");
+  for (int i = 0; i != 3; ++i) {
+    EXPECT_THAT(connection_impl.QueryArrow(job, {}).get(),
+                StatusIs(StatusCode::kUnknown));
+  }
+  connected.get_future().get();
+  EXPECT_EQ(connect_calls.load(), 1);
+}
+
+TEST_F(ConnectionImplTest, QueryArrowRequiresQuery) {
+  EXPECT_CALL(*mock_job_stub_, InsertJob).Times(0);
+  EXPECT_CALL(*mock_read_connection_, CreateReadSession).Times(0);
+
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_,
+      DefaultOptions({}), {}, {}, mock_job_stub_, std::move(mock_background_),
+      DefaultOptions({}));
+
+  google::cloud::bigquery::v2::Job job;
+  job.mutable_configuration()->mutable_load();
+  auto result = connection_impl.QueryArrow(job, {}).get();
+  EXPECT_THAT(result, StatusIs(StatusCode::kInvalidArgument));
+}
+
+google::cloud::bigquery::v2::Table MakeTestTable() {
+  google::cloud::bigquery::v2::Table table;
+  auto& fields = *table.mutable_schema()->mutable_fields();
+  auto& id = *fields.Add();
+  id.set_name("id");
+  id.set_type("INTEGER");
+  id.set_mode("REQUIRED");
+  auto& name = *fields.Add();
+  name.set_name("name");
+  name.set_type("STRING");
+  return table;
+}
+
+TEST_F(ConnectionImplTest, GetArrowSchemaCached) {
+  EXPECT_CALL(*mock_table_connection_, GetTable)
+      .WillOnce(
+          [](google::cloud::bigquery::v2::GetTableRequest const& request) {
+            EXPECT_THAT(request.table_id(), Eq("my-table"));
+            EXPECT_THAT(request.selected_fields(), Eq(""));
+            return MakeTestTable();
+          });
+
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_), DefaultOptions({}));
+
+  google::cloud::bigquery::v2::GetTableRequest request;
+  request.set_project_id("my-project");
+  request.set_dataset_id("my-dataset");
+  request.set_table_id("my-table");
+  auto full = connection_impl.GetArrowSchema(request, {});
+  ASSERT_STATUS_OK(full);
+  EXPECT_TRUE((*full)->Equals(*arrow::schema(
+      {arrow::field("id", arrow::int64(), false),
+       arrow::field("name", arrow::utf8())})));
+
+  request.set_selected_fields("name");
+  auto selected = connection_impl.GetArrowSchema(request, {});
+  ASSERT_STATUS_OK(selected);
+  EXPECT_TRUE((*selected)->Equals(
+      *arrow::schema({arrow::field("name", arrow::utf8())})));
+
+  // The field names are case-insensitive, the schema keeps the table names.
+  request.set_selected_fields("NAME");
+  selected = connection_impl.GetArrowSchema(request, {});
+  ASSERT_STATUS_OK(selected);
+  EXPECT_TRUE((*selected)->Equals(
+      *arrow::schema({arrow::field("name", arrow::utf8())})));
+}
+
+TEST_F(ConnectionImplTest, GetArrowSchemaCacheDisabled) {
+  EXPECT_CALL(*mock_table_connection_, GetTable)
+      .WillOnce(Return(MakeTestTable()))
+      .WillOnce(Return(internal::NotFoundError("uh-oh")));
+
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_),
+      DefaultOptions(Options{}.set<bigquery_unified::TableSchemaCacheTtlOption>(
+          std::chrono::milliseconds(0))));
+
+  google::cloud::bigquery::v2::GetTableRequest request;
+  request.set_table_id("my-table");
+  ASSERT_STATUS_OK(connection_impl.GetArrowSchema(request, {}));
+  EXPECT_THAT(connection_impl.GetArrowSchema(request, {}),
+              StatusIs(StatusCode::kNotFound));
+}
+
+TEST_F(ConnectionImplTest, GetArrowSchemaCacheSizeZero) {
+  EXPECT_CALL(*mock_table_connection_, GetTable)
+      .WillOnce(Return(MakeTestTable()))
+      .WillOnce(Return(internal::NotFoundError("uh-oh")));
+
+  auto connection_impl = ConnectionImpl(
+      mock_read_connection_, mock_job_connection_, mock_table_connection_, {},
+      {}, {}, mock_job_stub_, std::move(mock_background_),
+      DefaultOptions(
+          Options{}.set<bigquery_unified::TableSchemaCacheSizeOption>(0)));
+
+  google::cloud::bigquery::v2::GetTableRequest request;
+  request.set_table_id("my-table");
+  ASSERT_STATUS_OK(connection_impl.GetArrowSchema(request, {}));
+  EXPECT_THAT(connection_impl.GetArrowSchema(request, {}),
+              StatusIs(StatusCode::kNotFound));
+}
+
 }  // namespace
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
 }  // namespace google::cloud::bigquery_unified_internal
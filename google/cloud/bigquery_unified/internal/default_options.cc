@@ -13,8 +13,10 @@
 // limitations under the License.
 
 #include "google/cloud/bigquery_unified/internal/default_options.h"
+#include "google/cloud/bigquery_unified/connection_options.h"
 #include "google/cloud/bigquery_unified/idempotency_policy.h"
 #include "google/cloud/bigquery_unified/job_options.h"
+#include "google/cloud/bigquery_unified/read_options.h"
 #include "google/cloud/bigquery_unified/retry_policy.h"
 #include "google/cloud/backoff_policy.h"
 #include "google/cloud/polling_policy.h"
@@ -24,6 +26,22 @@ GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
 
 namespace {
 auto constexpr kBackoffScaling = 2.0;
+// Below this many rows the latency of setting up additional streams dominates
+// any gain in throughput.
+auto constexpr kDefaultSingleStreamRowThreshold = 100000;
+// Read sessions last about 6 hours, leave ample time to read a reused session.
+auto constexpr kDefaultReadSessionCacheExpiryMargin = std::chrono::hours(1);
+// The service default for the `timeoutMs` of `jobs.getQueryResults`.
+auto constexpr kDefaultJobLongPollTimeout = std::chrono::seconds(10);
+// A single `jobs.list` call per project and period polls all the watched jobs.
+auto constexpr kDefaultJobWatchPeriod = std::chrono::seconds(1);
+auto constexpr kDefaultTableSchemaCacheTtl = std::chrono::minutes(5);
+auto constexpr kDefaultTableSchemaCacheSize = 1000;
+// Dashboards typically refresh every few minutes.
+auto constexpr kDefaultQueryCacheTtl = std::chrono::minutes(5);
+// The concurrent RPCs are I/O bound, so this is independent of the number of
+// cores.
+auto constexpr kDefaultMaxConcurrentRpcs = 16;
 }  // namespace
 
 google::cloud::Options DefaultOptions(google::cloud::Options options) {
@@ -53,6 +71,44 @@ google::cloud::Options DefaultOptions(google::cloud::Options options) {
     options.set<bigquery_unified::IdempotencyPolicyOption>(
         bigquery_unified::MakeDefaultIdempotencyPolicy());
   }
+  if (!options.has<bigquery_unified::JobCompletionStrategyOption>()) {
+    options.set<bigquery_unified::JobCompletionStrategyOption>(
+        bigquery_unified::JobCompletionStrategy::kLongPoll);
+  }
+  if (!options.has<bigquery_unified::JobLongPollTimeoutOption>()) {
+    options.set<bigquery_unified::JobLongPollTimeoutOption>(
+        kDefaultJobLongPollTimeout);
+  }
+  if (!options.has<bigquery_unified::JobWatchPeriodOption>()) {
+    options.set<bigquery_unified::JobWatchPeriodOption>(kDefaultJobWatchPeriod);
+  }
+  if (!options.has<bigquery_unified::QueryCacheTtlOption>()) {
+    options.set<bigquery_unified::QueryCacheTtlOption>(kDefaultQueryCacheTtl);
+  }
+  if (!options.has<bigquery_unified::ReadStrategyOption>()) {
+    options.set<bigquery_unified::ReadStrategyOption>(
+        bigquery_unified::ReadStrategy::kAuto);
+  }
+  if (!options.has<bigquery_unified::SingleStreamRowThresholdOption>()) {
+    options.set<bigquery_unified::SingleStreamRowThresholdOption>(
+        kDefaultSingleStreamRowThreshold);
+  }
+  if (!options.has<bigquery_unified::ReadSessionCacheExpiryMarginOption>()) {
+    options.set<bigquery_unified::ReadSessionCacheExpiryMarginOption>(
+        kDefaultReadSessionCacheExpiryMargin);
+  }
+  if (!options.has<bigquery_unified::TableSchemaCacheTtlOption>()) {
+    options.set<bigquery_unified::TableSchemaCacheTtlOption>(
+        kDefaultTableSchemaCacheTtl);
+  }
+  if (!options.has<bigquery_unified::TableSchemaCacheSizeOption>()) {
+    options.set<bigquery_unified::TableSchemaCacheSizeOption>(
+        kDefaultTableSchemaCacheSize);
+  }
+  if (!options.has<bigquery_unified::MaxConcurrentRpcsOption>()) {
+    options.set<bigquery_unified::MaxConcurrentRpcsOption>(
+        kDefaultMaxConcurrentRpcs);
+  }
 
   return options;
 }
@@ -13,7 +13,9 @@
 // limitations under the License.
 
 #include "google/cloud/bigquery_unified/internal/default_options.h"
+#include "google/cloud/bigquery_unified/connection_options.h"
 #include "google/cloud/bigquery_unified/job_options.h"
+#include "google/cloud/bigquery_unified/read_options.h"
 #include "google/cloud/bigquery_unified/version.h"
 #include <gmock/gmock.h>
 
@@ -28,6 +30,21 @@ TEST(BigQueryUnifiedDefaultOptionsTest, AllOptionsDefaulted) {
   EXPECT_TRUE(options_result.has<bigquery_unified::BackoffPolicyOption>());
   EXPECT_TRUE(options_result.has<bigquery_unified::PollingPolicyOption>());
   EXPECT_TRUE(options_result.has<bigquery_unified::IdempotencyPolicyOption>());
+  EXPECT_TRUE(
+      options_result.has<bigquery_unified::JobCompletionStrategyOption>());
+  EXPECT_TRUE(options_result.has<bigquery_unified::JobLongPollTimeoutOption>());
+  EXPECT_TRUE(options_result.has<bigquery_unified::JobWatchPeriodOption>());
+  EXPECT_TRUE(options_result.has<bigquery_unified::QueryCacheTtlOption>());
+  EXPECT_TRUE(options_result.has<bigquery_unified::ReadStrategyOption>());
+  EXPECT_TRUE(
+      options_result.has<bigquery_unified::SingleStreamRowThresholdOption>());
+  EXPECT_TRUE(options_result
+                  .has<bigquery_unified::ReadSessionCacheExpiryMarginOption>());
+  EXPECT_TRUE(
+      options_result.has<bigquery_unified::TableSchemaCacheTtlOption>());
+  EXPECT_TRUE(
+      options_result.has<bigquery_unified::TableSchemaCacheSizeOption>());
+  EXPECT_TRUE(options_result.has<bigquery_unified::MaxConcurrentRpcsOption>());
 }
 
 }  // namespace
@@ -0,0 +1,70 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/job_long_poll.h"
+#include "google/cloud/internal/rest_context.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+std::unique_ptr<PollingPolicy> LongPollPollingPolicy::clone() const {
+  return std::make_unique<LongPollPollingPolicy>(impl_->clone(), skip_wait_,
+                                                 long_poll_timeout_);
+}
+
+bool LongPollPollingPolicy::OnFailure(Status const& status) {
+  return impl_->OnFailure(status);
+}
+
+std::chrono::milliseconds LongPollPollingPolicy::WaitPeriod() {
+  auto const wait = impl_->WaitPeriod();
+  if (!skip_wait_->exchange(false)) return wait;
+  return std::max(wait - long_poll_timeout_, std::chrono::milliseconds(0));
+}
+
+StatusOr<google::cloud::bigquery::v2::Job> LongPollJob(
+    bigquerycontrol_v2_internal::JobServiceRestStub& stub,
+    std::atomic<bool>& skip_wait, std::chrono::milliseconds timeout,
+    Options const& options,
+    google::cloud::bigquery::v2::GetJobRequest const& request) {
+  auto constexpr kMaxTimeout = std::numeric_limits<std::uint32_t>::max();
+  google::cloud::bigquery::v2::GetQueryResultsRequest query_results_request;
+  query_results_request.set_project_id(request.project_id());
+  query_results_request.set_job_id(request.job_id());
+  query_results_request.set_location(request.location());
+  query_results_request.mutable_max_results()->set_value(0);
+  query_results_request.mutable_timeout_ms()->set_value(
+      static_cast<std::uint32_t>(std::min<std::chrono::milliseconds::rep>(
+          std::max<std::chrono::milliseconds::rep>(timeout.count(), 0),
+          kMaxTimeout)));
+
+  rest_internal::RestContext query_results_context;
+  auto response = stub.GetQueryResults(query_results_context, options,
+                                       query_results_request);
+  if (response && !response->job_complete().value()) {
+    skip_wait = true;
+    google::cloud::bigquery::v2::Job job;
+    *job.mutable_job_reference() = response->job_reference();
+    job.mutable_status()->set_state("RUNNING");
+    return job;
+  }
+  rest_internal::RestContext context;
+  return stub.GetJob(context, options, request);
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,83 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_JOB_LONG_POLL_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_JOB_LONG_POLL_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/bigquerycontrol/v2/internal/job_rest_stub.h"
+#include "google/cloud/options.h"
+#include "google/cloud/polling_policy.h"
+#include "google/cloud/status_or.h"
+#include <google/cloud/bigquery/v2/job.pb.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Decorates a polling policy to count the time waited by a long poll.
+ *
+ * A long poll already waited in the service for up to `long_poll_timeout`, so
+ * the next wait is shortened by that time. While the backoff of the decorated
+ * policy is shorter than the long poll, the next poll starts immediately. Once
+ * it is longer, the polls are no more frequent than without long polls. The
+ * poll sets `skip_wait` when it returns from a long poll, and the next
+ * `WaitPeriod()` consumes it. Failed polls, and polls that could not use a
+ * long poll, do not set it, so they use the backoff of the decorated policy.
+ *
+ * Polling loops may clone the policy they are given and use the clone, so the
+ * clones share `skip_wait` with the original.
+ */
+class LongPollPollingPolicy : public PollingPolicy {
+ public:
+  LongPollPollingPolicy(std::unique_ptr<PollingPolicy> impl,
+                        std::shared_ptr<std::atomic<bool>> skip_wait,
+                        std::chrono::milliseconds long_poll_timeout)
+      : impl_(std::move(impl)),
+        skip_wait_(std::move(skip_wait)),
+        long_poll_timeout_(long_poll_timeout) {}
+
+  std::unique_ptr<PollingPolicy> clone() const override;
+  bool OnFailure(Status const& status) override;
+  std::chrono::milliseconds WaitPeriod() override;
+
+ private:
+  std::unique_ptr<PollingPolicy> impl_;
+  std::shared_ptr<std::atomic<bool>> skip_wait_;
+  std::chrono::milliseconds long_poll_timeout_;
+};
+
+/**
+ * Polls a query job using `jobs.getQueryResults` with a server-side timeout.
+ *
+ * The call returns as soon as the job completes, or after @p timeout. No rows
+ * are requested. While the job is running this returns a placeholder job with
+ * the `RUNNING` state and sets @p skip_wait. Once the job completes, or if the
+ * long poll fails, this returns the result of `jobs.get`, which has the final
+ * status and statistics of the job. Note that `jobs.getQueryResults` fails
+ * for jobs that completed with an error.
+ */
+StatusOr<google::cloud::bigquery::v2::Job> LongPollJob(
+    bigquerycontrol_v2_internal::JobServiceRestStub& stub,
+    std::atomic<bool>& skip_wait, std::chrono::milliseconds timeout,
+    Options const& options,
+    google::cloud::bigquery::v2::GetJobRequest const& request);
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_JOB_LONG_POLL_H
@@ -0,0 +1,85 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/job_long_poll.h"
+#include <gmock/gmock.h>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::testing::Eq;
+using ::testing::Return;
+
+class MockPollingPolicy : public PollingPolicy {
+ public:
+  MOCK_METHOD(std::unique_ptr<PollingPolicy>, clone, (), (const, override));
+  MOCK_METHOD(bool, OnFailure, (Status const&), (override));
+  MOCK_METHOD(std::chrono::milliseconds, WaitPeriod, (), (override));
+};
+
+TEST(LongPollPollingPolicy, SkipsWaitAfterLongPoll) {
+  auto mock = std::make_unique<MockPollingPolicy>();
+  EXPECT_CALL(*mock, WaitPeriod)
+      .WillOnce(Return(std::chrono::milliseconds(1000)))
+      .WillOnce(Return(std::chrono::milliseconds(1000)))
+      .WillOnce(Return(std::chrono::milliseconds(1000)));
+  EXPECT_CALL(*mock, OnFailure).WillOnce(Return(true));
+
+  auto skip_wait = std::make_shared<std::atomic<bool>>(true);
+  LongPollPollingPolicy policy(std::move(mock), skip_wait,
+                               std::chrono::seconds(10));
+  EXPECT_THAT(policy.WaitPeriod(), Eq(std::chrono::milliseconds(0)));
+  EXPECT_FALSE(skip_wait->load());
+  EXPECT_TRUE(policy.OnFailure(Status{}));
+  EXPECT_THAT(policy.WaitPeriod(), Eq(std::chrono::milliseconds(1000)));
+
+  *skip_wait = true;
+  EXPECT_THAT(policy.WaitPeriod(), Eq(std::chrono::milliseconds(0)));
+}
+
+TEST(LongPollPollingPolicy, LongBackoffCountsLongPoll) {
+  auto mock = std::make_unique<MockPollingPolicy>();
+  EXPECT_CALL(*mock, WaitPeriod)
+      .WillOnce(Return(std::chrono::milliseconds(60000)));
+
+  auto skip_wait = std::make_shared<std::atomic<bool>>(true);
+  LongPollPollingPolicy policy(std::move(mock), skip_wait,
+                               std::chrono::seconds(10));
+  // The long poll already waited 10 seconds of the 60 second backoff.
+  EXPECT_THAT(policy.WaitPeriod(), Eq(std::chrono::milliseconds(50000)));
+}
+
+TEST(LongPollPollingPolicy, Clone) {
+  auto mock = std::make_unique<MockPollingPolicy>();
+  EXPECT_CALL(*mock, clone).WillOnce([]() -> std::unique_ptr<PollingPolicy> {
+    auto clone = std::make_unique<MockPollingPolicy>();
+    EXPECT_CALL(*clone, WaitPeriod)
+        .WillRepeatedly(Return(std::chrono::milliseconds(1000)));
+    return clone;
+  });
+
+  auto skip_wait = std::make_shared<std::atomic<bool>>(true);
+  LongPollPollingPolicy policy(std::move(mock), skip_wait,
+                               std::chrono::seconds(10));
+  // The clone is still linked to the long polls.
+  auto clone = policy.clone();
+  EXPECT_THAT(clone->WaitPeriod(), Eq(std::chrono::milliseconds(0)));
+  EXPECT_FALSE(skip_wait->load());
+  EXPECT_THAT(clone->WaitPeriod(), Eq(std::chrono::milliseconds(1000)));
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
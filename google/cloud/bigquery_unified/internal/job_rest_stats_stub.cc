@@ -0,0 +1,102 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/job_rest_stats_stub.h"
+#include <utility>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+JobServiceRestStatsStub::JobServiceRestStatsStub(
+    std::shared_ptr<bigquerycontrol_v2_internal::JobServiceRestStub> child,
+    std::shared_ptr<bigquery_unified::RestConnectionStats> stats)
+    : child_(std::move(child)), stats_(std::move(stats)) {}
+
+StatusOr<google::cloud::bigquery::v2::JobCancelResponse>
+JobServiceRestStatsStub::CancelJob(
+    google::cloud::rest_internal::RestContext& rest_context,
+    Options const& options,
+    google::cloud::bigquery::v2::CancelJobRequest const& request) {
+  auto result = child_->CancelJob(rest_context, options, request);
+  Record(rest_context);
+  return result;
+}
+
+StatusOr<google::cloud::bigquery::v2::Job> JobServiceRestStatsStub::GetJob(
+    google::cloud::rest_internal::RestContext& rest_context,
+    Options const& options,
+    google::cloud::bigquery::v2::GetJobRequest const& request) {
+  auto result = child_->GetJob(rest_context, options, request);
+  Record(rest_context);
+  return result;
+}
+
+StatusOr<google::cloud::bigquery::v2::Job> JobServiceRestStatsStub::InsertJob(
+    google::cloud::rest_internal::RestContext& rest_context,
+    Options const& options,
+    google::cloud::bigquery::v2::InsertJobRequest const& request) {
+  auto result = child_->InsertJob(rest_context, options, request);
+  Record(rest_context);
+  return result;
+}
+
+Status JobServiceRestStatsStub::DeleteJob(
+    google::cloud::rest_internal::RestContext& rest_context,
+    Options const& options,
+    google::cloud::bigquery::v2::DeleteJobRequest const& request) {
+  auto result = child_->DeleteJob(rest_context, options, request);
+  Record(rest_context);
+  return result;
+}
+
+StatusOr<google::cloud::bigquery::v2::JobList>
+JobServiceRestStatsStub::ListJobs(
+    google::cloud::rest_internal::RestContext& rest_context,
+    Options const& options,
+    google::cloud::bigquery::v2::ListJobsRequest const& request) {
+  auto result = child_->ListJobs(rest_context, options, request);
+  Record(rest_context);
+  return result;
+}
+
+StatusOr<google::cloud::bigquery::v2::GetQueryResultsResponse>
+JobServiceRestStatsStub::GetQueryResults(
+    google::cloud::rest_internal::RestContext& rest_context,
+    Options const& options,
+    google::cloud::bigquery::v2::GetQueryResultsRequest const& request) {
+  auto result = child_->GetQueryResults(rest_context, options, request);
+  Record(rest_context);
+  return result;
+}
+
+StatusOr<google::cloud::bigquery::v2::QueryResponse>
+JobServiceRestStatsStub::Query(
+    google::cloud::rest_internal::RestContext& rest_context,
+    Options const& options,
+    google::cloud::bigquery::v2::PostQueryRequest const& request) {
+  auto result = child_->Query(rest_context, options, request);
+  Record(rest_context);
+  return result;
+}
+
+void JobServiceRestStatsStub::Record(
+    google::cloud::rest_internal::RestContext const& rest_context) {
+  auto const connect_time = rest_context.connect_time();
+  if (!connect_time) return;
+  ++stats_->requests;
+  if (connect_time->count() != 0) ++stats_->new_connections;
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,88 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_JOB_REST_STATS_STUB_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_JOB_REST_STATS_STUB_H
+
+#include "google/cloud/bigquery_unified/rest_connection_stats.h"
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/bigquerycontrol/v2/internal/job_rest_stub.h"
+#include <memory>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Counts the requests of the job service stub, and the new connections they
+ * open.
+ *
+ * The HTTP library reports a zero connect time for a request that reuses a
+ * pooled connection, and no connect time for a request that never connected.
+ */
+class JobServiceRestStatsStub
+    : public bigquerycontrol_v2_internal::JobServiceRestStub {
+ public:
+  JobServiceRestStatsStub(
+      std::shared_ptr<bigquerycontrol_v2_internal::JobServiceRestStub> child,
+      std::shared_ptr<bigquery_unified::RestConnectionStats> stats);
+  ~JobServiceRestStatsStub() override = default;
+
+  StatusOr<google::cloud::bigquery::v2::JobCancelResponse> CancelJob(
+      google::cloud::rest_internal::RestContext& rest_context,
+      Options const& options,
+      google::cloud::bigquery::v2::CancelJobRequest const& request) override;
+
+  StatusOr<google::cloud::bigquery::v2::Job> GetJob(
+      google::cloud::rest_internal::RestContext& rest_context,
+      Options const& options,
+      google::cloud::bigquery::v2::GetJobRequest const& request) override;
+
+  StatusOr<google::cloud::bigquery::v2::Job> InsertJob(
+      google::cloud::rest_internal::RestContext& rest_context,
+      Options const& options,
+      google::cloud::bigquery::v2::InsertJobRequest const& request) override;
+
+  Status DeleteJob(
+      google::cloud::rest_internal::RestContext& rest_context,
+      Options const& options,
+      google::cloud::bigquery::v2::DeleteJobRequest const& request) override;
+
+  StatusOr<google::cloud::bigquery::v2::JobList> ListJobs(
+      google::cloud::rest_internal::RestContext& rest_context,
+      Options const& options,
+      google::cloud::bigquery::v2::ListJobsRequest const& request) override;
+
+  StatusOr<google::cloud::bigquery::v2::GetQueryResultsResponse>
+  GetQueryResults(
+      google::cloud::rest_internal::RestContext& rest_context,
+      Options const& options,
+      google::cloud::bigquery::v2::GetQueryResultsRequest const& request)
+      override;
+
+  StatusOr<google::cloud::bigquery::v2::QueryResponse> Query(
+      google::cloud::rest_internal::RestContext& rest_context,
+      Options const& options,
+      google::cloud::bigquery::v2::PostQueryRequest const& request) override;
+
+ private:
+  void Record(google::cloud::rest_internal::RestContext const& rest_context);
+
+  std::shared_ptr<bigquerycontrol_v2_internal::JobServiceRestStub> child_;
+  std::shared_ptr<bigquery_unified::RestConnectionStats> stats_;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_JOB_REST_STATS_STUB_H
@@ -0,0 +1,72 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/job_rest_stats_stub.h"
+#include "google/cloud/bigquery_unified/testing_util/status_matchers.h"
+#include "google/cloud/internal/make_status.h"
+#include <gmock/gmock.h>
+#include <chrono>
+#include <memory>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery_unified::testing_util::IsOk;
+using ::google::cloud::bigquery_unified::testing_util::StatusIs;
+using ::testing::Return;
+
+class MockJobServiceRestStub
+    : public bigquerycontrol_v2_internal::JobServiceRestStub {
+ public:
+  MOCK_METHOD(StatusOr<google::cloud::bigquery::v2::Job>, GetJob,
+              (google::cloud::rest_internal::RestContext & rest_context,
+               Options const& options,
+               google::cloud::bigquery::v2::GetJobRequest const& request),
+              (override));
+};
+
+TEST(JobServiceRestStatsStubTest, CountsNewConnections) {
+  auto mock = std::make_shared<MockJobServiceRestStub>();
+  EXPECT_CALL(*mock, GetJob)
+      .WillOnce([](rest_internal::RestContext& context, Options const&,
+                   google::cloud::bigquery::v2::GetJobRequest const&) {
+        context.set_connect_time(std::chrono::microseconds(1500));
+        return google::cloud::bigquery::v2::Job{};
+      })
+      .WillOnce([](rest_internal::RestContext& context, Options const&,
+                   google::cloud::bigquery::v2::GetJobRequest const&) {
+        context.set_connect_time(std::chrono::microseconds(0));
+        return google::cloud::bigquery::v2::Job{};
+      })
+      // A request that never connected is not counted.
+      .WillOnce(Return(internal::UnavailableError("try-again")));
+
+  auto stats = std::make_shared<bigquery_unified::RestConnectionStats>();
+  JobServiceRestStatsStub stub(mock, stats);
+  rest_internal::RestContext c1;
+  EXPECT_THAT(stub.GetJob(c1, Options{}, {}), IsOk());
+  rest_internal::RestContext c2;
+  EXPECT_THAT(stub.GetJob(c2, Options{}, {}), IsOk());
+  rest_internal::RestContext c3;
+  EXPECT_THAT(stub.GetJob(c3, Options{}, {}),
+              StatusIs(StatusCode::kUnavailable));
+
+  EXPECT_EQ(stats->requests.load(), 2U);
+  EXPECT_EQ(stats->new_connections.load(), 1U);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
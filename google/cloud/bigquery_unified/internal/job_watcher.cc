@@ -0,0 +1,279 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/job_watcher.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/internal/rest_context.h"
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <vector>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+namespace {
+
+// The number of jobs in each page of `jobs.list`, the maximum of the service.
+auto constexpr kListJobsPageSize = 1000;
+
+// The maximum number of pages listed in each poll of a project. The older
+// watched jobs may be far down the list if many jobs completed since they were
+// created, those jobs are checked with `jobs.get` instead.
+auto constexpr kMaxListJobsPages = 10;
+
+// The number of polls before a job that is not listed as completed is checked
+// with `jobs.get`. Jobs created by other principals are never listed.
+auto constexpr kMaxUncheckedPolls = 10;
+
+struct DoneJobs {
+  // The watched jobs found in the list of completed jobs.
+  std::set<std::string> found;
+  // True if the listing stopped at the page limit. The watched jobs not found
+  // may be completed too.
+  bool truncated = false;
+};
+
+// Lists the completed jobs in @p project_id created at or after
+// @p min_creation_time (in milliseconds since the epoch), until all the jobs
+// in @p watched are found, or up to `kMaxListJobsPages` pages.
+StatusOr<DoneJobs> ListDoneJobs(
+    bigquerycontrol_v2_internal::JobServiceRestStub& stub,
+    Options const& options, std::string const& project_id,
+    std::int64_t min_creation_time, std::set<std::string> const& watched) {
+  google::cloud::bigquery::v2::ListJobsRequest request;
+  request.set_project_id(project_id);
+  request.set_min_creation_time(
+      static_cast<std::uint64_t>(std::max<std::int64_t>(min_creation_time, 0)));
+  request.mutable_max_results()->set_value(kListJobsPageSize);
+  request.set_projection(google::cloud::bigquery::v2::ListJobsRequest::MINIMAL);
+  request.add_state_filter(google::cloud::bigquery::v2::ListJobsRequest::DONE);
+
+  DoneJobs done;
+  for (auto page = 1;; ++page) {
+    rest_internal::RestContext context;
+    auto list = stub.ListJobs(context, options, request);
+    if (!list) return std::move(list).status();
+    for (auto const& job : list->jobs()) {
+      auto const& job_id = job.job_reference().job_id();
+      if (watched.count(job_id) != 0) done.found.insert(job_id);
+    }
+    if (done.found.size() == watched.size() ||
+        list->next_page_token().empty()) {
+      return done;
+    }
+    if (page == kMaxListJobsPages) {
+      done.truncated = true;
+      return done;
+    }
+    request.set_page_token(list->next_page_token());
+  }
+}
+
+}  // namespace
+
+future<StatusOr<google::cloud::bigquery::v2::Job>> JobWatcher::Watch(
+    CompletionQueue cq, google::cloud::bigquery::v2::Job const& job,
+    std::shared_ptr<Options const> options,
+    std::unique_ptr<PollingPolicy> polling_policy) {
+  Key key{job.job_reference().project_id(), job.job_reference().job_id()};
+  auto w = std::weak_ptr<JobWatcher>(shared_from_this());
+  promise<StatusOr<google::cloud::bigquery::v2::Job>> p([w, key] {
+    if (auto self = w.lock()) self->Cancel(key);
+  });
+  auto f = p.get_future();
+
+  std::unique_lock<std::mutex> lk(mu_);
+  waiters_.emplace(
+      std::move(key),
+      Waiter{job.job_reference().location().value(),
+             job.statistics().creation_time(), std::move(options),
+             std::move(polling_policy), std::move(p)});
+  if (running_) return f;
+  cq_ = std::move(cq);
+  StartTimer(std::move(lk));
+  return f;
+}
+
+std::size_t JobWatcher::size() const {
+  std::lock_guard<std::mutex> lk(mu_);
+  return waiters_.size();
+}
+
+void JobWatcher::StartTimer(std::unique_lock<std::mutex> lk) {
+  running_ = true;
+  auto cq = cq_;
+  lk.unlock();
+  auto self = shared_from_this();
+  cq.MakeRelativeTimer(period_).then(
+      [self](future<StatusOr<std::chrono::system_clock::time_point>> f) {
+        self->OnTimer(f.get().status());
+      });
+}
+
+void JobWatcher::OnTimer(Status const& status) {
+  if (status.ok()) {
+    auto self = shared_from_this();
+    return executor_->Schedule([self] { self->Poll(); });
+  }
+  // The completion queue is shutting down, no more polls are possible.
+  std::multimap<Key, Waiter> waiters;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    waiters.swap(waiters_);
+    running_ = false;
+  }
+  for (auto& kv : waiters) kv.second.done.set_value(status);
+}
+
+void JobWatcher::Poll() {
+  std::set<std::string> projects;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    for (auto const& kv : waiters_) projects.insert(kv.first.first);
+  }
+  for (auto const& project_id : projects) PollProject(project_id);
+
+  std::unique_lock<std::mutex> lk(mu_);
+  if (waiters_.empty()) {
+    running_ = false;
+    return;
+  }
+  StartTimer(std::move(lk));
+}
+
+void JobWatcher::PollProject(std::string const& project_id) {
+  auto min_creation_time = std::numeric_limits<std::int64_t>::max();
+  std::shared_ptr<Options const> options;
+  struct Polled {
+    std::string location;
+    // Check the job with `jobs.get` even if it is not listed.
+    bool check = false;
+  };
+  std::map<Key, Polled> jobs;
+  std::set<std::string> watched;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    for (auto i = waiters_.lower_bound(Key{project_id, {}});
+         i != waiters_.end() && i->first.first == project_id; ++i) {
+      min_creation_time = std::min(min_creation_time, i->second.creation_time);
+      options = i->second.options;
+      auto& polled = jobs[i->first];
+      polled.location = i->second.location;
+      polled.check = polled.check ||
+                     i->second.unchecked_polls + 1 >= kMaxUncheckedPolls;
+      watched.insert(i->first.second);
+    }
+  }
+  if (!options) return;
+
+  auto done = ListDoneJobs(*stub_, *options, project_id, min_creation_time,
+                           watched);
+  for (auto const& kv : jobs) {
+    if (!done) {
+      OnNotDone(kv.first, done.status());
+      continue;
+    }
+    // If the list is truncated, check the jobs not found with `jobs.get`.
+    auto const check = done->truncated || kv.second.check ||
+                       done->found.count(kv.first.second) != 0;
+    CountPoll(kv.first, check);
+    if (!check) {
+      OnNotDone(kv.first, Status{});
+      continue;
+    }
+    google::cloud::bigquery::v2::GetJobRequest request;
+    request.set_project_id(kv.first.first);
+    request.set_job_id(kv.first.second);
+    request.set_location(kv.second.location);
+    rest_internal::RestContext context;
+    auto job = stub_->GetJob(context, *options, request);
+    if (job && job->status().state() == "DONE") {
+      Complete(kv.first, *job);
+      continue;
+    }
+    OnNotDone(kv.first, job.status());
+  }
+}
+
+void JobWatcher::Complete(Key const& key,
+                          google::cloud::bigquery::v2::Job const& job) {
+  std::vector<Waiter> completed;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto range = waiters_.equal_range(key);
+    for (auto i = range.first; i != range.second; ++i) {
+      completed.push_back(std::move(i->second));
+    }
+    waiters_.erase(range.first, range.second);
+  }
+  for (auto& w : completed) w.done.set_value(job);
+}
+
+void JobWatcher::OnNotDone(Key const& key, Status const& status) {
+  std::vector<Waiter> expired;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto range = waiters_.equal_range(key);
+    for (auto i = range.first; i != range.second;) {
+      // Update the polling policy even on successful requests, so we can stop
+      // after too many polling attempts.
+      if (i->second.polling_policy->OnFailure(status)) {
+        ++i;
+        continue;
+      }
+      expired.push_back(std::move(i->second));
+      i = waiters_.erase(i);
+    }
+  }
+  for (auto& w : expired) {
+    if (!status.ok()) {
+      w.done.set_value(status);
+      continue;
+    }
+    w.done.set_value(internal::DeadlineExceededError(
+        "JobPoll() - polling loop terminated by polling policy",
+        GCP_ERROR_INFO()));
+  }
+}
+
+void JobWatcher::CountPoll(Key const& key, bool checked) {
+  std::lock_guard<std::mutex> lk(mu_);
+  auto range = waiters_.equal_range(key);
+  for (auto i = range.first; i != range.second; ++i) {
+    i->second.unchecked_polls = checked ? 0 : i->second.unchecked_polls + 1;
+  }
+}
+
+void JobWatcher::Cancel(Key const& key) {
+  google::cloud::bigquery::v2::CancelJobRequest request;
+  std::shared_ptr<Options const> options;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto i = waiters_.find(key);
+    if (i == waiters_.end()) return;
+    request.set_project_id(key.first);
+    request.set_job_id(key.second);
+    request.set_location(i->second.location);
+    options = i->second.options;
+  }
+  // Cancels are best effort, the job is still watched until it completes.
+  executor_->Schedule([stub = stub_, options = std::move(options), request] {
+    rest_internal::RestContext context;
+    (void)stub->CancelJob(context, *options, request);
+  });
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,122 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_JOB_WATCHER_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_JOB_WATCHER_H
+
+#include "google/cloud/bigquery_unified/internal/blocking_executor.h"
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/bigquerycontrol/v2/internal/job_rest_stub.h"
+#include "google/cloud/completion_queue.h"
+#include "google/cloud/future.h"
+#include "google/cloud/options.h"
+#include "google/cloud/polling_policy.h"
+#include "google/cloud/status_or.h"
+#include <google/cloud/bigquery/v2/job.pb.h>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Waits for the completion of many jobs with a single polling loop.
+ *
+ * Polling each job separately makes one `jobs.get` call per job and poll,
+ * which quickly exhausts the API quota when thousands of jobs run at the same
+ * time. Instead, every @p period this class lists the completed jobs of each
+ * project with a single paginated `jobs.list` call, starting from the
+ * creation time of the oldest watched job in the project. The listing stops
+ * once all the watched jobs are found, or after a few pages. It then calls
+ * `jobs.get` only for the watched jobs found in the list, or not found before
+ * the listing stopped, to return their final status and statistics.
+ *
+ * `jobs.list` only returns the jobs created by the current principal. The
+ * jobs created by others, e.g. jobs awaited by reference, are never listed, so
+ * a job not listed for several polls is checked with `jobs.get`, and again
+ * after the same number of polls while it runs.
+ *
+ * Each watched job keeps its own polling policy. Every poll that does not
+ * find the job completed counts as a failed attempt, so the policy still
+ * bounds the time spent waiting for each job.
+ *
+ * The RPCs block, so they run on @p executor. The polling loop only runs
+ * while there are jobs to watch.
+ */
+class JobWatcher : public std::enable_shared_from_this<JobWatcher> {
+ public:
+  JobWatcher(std::shared_ptr<bigquerycontrol_v2_internal::JobServiceRestStub>
+                 stub,
+             std::shared_ptr<BlockingExecutor> executor,
+             std::chrono::milliseconds period)
+      : stub_(std::move(stub)),
+        executor_(std::move(executor)),
+        period_(period) {}
+
+  /**
+   * Returns a future satisfied when @p job completes.
+   *
+   * Cancelling the future requests the cancellation of the job, the future is
+   * satisfied once the job completes.
+   */
+  future<StatusOr<google::cloud::bigquery::v2::Job>> Watch(
+      CompletionQueue cq, google::cloud::bigquery::v2::Job const& job,
+      std::shared_ptr<Options const> options,
+      std::unique_ptr<PollingPolicy> polling_policy);
+
+  /// The number of jobs being watched.
+  std::size_t size() const;
+
+ private:
+  struct Waiter {
+    std::string location;
+    std::int64_t creation_time;
+    std::shared_ptr<Options const> options;
+    std::unique_ptr<PollingPolicy> polling_policy;
+    promise<StatusOr<google::cloud::bigquery::v2::Job>> done;
+    // The polls since the job was last checked with `jobs.get`.
+    int unchecked_polls = 0;
+  };
+  // Watched jobs are identified by their project and job ids.
+  using Key = std::pair<std::string, std::string>;
+
+  void StartTimer(std::unique_lock<std::mutex> lk);
+  void OnTimer(Status const& status);
+  void Poll();
+  void PollProject(std::string const& project_id);
+  void Complete(Key const& key, google::cloud::bigquery::v2::Job const& job);
+  void OnNotDone(Key const& key, Status const& status);
+  // Counts a poll of @p key, which was checked with `jobs.get` if @p checked.
+  void CountPoll(Key const& key, bool checked);
+  void Cancel(Key const& key);
+
+  std::shared_ptr<bigquerycontrol_v2_internal::JobServiceRestStub> stub_;
+  std::shared_ptr<BlockingExecutor> executor_;
+  std::chrono::milliseconds period_;
+
+  mutable std::mutex mu_;
+  CompletionQueue cq_;                  // GUARDED_BY(mu_)
+  bool running_ = false;                // GUARDED_BY(mu_)
+  std::multimap<Key, Waiter> waiters_;  // GUARDED_BY(mu_)
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_JOB_WATCHER_H
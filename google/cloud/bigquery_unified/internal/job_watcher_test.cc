@@ -0,0 +1,276 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/job_watcher.h"
+#include "google/cloud/bigquery_unified/testing_util/status_matchers.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/internal/rest_background_threads_impl.h"
+#include <gmock/gmock.h>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery::v2::GetJobRequest;
+using ::google::cloud::bigquery::v2::Job;
+using ::google::cloud::bigquery::v2::JobList;
+using ::google::cloud::bigquery::v2::ListJobsRequest;
+using ::google::cloud::bigquery_unified::testing_util::StatusIs;
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::Return;
+
+class MockJobServiceRestStub
+    : public google::cloud::bigquerycontrol_v2_internal::JobServiceRestStub {
+ public:
+  MOCK_METHOD(StatusOr<google::cloud::bigquery::v2::JobCancelResponse>,
+              CancelJob,
+              (google::cloud::rest_internal::RestContext & rest_context,
+               Options const& options,
+               google::cloud::bigquery::v2::CancelJobRequest const& request),
+              (override));
+  MOCK_METHOD(StatusOr<Job>, GetJob,
+              (google::cloud::rest_internal::RestContext & rest_context,
+               Options const& options, GetJobRequest const& request),
+              (override));
+  MOCK_METHOD(StatusOr<Job>, InsertJob,
+              (google::cloud::rest_internal::RestContext & rest_context,
+               Options const& options,
+               google::cloud::bigquery::v2::InsertJobRequest const& request),
+              (override));
+  MOCK_METHOD(Status, DeleteJob,
+              (google::cloud::rest_internal::RestContext & rest_context,
+               Options const& options,
+               google::cloud::bigquery::v2::DeleteJobRequest const& request),
+              (override));
+  MOCK_METHOD(StatusOr<JobList>, ListJobs,
+              (google::cloud::rest_internal::RestContext & rest_context,
+               Options const& options, ListJobsRequest const& request),
+              (override));
+  MOCK_METHOD(
+      StatusOr<google::cloud::bigquery::v2::GetQueryResultsResponse>,
+      GetQueryResults,
+      (google::cloud::rest_internal::RestContext & rest_context,
+       Options const& options,
+       google::cloud::bigquery::v2::GetQueryResultsRequest const& request),
+      (override));
+  MOCK_METHOD(StatusOr<google::cloud::bigquery::v2::QueryResponse>, Query,
+              (google::cloud::rest_internal::RestContext & rest_context,
+               Options const& options,
+               google::cloud::bigquery::v2::PostQueryRequest const& request),
+              (override));
+};
+
+class MockPollingPolicy : public PollingPolicy {
+ public:
+  MOCK_METHOD(std::unique_ptr<PollingPolicy>, clone, (), (const, override));
+  MOCK_METHOD(bool, OnFailure, (Status const&), (override));
+  MOCK_METHOD(std::chrono::milliseconds, WaitPeriod, (), (override));
+};
+
+std::unique_ptr<PollingPolicy> MakePolicy(bool keep_polling) {
+  auto policy = std::make_unique<MockPollingPolicy>();
+  EXPECT_CALL(*policy, OnFailure).WillRepeatedly(Return(keep_polling));
+  return policy;
+}
+
+Job MakeJob(std::string const& job_id, std::int64_t creation_time,
+            std::string const& state) {
+  Job job;
+  job.mutable_job_reference()->set_project_id("my-project");
+  job.mutable_job_reference()->set_job_id(job_id);
+  job.mutable_job_reference()->mutable_location()->set_value("US");
+  job.mutable_statistics()->set_creation_time(creation_time);
+  job.mutable_status()->set_state(state);
+  return job;
+}
+
+JobList MakeJobList(std::vector<std::string> const& job_ids,
+                    std::string next_page_token = {}) {
+  JobList list;
+  for (auto const& id : job_ids) {
+    list.add_jobs()->mutable_job_reference()->set_job_id(id);
+  }
+  list.set_next_page_token(std::move(next_page_token));
+  return list;
+}
+
+class JobWatcherTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mock_stub_ = std::make_shared<MockJobServiceRestStub>();
+    // Long enough for the tests to watch all their jobs before the first poll.
+    watcher_ = std::make_shared<JobWatcher>(
+        mock_stub_, std::make_shared<BlockingExecutor>(2),
+        std::chrono::milliseconds(100));
+  }
+
+  std::shared_ptr<MockJobServiceRestStub> mock_stub_;
+  std::shared_ptr<JobWatcher> watcher_;
+  rest_internal::AutomaticallyCreatedRestBackgroundThreads background_;
+  std::shared_ptr<Options const> options_ = std::make_shared<Options>();
+};
+
+TEST_F(JobWatcherTest, BatchesJobs) {
+  ::testing::InSequence sequence;
+  EXPECT_CALL(*mock_stub_, ListJobs)
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   ListJobsRequest const& request) {
+        EXPECT_THAT(request.project_id(), Eq("my-project"));
+        EXPECT_THAT(request.min_creation_time(), Eq(1000U));
+        EXPECT_THAT(request.projection(), Eq(ListJobsRequest::MINIMAL));
+        EXPECT_THAT(request.state_filter(), ElementsAre(ListJobsRequest::DONE));
+        EXPECT_THAT(request.page_token(), Eq(""));
+        return MakeJobList({"a"}, "page-2");
+      })
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   ListJobsRequest const& request) {
+        EXPECT_THAT(request.page_token(), Eq("page-2"));
+        return MakeJobList({"b", "other"});
+      });
+  EXPECT_CALL(*mock_stub_, GetJob)
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   GetJobRequest const& request) {
+        EXPECT_THAT(request.job_id(), Eq("a"));
+        EXPECT_THAT(request.location(), Eq("US"));
+        return MakeJob("a", 1000, "DONE");
+      })
+      .WillOnce(Return(MakeJob("b", 2000, "DONE")));
+  EXPECT_CALL(*mock_stub_, ListJobs)
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   ListJobsRequest const& request) {
+        EXPECT_THAT(request.min_creation_time(), Eq(3000U));
+        return MakeJobList({"c"});
+      });
+  EXPECT_CALL(*mock_stub_, GetJob).WillOnce(Return(MakeJob("c", 3000, "DONE")));
+
+  auto cq = background_.cq();
+  auto a = watcher_->Watch(cq, MakeJob("a", 1000, "RUNNING"), options_,
+                           MakePolicy(true));
+  auto b = watcher_->Watch(cq, MakeJob("b", 2000, "RUNNING"), options_,
+                           MakePolicy(true));
+  auto c = watcher_->Watch(cq, MakeJob("c", 3000, "RUNNING"), options_,
+                           MakePolicy(true));
+
+  for (auto* f : {&a, &b, &c}) {
+    auto job = f->get();
+    ASSERT_STATUS_OK(job);
+    EXPECT_THAT(job->status().state(), Eq("DONE"));
+  }
+  EXPECT_EQ(watcher_->size(), 0U);
+}
+
+TEST_F(JobWatcherTest, StopsListingWhenAllJobsFound) {
+  EXPECT_CALL(*mock_stub_, ListJobs)
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   ListJobsRequest const& request) {
+        EXPECT_THAT(request.max_results().value(), Eq(1000U));
+        return MakeJobList({"other", "a"}, "page-2");
+      });
+  EXPECT_CALL(*mock_stub_, GetJob).WillOnce(Return(MakeJob("a", 1000, "DONE")));
+
+  auto job = watcher_
+                 ->Watch(background_.cq(), MakeJob("a", 1000, "RUNNING"),
+                         options_, MakePolicy(true))
+                 .get();
+  ASSERT_STATUS_OK(job);
+  EXPECT_THAT(job->status().state(), Eq("DONE"));
+}
+
+TEST_F(JobWatcherTest, PageLimitFallsBackToGetJob) {
+  // The service keeps returning pages without the watched jobs.
+  auto page = 0;
+  EXPECT_CALL(*mock_stub_, ListJobs)
+      .Times(10)
+      .WillRepeatedly([&page](rest_internal::RestContext&, Options const&,
+                              ListJobsRequest const&) {
+        ++page;
+        return MakeJobList({"other-" + std::to_string(page)},
+                           "page-" + std::to_string(page + 1));
+      });
+  EXPECT_CALL(*mock_stub_, GetJob)
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   GetJobRequest const& request) {
+        EXPECT_THAT(request.job_id(), Eq("a"));
+        return MakeJob("a", 1000, "DONE");
+      })
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   GetJobRequest const& request) {
+        EXPECT_THAT(request.job_id(), Eq("b"));
+        return MakeJob("b", 1000, "DONE");
+      });
+
+  auto cq = background_.cq();
+  auto a = watcher_->Watch(cq, MakeJob("a", 1000, "RUNNING"), options_,
+                           MakePolicy(true));
+  auto b = watcher_->Watch(cq, MakeJob("b", 1000, "RUNNING"), options_,
+                           MakePolicy(true));
+  for (auto* f : {&a, &b}) {
+    auto job = f->get();
+    ASSERT_STATUS_OK(job);
+    EXPECT_THAT(job->status().state(), Eq("DONE"));
+  }
+}
+
+TEST_F(JobWatcherTest, UnlistedJobFallsBackToGetJob) {
+  // A job created by another principal is never listed.
+  EXPECT_CALL(*mock_stub_, ListJobs)
+      .Times(10)
+      .WillRepeatedly(Return(MakeJobList({"other"})));
+  EXPECT_CALL(*mock_stub_, GetJob)
+      .WillOnce([](rest_internal::RestContext&, Options const&,
+                   GetJobRequest const& request) {
+        EXPECT_THAT(request.job_id(), Eq("a"));
+        return MakeJob("a", 1000, "DONE");
+      });
+
+  auto job = watcher_
+                 ->Watch(background_.cq(), MakeJob("a", 1000, "RUNNING"),
+                         options_, MakePolicy(true))
+                 .get();
+  ASSERT_STATUS_OK(job);
+  EXPECT_THAT(job->status().state(), Eq("DONE"));
+}
+
+TEST_F(JobWatcherTest, PollingPolicyExhausted) {
+  EXPECT_CALL(*mock_stub_, ListJobs).WillOnce(Return(MakeJobList({})));
+  EXPECT_CALL(*mock_stub_, GetJob).Times(0);
+
+  auto job = watcher_
+                 ->Watch(background_.cq(), MakeJob("a", 1000, "RUNNING"),
+                         options_, MakePolicy(false))
+                 .get();
+  EXPECT_THAT(job, StatusIs(StatusCode::kDeadlineExceeded));
+}
+
+TEST_F(JobWatcherTest, ListJobsError) {
+  EXPECT_CALL(*mock_stub_, ListJobs)
+      .WillOnce(Return(internal::UnavailableError("try-again")))
+      .WillOnce(Return(internal::PermissionDeniedError("uh-oh")));
+  EXPECT_CALL(*mock_stub_, GetJob).Times(0);
+
+  auto policy = std::make_unique<MockPollingPolicy>();
+  EXPECT_CALL(*policy, OnFailure)
+      .WillOnce(Return(true))
+      .WillOnce(Return(false));
+  auto job = watcher_
+                 ->Watch(background_.cq(), MakeJob("a", 1000, "RUNNING"),
+                         options_, std::move(policy))
+                 .get();
+  EXPECT_THAT(job, StatusIs(StatusCode::kPermissionDenied));
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,115 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/lazy_connection.h"
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+StatusOr<google::cloud::bigquery::storage::v1::ReadSession>
+LazyBigQueryReadConnection::CreateReadSession(
+    google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+        request) {
+  return child_.get().CreateReadSession(request);
+}
+
+StreamRange<google::cloud::bigquery::storage::v1::ReadRowsResponse>
+LazyBigQueryReadConnection::ReadRows(
+    google::cloud::bigquery::storage::v1::ReadRowsRequest const& request) {
+  return child_.get().ReadRows(request);
+}
+
+StatusOr<google::cloud::bigquery::storage::v1::SplitReadStreamResponse>
+LazyBigQueryReadConnection::SplitReadStream(
+    google::cloud::bigquery::storage::v1::SplitReadStreamRequest const&
+        request) {
+  return child_.get().SplitReadStream(request);
+}
+
+StatusOr<google::cloud::bigquery::v2::JobCancelResponse>
+LazyJobServiceConnection::CancelJob(
+    google::cloud::bigquery::v2::CancelJobRequest const& request) {
+  return child_.get().CancelJob(request);
+}
+
+StatusOr<google::cloud::bigquery::v2::Job> LazyJobServiceConnection::GetJob(
+    google::cloud::bigquery::v2::GetJobRequest const& request) {
+  return child_.get().GetJob(request);
+}
+
+StatusOr<google::cloud::bigquery::v2::Job> LazyJobServiceConnection::InsertJob(
+    google::cloud::bigquery::v2::InsertJobRequest const& request) {
+  return child_.get().InsertJob(request);
+}
+
+Status LazyJobServiceConnection::DeleteJob(
+    google::cloud::bigquery::v2::DeleteJobRequest const& request) {
+  return child_.get().DeleteJob(request);
+}
+
+StreamRange<google::cloud::bigquery::v2::ListFormatJob>
+LazyJobServiceConnection::ListJobs(
+    google::cloud::bigquery::v2::ListJobsRequest request) {
+  return child_.get().ListJobs(std::move(request));
+}
+
+StatusOr<google::cloud::bigquery::v2::GetQueryResultsResponse>
+LazyJobServiceConnection::GetQueryResults(
+    google::cloud::bigquery::v2::GetQueryResultsRequest const& request) {
+  return child_.get().GetQueryResults(request);
+}
+
+StatusOr<google::cloud::bigquery::v2::QueryResponse>
+LazyJobServiceConnection::Query(
+    google::cloud::bigquery::v2::PostQueryRequest const& request) {
+  return child_.get().Query(request);
+}
+
+StatusOr<google::cloud::bigquery::v2::Table>
+LazyTableServiceConnection::GetTable(
+    google::cloud::bigquery::v2::GetTableRequest const& request) {
+  return child_.get().GetTable(request);
+}
+
+StatusOr<google::cloud::bigquery::v2::Table>
+LazyTableServiceConnection::InsertTable(
+    google::cloud::bigquery::v2::InsertTableRequest const& request) {
+  return child_.get().InsertTable(request);
+}
+
+StatusOr<google::cloud::bigquery::v2::Table>
+LazyTableServiceConnection::PatchTable(
+    google::cloud::bigquery::v2::UpdateOrPatchTableRequest const& request) {
+  return child_.get().PatchTable(request);
+}
+
+StatusOr<google::cloud::bigquery::v2::Table>
+LazyTableServiceConnection::UpdateTable(
+    google::cloud::bigquery::v2::UpdateOrPatchTableRequest const& request) {
+  return child_.get().UpdateTable(request);
+}
+
+Status LazyTableServiceConnection::DeleteTable(
+    google::cloud::bigquery::v2::DeleteTableRequest const& request) {
+  return child_.get().DeleteTable(request);
+}
+
+StreamRange<google::cloud::bigquery::v2::ListFormatTable>
+LazyTableServiceConnection::ListTables(
+    google::cloud::bigquery::v2::ListTablesRequest request) {
+  return child_.get().ListTables(std::move(request));
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
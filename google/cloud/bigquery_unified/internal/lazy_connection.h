@@ -0,0 +1,173 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_LAZY_CONNECTION_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_LAZY_CONNECTION_H
+
+#include "google/cloud/bigquery/storage/v1/bigquery_read_connection.h"
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/bigquerycontrol/v2/job_connection.h"
+#include "google/cloud/bigquerycontrol/v2/table_connection.h"
+#include "google/cloud/options.h"
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/// Creates a connection on first use, then returns the same connection.
+template <typename Connection>
+class LazyConnectionHolder {
+ public:
+  using Factory = std::function<std::shared_ptr<Connection>()>;
+
+  explicit LazyConnectionHolder(Factory factory)
+      : factory_(std::move(factory)) {}
+
+  Connection& get() {
+    std::call_once(once_, [this] {
+      connection_ = factory_();
+      factory_ = nullptr;
+    });
+    return *connection_;
+  }
+
+ private:
+  std::once_flag once_;
+  Factory factory_;
+  std::shared_ptr<Connection> connection_;
+};
+
+/**
+ * Builds the Storage Read API connection when it is first called.
+ *
+ * Creating the connection starts its background threads, its authentication
+ * and its gRPC channels. Applications that never read table data skip all of
+ * it. `options()` returns the options given to the constructor, without
+ * creating the connection.
+ */
+class LazyBigQueryReadConnection
+    : public bigquery_storage_v1::BigQueryReadConnection {
+ public:
+  LazyBigQueryReadConnection(
+      Options options,
+      LazyConnectionHolder<bigquery_storage_v1::BigQueryReadConnection>::Factory
+          factory)
+      : options_(std::move(options)), child_(std::move(factory)) {}
+  ~LazyBigQueryReadConnection() override = default;
+
+  Options options() override { return options_; }
+
+  StatusOr<google::cloud::bigquery::storage::v1::ReadSession> CreateReadSession(
+      google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+          request) override;
+
+  StreamRange<google::cloud::bigquery::storage::v1::ReadRowsResponse> ReadRows(
+      google::cloud::bigquery::storage::v1::ReadRowsRequest const& request)
+      override;
+
+  StatusOr<google::cloud::bigquery::storage::v1::SplitReadStreamResponse>
+  SplitReadStream(
+      google::cloud::bigquery::storage::v1::SplitReadStreamRequest const&
+          request) override;
+
+ private:
+  Options options_;
+  LazyConnectionHolder<bigquery_storage_v1::BigQueryReadConnection> child_;
+};
+
+/// Builds the job service connection when it is first called.
+class LazyJobServiceConnection
+    : public bigquerycontrol_v2::JobServiceConnection {
+ public:
+  LazyJobServiceConnection(
+      Options options,
+      LazyConnectionHolder<bigquerycontrol_v2::JobServiceConnection>::Factory
+          factory)
+      : options_(std::move(options)), child_(std::move(factory)) {}
+  ~LazyJobServiceConnection() override = default;
+
+  Options options() override { return options_; }
+
+  StatusOr<google::cloud::bigquery::v2::JobCancelResponse> CancelJob(
+      google::cloud::bigquery::v2::CancelJobRequest const& request) override;
+
+  StatusOr<google::cloud::bigquery::v2::Job> GetJob(
+      google::cloud::bigquery::v2::GetJobRequest const& request) override;
+
+  StatusOr<google::cloud::bigquery::v2::Job> InsertJob(
+      google::cloud::bigquery::v2::InsertJobRequest const& request) override;
+
+  Status DeleteJob(
+      google::cloud::bigquery::v2::DeleteJobRequest const& request) override;
+
+  StreamRange<google::cloud::bigquery::v2::ListFormatJob> ListJobs(
+      google::cloud::bigquery::v2::ListJobsRequest request) override;
+
+  StatusOr<google::cloud::bigquery::v2::GetQueryResultsResponse>
+  GetQueryResults(google::cloud::bigquery::v2::GetQueryResultsRequest const&
+                      request) override;
+
+  StatusOr<google::cloud::bigquery::v2::QueryResponse> Query(
+      google::cloud::bigquery::v2::PostQueryRequest const& request) override;
+
+ private:
+  Options options_;
+  LazyConnectionHolder<bigquerycontrol_v2::JobServiceConnection> child_;
+};
+
+/// Builds the table service connection when it is first called.
+class LazyTableServiceConnection
+    : public bigquerycontrol_v2::TableServiceConnection {
+ public:
+  LazyTableServiceConnection(
+      Options options,
+      LazyConnectionHolder<bigquerycontrol_v2::TableServiceConnection>::Factory
+          factory)
+      : options_(std::move(options)), child_(std::move(factory)) {}
+  ~LazyTableServiceConnection() override = default;
+
+  Options options() override { return options_; }
+
+  StatusOr<google::cloud::bigquery::v2::Table> GetTable(
+      google::cloud::bigquery::v2::GetTableRequest const& request) override;
+
+  StatusOr<google::cloud::bigquery::v2::Table> InsertTable(
+      google::cloud::bigquery::v2::InsertTableRequest const& request) override;
+
+  StatusOr<google::cloud::bigquery::v2::Table> PatchTable(
+      google::cloud::bigquery::v2::UpdateOrPatchTableRequest const& request)
+      override;
+
+  StatusOr<google::cloud::bigquery::v2::Table> UpdateTable(
+      google::cloud::bigquery::v2::UpdateOrPatchTableRequest const& request)
+      override;
+
+  Status DeleteTable(
+      google::cloud::bigquery::v2::DeleteTableRequest const& request) override;
+
+  StreamRange<google::cloud::bigquery::v2::ListFormatTable> ListTables(
+      google::cloud::bigquery::v2::ListTablesRequest request) override;
+
+ private:
+  Options options_;
+  LazyConnectionHolder<bigquerycontrol_v2::TableServiceConnection> child_;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_LAZY_CONNECTION_H
@@ -0,0 +1,113 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/lazy_connection.h"
+#include "google/cloud/bigquery_unified/testing_util/status_matchers.h"
+#include <gmock/gmock.h>
+#include <memory>
+#include <string>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery_unified::testing_util::IsOk;
+using ::testing::Return;
+
+struct TestOption {
+  using Type = std::string;
+};
+
+class MockJobServiceConnection
+    : public bigquerycontrol_v2::JobServiceConnection {
+ public:
+  MOCK_METHOD(Options, options, (), (override));
+  MOCK_METHOD(StatusOr<google::cloud::bigquery::v2::Job>, GetJob,
+              (google::cloud::bigquery::v2::GetJobRequest const& request),
+              (override));
+};
+
+class MockTableServiceConnection
+    : public bigquerycontrol_v2::TableServiceConnection {
+ public:
+  MOCK_METHOD(StatusOr<google::cloud::bigquery::v2::Table>, GetTable,
+              (google::cloud::bigquery::v2::GetTableRequest const& request),
+              (override));
+};
+
+class MockBigQueryReadConnection
+    : public bigquery_storage_v1::BigQueryReadConnection {
+ public:
+  MOCK_METHOD(
+      StatusOr<google::cloud::bigquery::storage::v1::SplitReadStreamResponse>,
+      SplitReadStream,
+      (google::cloud::bigquery::storage::v1::SplitReadStreamRequest const&
+           request),
+      (override));
+};
+
+TEST(LazyConnectionTest, JobConnectionCreatedOnFirstCall) {
+  int created = 0;
+  LazyJobServiceConnection connection(
+      Options{}.set<TestOption>("job"), [&created] {
+        ++created;
+        auto mock = std::make_shared<MockJobServiceConnection>();
+        EXPECT_CALL(*mock, options).Times(0);
+        EXPECT_CALL(*mock, GetJob)
+            .Times(2)
+            .WillRepeatedly(Return(google::cloud::bigquery::v2::Job{}));
+        return mock;
+      });
+
+  // The options are known without creating the connection.
+  EXPECT_EQ(connection.options().get<TestOption>(), "job");
+  EXPECT_EQ(created, 0);
+
+  EXPECT_THAT(connection.GetJob({}), IsOk());
+  EXPECT_THAT(connection.GetJob({}), IsOk());
+  EXPECT_EQ(created, 1);
+}
+
+TEST(LazyConnectionTest, TableConnectionCreatedOnFirstCall) {
+  int created = 0;
+  LazyTableServiceConnection connection(Options{}, [&created] {
+    ++created;
+    auto mock = std::make_shared<MockTableServiceConnection>();
+    EXPECT_CALL(*mock, GetTable)
+        .WillOnce(Return(google::cloud::bigquery::v2::Table{}));
+    return mock;
+  });
+  EXPECT_EQ(created, 0);
+  EXPECT_THAT(connection.GetTable({}), IsOk());
+  EXPECT_EQ(created, 1);
+}
+
+TEST(LazyConnectionTest, ReadConnectionCreatedOnFirstCall) {
+  int created = 0;
+  LazyBigQueryReadConnection connection(Options{}, [&created] {
+    ++created;
+    auto mock = std::make_shared<MockBigQueryReadConnection>();
+    EXPECT_CALL(*mock, SplitReadStream)
+        .WillOnce(Return(
+            google::cloud::bigquery::storage::v1::SplitReadStreamResponse{}));
+    return mock;
+  });
+  EXPECT_EQ(created, 0);
+  EXPECT_THAT(connection.SplitReadStream({}), IsOk());
+  EXPECT_EQ(created, 1);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
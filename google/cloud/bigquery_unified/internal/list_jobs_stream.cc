@@ -0,0 +1,160 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/list_jobs_stream.h"
+#include "absl/types/optional.h"
+#include "absl/types/variant.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <iterator>
+#include <mutex>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+namespace {
+
+using ::google::cloud::bigquery::v2::JobList;
+using ::google::cloud::bigquery::v2::ListFormatJob;
+using ::google::cloud::bigquery::v2::ListJobsRequest;
+
+// The pages fetched in the background, shared by the consumer and the fetch
+// tasks. A fetch task never waits for the consumer, it only schedules the
+// next fetch if there is room for its page.
+class PrefetchState : public std::enable_shared_from_this<PrefetchState> {
+ public:
+  PrefetchState(std::vector<ListJobsRequest> requests,
+                ListJobsPageFetcher fetcher,
+                std::shared_ptr<BlockingExecutor> executor,
+                std::size_t max_pages)
+      : fetcher_(std::move(fetcher)),
+        executor_(std::move(executor)),
+        max_pages_(std::max<std::size_t>(max_pages, 1)),
+        waiting_(std::make_move_iterator(requests.begin()),
+                 std::make_move_iterator(requests.end())) {}
+
+  // Returns the next page, or `absl::nullopt` once all the pages are consumed.
+  absl::optional<StatusOr<JobList>> NextPage() {
+    std::unique_lock<std::mutex> lk(mu_);
+    for (;;) {
+      MaybeFetch(lk);
+      if (!ready_.empty()) break;
+      if (in_flight_ == 0 && waiting_.empty()) return absl::nullopt;
+      cv_.wait(lk);
+    }
+    auto page = std::move(ready_.front());
+    ready_.pop_front();
+    // Start fetching a replacement while the caller consumes this page.
+    MaybeFetch(lk);
+    return page;
+  }
+
+  void Cancel() {
+    std::lock_guard<std::mutex> lk(mu_);
+    cancelled_ = true;
+    waiting_.clear();
+    ready_.clear();
+  }
+
+ private:
+  void MaybeFetch(std::unique_lock<std::mutex> const&) {
+    while (!cancelled_ && !waiting_.empty() &&
+           in_flight_ + ready_.size() < max_pages_) {
+      auto request = std::move(waiting_.front());
+      waiting_.pop_front();
+      ++in_flight_;
+      executor_->Schedule(
+          [self = shared_from_this(), request = std::move(request)]() mutable {
+            self->Fetch(std::move(request));
+          });
+    }
+  }
+
+  void Fetch(ListJobsRequest request) {
+    std::unique_lock<std::mutex> lk(mu_);
+    if (cancelled_) {
+      --in_flight_;
+      return;
+    }
+    lk.unlock();
+    auto page = fetcher_(request);
+    lk.lock();
+    --in_flight_;
+    if (cancelled_) return;
+    if (!page) {
+      // The stream ends with this error, there is no point in fetching more.
+      waiting_.clear();
+    } else if (!page->next_page_token().empty()) {
+      request.set_page_token(page->next_page_token());
+      waiting_.push_back(std::move(request));
+    }
+    ready_.push_back(std::move(page));
+    MaybeFetch(lk);
+    cv_.notify_all();
+  }
+
+  ListJobsPageFetcher fetcher_;
+  std::shared_ptr<BlockingExecutor> executor_;
+  std::size_t const max_pages_;
+  std::mutex mu_;
+  std::condition_variable cv_;
+  bool cancelled_ = false;
+  std::size_t in_flight_ = 0;
+  std::deque<ListJobsRequest> waiting_;
+  std::deque<StatusOr<JobList>> ready_;
+};
+
+// Iterates over the jobs in each page. Stops any background work when the
+// range holding it is destroyed.
+class Consumer {
+ public:
+  explicit Consumer(std::shared_ptr<PrefetchState> state)
+      : state_(std::move(state)) {}
+  ~Consumer() { state_->Cancel(); }
+
+  Consumer(Consumer const&) = delete;
+  Consumer& operator=(Consumer const&) = delete;
+
+  absl::variant<Status, ListFormatJob> Next() {
+    while (index_ == page_.jobs_size()) {
+      auto page = state_->NextPage();
+      if (!page) return Status{};
+      if (!*page) return std::move(*page).status();
+      page_ = *std::move(*page);
+      index_ = 0;
+    }
+    return std::move(*page_.mutable_jobs(index_++));
+  }
+
+ private:
+  std::shared_ptr<PrefetchState> state_;
+  JobList page_;
+  int index_ = 0;
+};
+
+}  // namespace
+
+StreamRange<ListFormatJob> MakeListJobsStreamRange(
+    std::vector<ListJobsRequest> requests, ListJobsPageFetcher fetcher,
+    std::shared_ptr<BlockingExecutor> executor, std::size_t max_pages) {
+  auto consumer = std::make_shared<Consumer>(std::make_shared<PrefetchState>(
+      std::move(requests), std::move(fetcher), std::move(executor),
+      max_pages));
+  return internal::MakeStreamRange<ListFormatJob>(
+      [consumer = std::move(consumer)] { return consumer->Next(); });
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,57 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_LIST_JOBS_STREAM_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_LIST_JOBS_STREAM_H
+
+#include "google/cloud/bigquery_unified/internal/blocking_executor.h"
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/status_or.h"
+#include "google/cloud/stream_range.h"
+#include <google/cloud/bigquery/v2/job.pb.h>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/// Fetches a single page of a `jobs.list` call.
+using ListJobsPageFetcher =
+    std::function<StatusOr<google::cloud::bigquery::v2::JobList>(
+        google::cloud::bigquery::v2::ListJobsRequest const&)>;
+
+/**
+ * Returns the jobs listed by @p requests, fetching pages in the background.
+ *
+ * Pages are fetched on @p executor while the application consumes the
+ * previous pages. At most @p max_pages pages are fetched or buffered at any
+ * time, so a single request fetches the next page while the current page is
+ * consumed, and several requests (typically one per project) are listed in
+ * parallel. Pages from different requests are interleaved in the order they
+ * are received, the jobs of each request keep their order.
+ *
+ * The stream ends at the first error. Destroying the range stops fetching new
+ * pages.
+ */
+StreamRange<google::cloud::bigquery::v2::ListFormatJob> MakeListJobsStreamRange(
+    std::vector<google::cloud::bigquery::v2::ListJobsRequest> requests,
+    ListJobsPageFetcher fetcher, std::shared_ptr<BlockingExecutor> executor,
+    std::size_t max_pages);
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_LIST_JOBS_STREAM_H
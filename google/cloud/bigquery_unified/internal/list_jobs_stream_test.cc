@@ -0,0 +1,162 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/list_jobs_stream.h"
+#include "google/cloud/bigquery_unified/testing_util/status_matchers.h"
+#include "google/cloud/internal/make_status.h"
+#include <gmock/gmock.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery::v2::JobList;
+using ::google::cloud::bigquery::v2::ListJobsRequest;
+using ::google::cloud::bigquery_unified::testing_util::StatusIs;
+using ::testing::ElementsAre;
+using ::testing::UnorderedElementsAre;
+
+ListJobsRequest MakeRequest(std::string const& project_id) {
+  ListJobsRequest request;
+  request.set_project_id(project_id);
+  return request;
+}
+
+// Returns @p pages pages with two jobs each for every project. The page token
+// is the index of the next page.
+ListJobsPageFetcher MakeFetcher(int pages) {
+  return [pages](ListJobsRequest const& request) -> StatusOr<JobList> {
+    auto const page =
+        request.page_token().empty() ? 0 : std::stoi(request.page_token());
+    JobList list;
+    for (auto const* suffix : {"a", "b"}) {
+      list.add_jobs()->set_id(request.project_id() + ":" +
+                              std::to_string(page) + suffix);
+    }
+    if (page + 1 < pages) list.set_next_page_token(std::to_string(page + 1));
+    return list;
+  };
+}
+
+std::vector<std::string> Ids(
+    StreamRange<google::cloud::bigquery::v2::ListFormatJob> range) {
+  std::vector<std::string> ids;
+  for (auto& job : range) {
+    if (!job) break;
+    ids.push_back(job->id());
+  }
+  return ids;
+}
+
+TEST(ListJobsStreamTest, SingleRequest) {
+  auto executor = std::make_shared<BlockingExecutor>(2);
+  auto range = MakeListJobsStreamRange({MakeRequest("p")}, MakeFetcher(3),
+                                       executor, /*max_pages=*/1);
+  EXPECT_THAT(Ids(std::move(range)),
+              ElementsAre("p:0a", "p:0b", "p:1a", "p:1b", "p:2a", "p:2b"));
+}
+
+TEST(ListJobsStreamTest, MultipleRequests) {
+  auto executor = std::make_shared<BlockingExecutor>(2);
+  auto range =
+      MakeListJobsStreamRange({MakeRequest("p1"), MakeRequest("p2")},
+                              MakeFetcher(2), executor, /*max_pages=*/2);
+  EXPECT_THAT(Ids(std::move(range)),
+              UnorderedElementsAre("p1:0a", "p1:0b", "p1:1a", "p1:1b", "p2:0a",
+                                   "p2:0b", "p2:1a", "p2:1b"));
+}
+
+TEST(ListJobsStreamTest, Empty) {
+  auto executor = std::make_shared<BlockingExecutor>(1);
+  auto range = MakeListJobsStreamRange({}, MakeFetcher(2), executor, 4);
+  EXPECT_EQ(range.begin(), range.end());
+}
+
+TEST(ListJobsStreamTest, ErrorEndsStream) {
+  auto executor = std::make_shared<BlockingExecutor>(1);
+  auto fetcher = MakeFetcher(3);
+  auto range = MakeListJobsStreamRange(
+      {MakeRequest("p")},
+      [fetcher](ListJobsRequest const& request) -> StatusOr<JobList> {
+        if (request.page_token() == "1") {
+          return internal::UnavailableError("try again");
+        }
+        return fetcher(request);
+      },
+      executor, 1);
+
+  std::vector<std::string> ids;
+  auto it = range.begin();
+  for (; it != range.end() && *it; ++it) ids.push_back((*it)->id());
+  EXPECT_THAT(ids, ElementsAre("p:0a", "p:0b"));
+  ASSERT_NE(it, range.end());
+  EXPECT_THAT(*it, StatusIs(StatusCode::kUnavailable));
+  EXPECT_EQ(++it, range.end());
+}
+
+TEST(ListJobsStreamTest, PrefetchesNextPage) {
+  auto executor = std::make_shared<BlockingExecutor>(1);
+  std::mutex mu;
+  std::condition_variable cv;
+  std::vector<std::string> fetched;
+  auto fetcher = MakeFetcher(3);
+  auto range = MakeListJobsStreamRange(
+      {MakeRequest("p")},
+      [&, fetcher](ListJobsRequest const& request) {
+        std::lock_guard<std::mutex> lk(mu);
+        fetched.push_back(request.page_token());
+        cv.notify_all();
+        return fetcher(request);
+      },
+      executor, 1);
+
+  // Reading the first job of the first page starts fetching the second page.
+  auto it = range.begin();
+  ASSERT_NE(it, range.end());
+  std::unique_lock<std::mutex> lk(mu);
+  cv.wait(lk, [&] { return fetched.size() >= 2; });
+  EXPECT_THAT(fetched, ElementsAre("", "1"));
+  lk.unlock();
+  // The buffer is full, wait for the fetch in flight before `mu` goes away.
+  executor->Run([] {}).get();
+}
+
+TEST(ListJobsStreamTest, DestroyStopsFetching) {
+  auto executor = std::make_shared<BlockingExecutor>(1);
+  auto calls = std::make_shared<std::atomic<int>>(0);
+  auto fetcher = MakeFetcher(100);
+  {
+    auto range = MakeListJobsStreamRange(
+        {MakeRequest("p")},
+        [calls, fetcher](ListJobsRequest const& request) {
+          ++*calls;
+          return fetcher(request);
+        },
+        executor, 1);
+    ASSERT_NE(range.begin(), range.end());
+  }
+  // Wait for any fetch in flight to complete.
+  executor->Run([] {}).get();
+  EXPECT_LE(calls->load(), 2);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,34 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/prepared_options.h"
+#include <utility>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+PreparedOptions::PreparedOptions()
+    : options_(std::make_shared<Options const>()) {}
+
+PreparedOptions::PreparedOptions(Options options)
+    : options_(std::make_shared<Options const>(std::move(options))) {}
+
+internal::ImmutableOptions PreparedOptions::ForCall(Options overrides) const {
+  if (internal::IsEmpty(overrides)) return options_;
+  return std::make_shared<Options const>(
+      internal::MergeOptions(std::move(overrides), *options_));
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,54 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_PREPARED_OPTIONS_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_PREPARED_OPTIONS_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/options.h"
+#include <memory>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * A set of options merged once and then shared, immutable, by all calls.
+ *
+ * A connection combines its own options with the defaults of each service
+ * when it is created, instead of merging them again on every call. Most calls
+ * have no per-call options, `ForCall()` returns the shared set for them
+ * without copying it, and `internal::OptionsSpan` installs it as is.
+ */
+class PreparedOptions {
+ public:
+  PreparedOptions();
+  explicit PreparedOptions(Options options);
+
+  Options const& get() const { return *options_; }
+
+  /**
+   * The options for one call: @p overrides merged over the prepared options.
+   *
+   * Returns the prepared options themselves if @p overrides is empty.
+   */
+  internal::ImmutableOptions ForCall(Options overrides) const;
+
+ private:
+  internal::ImmutableOptions options_;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_PREPARED_OPTIONS_H
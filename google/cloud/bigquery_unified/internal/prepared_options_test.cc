@@ -0,0 +1,58 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/prepared_options.h"
+#include <gmock/gmock.h>
+#include <string>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+struct TestOption1 {
+  using Type = std::string;
+};
+
+struct TestOption2 {
+  using Type = std::string;
+};
+
+TEST(PreparedOptionsTest, EmptyOverridesShareThePreparedOptions) {
+  PreparedOptions prepared(Options{}.set<TestOption1>("prepared"));
+  auto a = prepared.ForCall(Options{});
+  auto b = prepared.ForCall(Options{});
+  EXPECT_EQ(a.get(), &prepared.get());
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(a->get<TestOption1>(), "prepared");
+}
+
+TEST(PreparedOptionsTest, OverridesAreMerged) {
+  PreparedOptions prepared(
+      Options{}.set<TestOption1>("prepared").set<TestOption2>("prepared"));
+  auto call = prepared.ForCall(Options{}.set<TestOption2>("call"));
+  EXPECT_NE(call.get(), &prepared.get());
+  EXPECT_EQ(call->get<TestOption1>(), "prepared");
+  EXPECT_EQ(call->get<TestOption2>(), "call");
+  // The prepared options are not modified.
+  EXPECT_EQ(prepared.get().get<TestOption2>(), "prepared");
+}
+
+TEST(PreparedOptionsTest, Default) {
+  PreparedOptions prepared;
+  EXPECT_FALSE(prepared.ForCall(Options{})->has<TestOption1>());
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,256 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/query_cache.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <array>
+#include <cctype>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+namespace {
+
+// Collapses each run of whitespace outside quoted strings, quoted identifiers
+// and comments into a single space. If `keep_quoted` is false the contents of
+// quoted strings and identifiers, and the comments, are discarded.
+std::string ScanQuery(std::string const& query, bool keep_quoted) {
+  std::string result;
+  auto pending_space = false;
+  auto emit = [&](char c) {
+    if (pending_space && !result.empty()) result.push_back(' ');
+    pending_space = false;
+    result.push_back(c);
+  };
+  for (std::size_t i = 0; i < query.size(); ++i) {
+    auto const c = query[i];
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      pending_space = true;
+      continue;
+    }
+    if (c == '\'' || c == '"' || c == '`') {
+      emit(c);
+      for (++i; i < query.size() && query[i] != c; ++i) {
+        if (query[i] == '\\' && i + 1 < query.size()) {
+          if (keep_quoted) result.push_back(query[i]);
+          ++i;
+        }
+        if (keep_quoted) result.push_back(query[i]);
+      }
+      if (i < query.size()) result.push_back(c);
+      continue;
+    }
+    auto const next = i + 1 < query.size() ? query[i + 1] : '\0';
+    auto const line_comment = c == '#' || (c == '-' && next == '-');
+    auto const block_comment = c == '/' && next == '*';
+    if (line_comment || block_comment) {
+      // Keep the newline ending a line comment, otherwise the text following
+      // it would become part of the comment.
+      auto const end =
+          line_comment ? query.find('\n', i) : query.find("*/", i + 2);
+      auto const stop = end == std::string::npos
+                            ? query.size()
+                            : end + (line_comment ? 1 : 2);
+      if (keep_quoted) {
+        emit(c);
+        result.append(query, i + 1, stop - i - 1);
+      } else {
+        pending_space = true;
+      }
+      i = stop - 1;
+      continue;
+    }
+    emit(c);
+  }
+  return result;
+}
+
+// The query text without quoted strings, quoted identifiers or comments, so
+// their contents do not affect the checks below.
+std::string QuerySkeleton(std::string const& query) {
+  return absl::AsciiStrToUpper(ScanQuery(query, /*keep_quoted=*/false));
+}
+
+bool IsIdentifierChar(char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+bool ContainsWord(std::string const& text, std::string const& word) {
+  for (auto pos = text.find(word); pos != std::string::npos;
+       pos = text.find(word, pos + 1)) {
+    auto const end = pos + word.size();
+    if ((pos == 0 || !IsIdentifierChar(text[pos - 1])) &&
+        (end == text.size() || !IsIdentifierChar(text[end]))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool StartsWithWord(std::string const& text, std::string const& word) {
+  return text.compare(0, word.size(), word) == 0 &&
+         (text.size() == word.size() || !IsIdentifierChar(text[word.size()]));
+}
+
+// A single `SELECT` statement, possibly with a `WITH` clause. Scripts with
+// several statements are never read-only for our purposes.
+bool IsReadOnly(std::string const& skeleton) {
+  auto const begin = skeleton.find_first_not_of("( ");
+  if (begin == std::string::npos) return false;
+  auto const statement = skeleton.substr(begin);
+  if (!StartsWithWord(statement, "SELECT") &&
+      !StartsWithWord(statement, "WITH")) {
+    return false;
+  }
+  auto const separator = statement.find(';');
+  return separator == std::string::npos ||
+         separator + 1 == statement.size();
+}
+
+bool IsDeterministic(std::string const& skeleton) {
+  auto constexpr kFunctions = std::array<char const*, 7>{
+      "CURRENT_DATE", "CURRENT_DATETIME", "CURRENT_TIME", "CURRENT_TIMESTAMP",
+      "GENERATE_UUID", "RAND", "SESSION_USER"};
+  for (auto const* f : kFunctions) {
+    if (ContainsWord(skeleton, f)) return false;
+  }
+  // System variables, such as `@@current_job_id`, change with each query.
+  return !absl::StrContains(skeleton, "@@");
+}
+
+}  // namespace
+
+absl::optional<google::cloud::bigquery::v2::Job> QueryCache::Lookup(
+    std::string const& key) {
+  std::lock_guard<std::mutex> lk(mu_);
+  EvictExpired(clock_());
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return absl::nullopt;
+  return it->second.job;
+}
+
+void QueryCache::Insert(std::string key, google::cloud::bigquery::v2::Job job,
+                        std::chrono::milliseconds ttl, std::size_t capacity,
+                        std::uint64_t generation) {
+  std::lock_guard<std::mutex> lk(mu_);
+  if (generation != generation_) return;
+  auto const now = clock_();
+  EvictExpired(now);
+  entries_[std::move(key)] = Entry{std::move(job), now + ttl};
+  while (entries_.size() > capacity) {
+    auto victim = entries_.begin();
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->second.expire_time < victim->second.expire_time) victim = it;
+    }
+    entries_.erase(victim);
+  }
+}
+
+void QueryCache::Clear() {
+  std::lock_guard<std::mutex> lk(mu_);
+  entries_.clear();
+  ++generation_;
+}
+
+std::uint64_t QueryCache::generation() const {
+  std::lock_guard<std::mutex> lk(mu_);
+  return generation_;
+}
+
+std::size_t QueryCache::size() const {
+  std::lock_guard<std::mutex> lk(mu_);
+  return entries_.size();
+}
+
+absl::optional<std::string> QueryCache::Key(
+    google::cloud::bigquery::v2::Job const& job,
+    std::string const& billing_project) {
+  auto const& configuration = job.configuration();
+  if (!configuration.has_query() || configuration.dry_run().value() ||
+      !job.job_reference().job_id().empty()) {
+    return absl::nullopt;
+  }
+  auto const& query = configuration.query();
+  if (query.has_use_query_cache() && !query.use_query_cache().value()) {
+    return absl::nullopt;
+  }
+  // Queries writing to a named table, or reading external tables or session
+  // state, are not repeatable.
+  if (query.has_destination_table() || query.create_session().value() ||
+      !query.connection_properties().empty() ||
+      !query.table_definitions().empty()) {
+    return absl::nullopt;
+  }
+  auto const skeleton = QuerySkeleton(query.query());
+  if (!IsReadOnly(skeleton) || !IsDeterministic(skeleton)) {
+    return absl::nullopt;
+  }
+
+  // Only the fields that change the results identify the query.
+  google::cloud::bigquery::v2::Job normalized;
+  auto& job_reference = *normalized.mutable_job_reference();
+  auto const& project_id = job.job_reference().project_id();
+  job_reference.set_project_id(project_id.empty() ? billing_project
+                                                  : project_id);
+  *job_reference.mutable_location() = job.job_reference().location();
+  auto& normalized_query = *normalized.mutable_configuration()->mutable_query();
+  normalized_query.set_query(NormalizeQuery(query.query()));
+  *normalized_query.mutable_query_parameters() = query.query_parameters();
+  normalized_query.set_parameter_mode(query.parameter_mode());
+  *normalized_query.mutable_default_dataset() = query.default_dataset();
+  *normalized_query.mutable_use_legacy_sql() = query.use_legacy_sql();
+
+  std::string key;
+  {
+    google::protobuf::io::StringOutputStream output(&key);
+    google::protobuf::io::CodedOutputStream coded(&output);
+    coded.SetSerializationDeterministic(true);
+    normalized.SerializeToCodedStream(&coded);
+  }
+  return key;
+}
+
+bool QueryCache::MayModifyTables(google::cloud::bigquery::v2::Job const& job) {
+  auto const& configuration = job.configuration();
+  if (configuration.dry_run().value()) return false;
+  if (configuration.has_load() || configuration.has_copy()) return true;
+  if (!configuration.has_query()) return false;
+  return configuration.query().has_destination_table() ||
+         !IsReadOnly(QuerySkeleton(configuration.query().query()));
+}
+
+bool QueryCache::HasResults(google::cloud::bigquery::v2::Job const& job) {
+  return job.status().state() == "DONE" && !job.status().has_error_result() &&
+         job.configuration().query().has_destination_table();
+}
+
+std::string QueryCache::NormalizeQuery(std::string const& query) {
+  return ScanQuery(query, /*keep_quoted=*/true);
+}
+
+void QueryCache::EvictExpired(std::chrono::system_clock::time_point now) {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->second.expire_time <= now) {
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
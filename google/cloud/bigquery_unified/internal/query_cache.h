@@ -0,0 +1,111 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_QUERY_CACHE_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_QUERY_CACHE_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include "absl/types/optional.h"
+#include <google/cloud/bigquery/v2/job.pb.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Caches completed query jobs keyed by the query that created them.
+ *
+ * The cached job references the destination table holding the query results,
+ * reading that table returns the same results as running the query again, as
+ * long as the underlying data has not changed. Each entry is kept for the
+ * time to live given when it was inserted.
+ */
+class QueryCache {
+ public:
+  using Clock = std::function<std::chrono::system_clock::time_point()>;
+
+  explicit QueryCache(Clock clock = std::chrono::system_clock::now)
+      : clock_(std::move(clock)) {}
+
+  absl::optional<google::cloud::bigquery::v2::Job> Lookup(
+      std::string const& key);
+
+  /**
+   * Caches @p job, evicting the entries closest to expiration to keep at most
+   * @p capacity entries.
+   *
+   * @p generation is the value of `generation()` when the job started. If the
+   * cache was cleared since, the job may have read the data that invalidated
+   * the cache, and it is not cached.
+   */
+  void Insert(std::string key, google::cloud::bigquery::v2::Job job,
+              std::chrono::milliseconds ttl, std::size_t capacity,
+              std::uint64_t generation);
+
+  /// Discards all the cached entries, and starts a new generation.
+  void Clear();
+
+  /// The number of times the cache was cleared.
+  std::uint64_t generation() const;
+
+  std::size_t size() const;
+
+  /**
+   * Returns the cache key for @p job, or `absl::nullopt` if the job results
+   * cannot be cached.
+   *
+   * Only read-only, deterministic queries writing to an anonymous destination
+   * table can be cached. Jobs with an id set by the caller are never served
+   * from the cache, as the caller expects a job with that id to exist.
+   *
+   * Jobs without a project in their reference run in @p billing_project, so
+   * the key uses that project instead.
+   */
+  static absl::optional<std::string> Key(
+      google::cloud::bigquery::v2::Job const& job,
+      std::string const& billing_project = {});
+
+  /// Returns true if @p job may change the contents of any table.
+  static bool MayModifyTables(google::cloud::bigquery::v2::Job const& job);
+
+  /// Returns true if @p job completed successfully and has results to read.
+  static bool HasResults(google::cloud::bigquery::v2::Job const& job);
+
+  /// Collapses whitespace outside of quoted strings and identifiers.
+  static std::string NormalizeQuery(std::string const& query);
+
+ private:
+  struct Entry {
+    google::cloud::bigquery::v2::Job job;
+    std::chrono::system_clock::time_point expire_time;
+  };
+
+  void EvictExpired(std::chrono::system_clock::time_point now);
+
+  Clock clock_;
+  mutable std::mutex mu_;
+  std::map<std::string, Entry> entries_;
+  std::uint64_t generation_ = 0;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_QUERY_CACHE_H
@@ -0,0 +1,307 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/query_cache_connection.h"
+#include "google/cloud/bigquery_unified/internal/read_strategy.h"
+#include "google/cloud/bigquery_unified/job_options.h"
+#include "google/cloud/internal/absl_str_cat_quiet.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/options.h"
+#include <algorithm>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+// The jobs without a project run in the billing project, if any.
+absl::optional<std::string> CacheKey(
+    google::cloud::bigquery::v2::Job const& job,
+    Options const& current_options) {
+  return QueryCache::Key(
+      job, current_options.get<bigquery_unified::BillingProjectOption>());
+}
+
+// Reads the destination table of the completed query @p job, like
+// `Connection::QueryArrow()`.
+StatusOr<bigquery_unified::ReadArrowResponse> ReadQueryResults(
+    bigquery_unified::Connection& child,
+    google::cloud::bigquery::v2::Job const& job, Options opts,
+    Options const& current_options) {
+  if (job.status().has_error_result()) {
+    auto const& error = job.status().error_result();
+    return internal::UnknownError(
+        absl::StrCat("Job ", job.job_reference().job_id(),
+                     " failed: ", error.message()),
+        GCP_ERROR_INFO().WithMetadata("reason", error.reason()));
+  }
+  auto billing_project =
+      current_options.has<bigquery_unified::BillingProjectOption>()
+          ? current_options.get<bigquery_unified::BillingProjectOption>()
+          : job.job_reference().project_id();
+  auto request = MakeReadSessionRequest(
+      job.configuration().query().destination_table(),
+      std::move(billing_project), current_options, EstimateJobResultRows(job));
+  return child.ReadArrow(request, std::move(opts));
+}
+
+}  // namespace
+
+QueryCacheConnection::QueryCacheConnection(
+    std::shared_ptr<bigquery_unified::Connection> child,
+    std::shared_ptr<QueryCache> cache)
+    : child_(std::move(child)),
+      cache_(std::move(cache)),
+      options_(child_->options()),
+      capacity_(options_.get<bigquery_unified::QueryCacheSizeOption>()) {}
+
+future<Status> QueryCacheConnection::WarmUp(Options opts) {
+  return child_->WarmUp(std::move(opts));
+}
+
+future<StatusOr<google::cloud::bigquery::v2::Job>>
+QueryCacheConnection::CancelJob(
+    google::cloud::bigquery::v2::CancelJobRequest const& request,
+    Options opts) {
+  return child_->CancelJob(request, std::move(opts));
+}
+
+StatusOr<google::cloud::bigquery::v2::JobReference>
+QueryCacheConnection::CancelJob(
+    google::cloud::NoAwaitTag,
+    google::cloud::bigquery::v2::CancelJobRequest const& request,
+    Options opts) {
+  return child_->CancelJob(NoAwaitTag{}, request, std::move(opts));
+}
+
+future<StatusOr<google::cloud::bigquery::v2::Job>>
+QueryCacheConnection::CancelJob(
+    google::cloud::bigquery::v2::JobReference const& job_reference,
+    Options opts) {
+  return child_->CancelJob(job_reference, std::move(opts));
+}
+
+StatusOr<google::cloud::bigquery::v2::Job> QueryCacheConnection::GetJob(
+    google::cloud::bigquery::v2::GetJobRequest const& request, Options opts) {
+  return child_->GetJob(request, std::move(opts));
+}
+
+future<StatusOr<google::cloud::bigquery::v2::Job>>
+QueryCacheConnection::InsertJob(google::cloud::bigquery::v2::Job const& job,
+                                Options opts) {
+  auto current_options = internal::MergeOptions(opts, options_);
+  auto key = CacheKey(job, current_options);
+  auto cached = Lookup(key, current_options);
+  if (cached) {
+    return make_ready_future(
+        StatusOr<google::cloud::bigquery::v2::Job>(*std::move(cached)));
+  }
+  auto const invalidate = !key && QueryCache::MayModifyTables(job);
+  if (invalidate) cache_->Clear();
+  auto const generation = cache_->generation();
+  return OnCompletion(child_->InsertJob(job, std::move(opts)), std::move(key),
+                      invalidate, generation, current_options);
+}
+
+StatusOr<google::cloud::bigquery::v2::JobReference>
+QueryCacheConnection::InsertJob(google::cloud::NoAwaitTag,
+                                google::cloud::bigquery::v2::Job const& job,
+                                Options opts) {
+  auto current_options = internal::MergeOptions(opts, options_);
+  auto key = CacheKey(job, current_options);
+  auto cached = Lookup(key, current_options);
+  if (cached) return cached->job_reference();
+  // The job is not awaited, so the cache can only be invalidated when the job
+  // starts.
+  if (!key && QueryCache::MayModifyTables(job)) cache_->Clear();
+  return child_->InsertJob(NoAwaitTag{}, job, std::move(opts));
+}
+
+future<StatusOr<google::cloud::bigquery::v2::Job>>
+QueryCacheConnection::InsertJob(
+    google::cloud::bigquery::v2::JobReference const& job_reference,
+    Options opts) {
+  return child_->InsertJob(job_reference, std::move(opts));
+}
+
+std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>>
+QueryCacheConnection::InsertJobs(
+    std::vector<google::cloud::bigquery::v2::Job> jobs, Options opts) {
+  std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>> result(
+      jobs.size());
+  auto current_options = internal::MergeOptions(opts, options_);
+  std::vector<google::cloud::bigquery::v2::Job> uncached;
+  std::vector<std::size_t> uncached_index;
+  std::vector<absl::optional<std::string>> uncached_keys;
+  std::vector<bool> uncached_invalidate;
+  for (std::size_t i = 0; i != jobs.size(); ++i) {
+    auto key = CacheKey(jobs[i], current_options);
+    auto cached = Lookup(key, current_options);
+    if (cached) {
+      result[i] = make_ready_future(
+          StatusOr<google::cloud::bigquery::v2::Job>(*std::move(cached)));
+      continue;
+    }
+    uncached_invalidate.push_back(!key &&
+                                  QueryCache::MayModifyTables(jobs[i]));
+    uncached.push_back(std::move(jobs[i]));
+    uncached_index.push_back(i);
+    uncached_keys.push_back(std::move(key));
+  }
+  if (uncached.empty()) return result;
+  if (std::find(uncached_invalidate.begin(), uncached_invalidate.end(),
+                true) != uncached_invalidate.end()) {
+    cache_->Clear();
+  }
+
+  auto const generation = cache_->generation();
+  auto pending = child_->InsertJobs(std::move(uncached), std::move(opts));
+  for (std::size_t n = 0; n != pending.size(); ++n) {
+    result[uncached_index[n]] =
+        OnCompletion(std::move(pending[n]), std::move(uncached_keys[n]),
+                     uncached_invalidate[n], generation, current_options);
+  }
+  return result;
+}
+
+Status QueryCacheConnection::DeleteJob(
+    google::cloud::bigquery::v2::DeleteJobRequest const& request,
+    Options opts) {
+  return child_->DeleteJob(request, std::move(opts));
+}
+
+StatusOr<std::vector<bigquery_unified::JobOperationResult>>
+QueryCacheConnection::CancelJobs(bigquery_unified::JobFilter const& filter,
+                                 Options opts) {
+  return child_->CancelJobs(filter, std::move(opts));
+}
+
+StatusOr<std::vector<bigquery_unified::JobOperationResult>>
+QueryCacheConnection::DeleteJobs(bigquery_unified::JobFilter const& filter,
+                                 Options opts) {
+  return child_->DeleteJobs(filter, std::move(opts));
+}
+
+StreamRange<google::cloud::bigquery::v2::ListFormatJob>
+QueryCacheConnection::ListJobs(
+    google::cloud::bigquery::v2::ListJobsRequest request, Options opts) {
+  return child_->ListJobs(std::move(request), std::move(opts));
+}
+
+StreamRange<google::cloud::bigquery::v2::ListFormatJob>
+QueryCacheConnection::ListJobsInProjects(
+    std::vector<google::cloud::bigquery::v2::ListJobsRequest> requests,
+    Options opts) {
+  return child_->ListJobsInProjects(std::move(requests), std::move(opts));
+}
+
+StatusOr<bigquery_unified::ReadArrowResponse> QueryCacheConnection::ReadArrow(
+    google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+        read_session,
+    Options opts) {
+  return child_->ReadArrow(read_session, std::move(opts));
+}
+
+StatusOr<bigquery_unified::ReadArrowPartitionsResponse>
+QueryCacheConnection::ReadArrowPartitions(
+    std::map<std::string,
+             google::cloud::bigquery::storage::v1::CreateReadSessionRequest>
+        partition_requests,
+    Options opts) {
+  return child_->ReadArrowPartitions(std::move(partition_requests),
+                                     std::move(opts));
+}
+
+future<StatusOr<bigquery_unified::ReadArrowResponse>>
+QueryCacheConnection::QueryArrow(google::cloud::bigquery::v2::Job const& job,
+                                 Options opts) {
+  using ResponseType = StatusOr<bigquery_unified::ReadArrowResponse>;
+  auto current_options = internal::MergeOptions(opts, options_);
+  auto key = CacheKey(job, current_options);
+  if (key) {
+    // A cacheable query reads the destination table of the cached job. On a
+    // miss the query runs as in `InsertJob()`, which caches the completed job,
+    // then its destination table is read.
+    auto cached = Lookup(key, current_options);
+    if (cached) {
+      return make_ready_future(
+          ReadQueryResults(*child_, *cached, std::move(opts), current_options));
+    }
+    return InsertJob(job, opts).then(
+        [child = child_, opts, current_options](
+            future<StatusOr<google::cloud::bigquery::v2::Job>> f) mutable
+        -> ResponseType {
+          auto done = f.get();
+          if (!done) return std::move(done).status();
+          return ReadQueryResults(*child, *done, std::move(opts),
+                                  current_options);
+        });
+  }
+  // Other queries are not cached, but a query that modifies tables still
+  // invalidates the cache.
+  if (!QueryCache::MayModifyTables(job)) {
+    return child_->QueryArrow(job, std::move(opts));
+  }
+  cache_->Clear();
+  return child_->QueryArrow(job, std::move(opts))
+      .then([cache = cache_](
+                future<StatusOr<bigquery_unified::ReadArrowResponse>> f) {
+        cache->Clear();
+        return f.get();
+      });
+}
+
+StatusOr<std::shared_ptr<arrow::Schema>> QueryCacheConnection::GetArrowSchema(
+    google::cloud::bigquery::v2::GetTableRequest const& request,
+    Options opts) {
+  return child_->GetArrowSchema(request, std::move(opts));
+}
+
+absl::optional<google::cloud::bigquery::v2::Job> QueryCacheConnection::Lookup(
+    absl::optional<std::string> const& key, Options const& opts) {
+  if (!key || opts.get<bigquery_unified::QueryCacheRefreshOption>()) {
+    return absl::nullopt;
+  }
+  return cache_->Lookup(*key);
+}
+
+future<StatusOr<google::cloud::bigquery::v2::Job>>
+QueryCacheConnection::OnCompletion(
+    future<StatusOr<google::cloud::bigquery::v2::Job>> pending,
+    absl::optional<std::string> key, bool invalidate, std::uint64_t generation,
+    Options const& opts) {
+  if (!key && !invalidate) return pending;
+  return pending.then(
+      [cache = cache_, key = std::move(key), invalidate, generation,
+       ttl = opts.get<bigquery_unified::QueryCacheTtlOption>(),
+       capacity = capacity_](auto f) {
+        auto job = f.get();
+        if (invalidate) {
+          cache->Clear();
+        } else if (job && QueryCache::HasResults(*job)) {
+          cache->Insert(*key, *job, ttl, capacity, generation);
+        }
+        return job;
+      });
+}
+
+std::shared_ptr<bigquery_unified::Connection> MakeQueryCacheConnection(
+    std::shared_ptr<bigquery_unified::Connection> conn) {
+  if (conn->options().get<bigquery_unified::QueryCacheSizeOption>() != 0) {
+    conn = std::make_shared<QueryCacheConnection>(std::move(conn));
+  }
+  return conn;
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,154 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_QUERY_CACHE_CONNECTION_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_QUERY_CACHE_CONNECTION_H
+
+#include "google/cloud/bigquery_unified/connection.h"
+#include "google/cloud/bigquery_unified/internal/query_cache.h"
+#include "google/cloud/bigquery_unified/version.h"
+#include "absl/types/optional.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Serves repeated queries from the results of a recent identical query.
+ *
+ * Awaiting `InsertJob()` for a cacheable query (see `QueryCache::Key()`)
+ * returns the last completed job for that query, if it has not expired, without
+ * calling the child connection. Reading the results of that job reads its
+ * destination table, which is not modified after the query completes.
+ * `QueryArrow()` for a cacheable query reads the destination table of the
+ * cached job the same way, and caches the job it runs on a miss.
+ *
+ * Jobs that may modify tables invalidate the whole cache, both when they are
+ * started and when they complete. Queries running while the cache is
+ * invalidated may have read the old data, so their results are not cached.
+ */
+class QueryCacheConnection : public bigquery_unified::Connection {
+ public:
+  ~QueryCacheConnection() override = default;
+
+  explicit QueryCacheConnection(
+      std::shared_ptr<bigquery_unified::Connection> child,
+      std::shared_ptr<QueryCache> cache = std::make_shared<QueryCache>());
+
+  Options options() override { return child_->options(); }
+
+  future<Status> WarmUp(Options opts) override;
+
+  future<StatusOr<google::cloud::bigquery::v2::Job>> CancelJob(
+      google::cloud::bigquery::v2::CancelJobRequest const& request,
+      Options opts) override;
+
+  StatusOr<google::cloud::bigquery::v2::JobReference> CancelJob(
+      google::cloud::NoAwaitTag,
+      google::cloud::bigquery::v2::CancelJobRequest const& request,
+      Options opts) override;
+
+  future<StatusOr<google::cloud::bigquery::v2::Job>> CancelJob(
+      google::cloud::bigquery::v2::JobReference const& job_reference,
+      Options opts) override;
+
+  StatusOr<google::cloud::bigquery::v2::Job> GetJob(
+      google::cloud::bigquery::v2::GetJobRequest const& request,
+      Options opts) override;
+
+  future<StatusOr<google::cloud::bigquery::v2::Job>> InsertJob(
+      google::cloud::bigquery::v2::Job const& job, Options opts) override;
+
+  StatusOr<google::cloud::bigquery::v2::JobReference> InsertJob(
+      google::cloud::NoAwaitTag, google::cloud::bigquery::v2::Job const& job,
+      Options opts) override;
+
+  future<StatusOr<google::cloud::bigquery::v2::Job>> InsertJob(
+      google::cloud::bigquery::v2::JobReference const& job_reference,
+      Options opts) override;
+
+  std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>> InsertJobs(
+      std::vector<google::cloud::bigquery::v2::Job> jobs,
+      Options opts) override;
+
+  Status DeleteJob(google::cloud::bigquery::v2::DeleteJobRequest const& request,
+                   Options opts) override;
+
+  StatusOr<std::vector<bigquery_unified::JobOperationResult>> CancelJobs(
+      bigquery_unified::JobFilter const& filter, Options opts) override;
+
+  StatusOr<std::vector<bigquery_unified::JobOperationResult>> DeleteJobs(
+      bigquery_unified::JobFilter const& filter, Options opts) override;
+
+  StreamRange<google::cloud::bigquery::v2::ListFormatJob> ListJobs(
+      google::cloud::bigquery::v2::ListJobsRequest request,
+      Options opts) override;
+
+  StreamRange<google::cloud::bigquery::v2::ListFormatJob> ListJobsInProjects(
+      std::vector<google::cloud::bigquery::v2::ListJobsRequest> requests,
+      Options opts) override;
+
+  StatusOr<bigquery_unified::ReadArrowResponse> ReadArrow(
+      google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+          read_session,
+      Options opts) override;
+
+  StatusOr<bigquery_unified::ReadArrowPartitionsResponse> ReadArrowPartitions(
+      std::map<std::string,
+               google::cloud::bigquery::storage::v1::CreateReadSessionRequest>
+          partition_requests,
+      Options opts) override;
+
+  future<StatusOr<bigquery_unified::ReadArrowResponse>> QueryArrow(
+      google::cloud::bigquery::v2::Job const& job, Options opts) override;
+
+  StatusOr<std::shared_ptr<arrow::Schema>> GetArrowSchema(
+      google::cloud::bigquery::v2::GetTableRequest const& request,
+      Options opts) override;
+
+ private:
+  // Returns the cached job for @p key, unless the cache is bypassed.
+  absl::optional<google::cloud::bigquery::v2::Job> Lookup(
+      absl::optional<std::string> const& key, Options const& opts);
+
+  // Caches the results of the awaited job, or invalidates the cache if the
+  // job may have modified any table. @p generation is the generation of the
+  // cache when the job started.
+  future<StatusOr<google::cloud::bigquery::v2::Job>> OnCompletion(
+      future<StatusOr<google::cloud::bigquery::v2::Job>> pending,
+      absl::optional<std::string> key, bool invalidate,
+      std::uint64_t generation, Options const& opts);
+
+  std::shared_ptr<bigquery_unified::Connection> child_;
+  std::shared_ptr<QueryCache> cache_;
+  Options options_;
+  std::size_t capacity_;
+};
+
+/**
+ * Conditionally applies the query cache decorator to the given connection.
+ *
+ * The connection is only decorated if `QueryCacheSizeOption` is set to a
+ * positive value in the connection's options.
+ */
+std::shared_ptr<bigquery_unified::Connection> MakeQueryCacheConnection(
+    std::shared_ptr<bigquery_unified::Connection> conn);
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_QUERY_CACHE_CONNECTION_H
@@ -0,0 +1,336 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/query_cache_connection.h"
+#include "google/cloud/bigquery_unified/job_options.h"
+#include "google/cloud/bigquery_unified/mocks/mock_connection.h"
+#include "google/cloud/bigquery_unified/testing_util/status_matchers.h"
+#include "google/cloud/internal/make_status.h"
+#include <gmock/gmock.h>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery::v2::Job;
+using ::google::cloud::bigquery_unified::testing_util::IsOk;
+using ::google::cloud::bigquery_unified::testing_util::StatusIs;
+using ::google::cloud::bigquery_unified_mocks::MockConnection;
+using ::testing::_;
+using ::testing::A;
+using ::testing::EndsWith;
+using ::testing::Eq;
+using ::testing::IsNull;
+using ::testing::Not;
+using ::testing::NotNull;
+using ::testing::Return;
+using ::testing::SizeIs;
+
+Options TestOptions() {
+  return Options{}
+      .set<bigquery_unified::QueryCacheSizeOption>(10)
+      .set<bigquery_unified::QueryCacheTtlOption>(std::chrono::minutes(5));
+}
+
+Job MakeQueryJob(std::string const& query) {
+  Job job;
+  job.mutable_job_reference()->set_project_id("my-project");
+  job.mutable_configuration()->mutable_query()->set_query(query);
+  return job;
+}
+
+// Simulates the service, completing each job with a new job id.
+auto CompleteJob() {
+  return [n = 0](Job const& job, Options const&) mutable {
+    auto done = job;
+    done.mutable_job_reference()->set_job_id("job-" + std::to_string(++n));
+    done.mutable_status()->set_state("DONE");
+    done.mutable_configuration()
+        ->mutable_query()
+        ->mutable_destination_table()
+        ->set_table_id("anon" + std::to_string(n));
+    return make_ready_future(StatusOr<Job>(std::move(done)));
+  };
+}
+
+std::shared_ptr<MockConnection> MakeMock() {
+  auto mock = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock, options).WillRepeatedly(Return(TestOptions()));
+  return mock;
+}
+
+TEST(QueryCacheConnectionTest, InsertJobCachesResults) {
+  auto mock = MakeMock();
+  EXPECT_CALL(*mock, InsertJob(A<Job const&>(), _))
+      .Times(2)
+      .WillRepeatedly(CompleteJob());
+
+  auto under_test = QueryCacheConnection(mock);
+  auto first = under_test.InsertJob(MakeQueryJob("SELECT a FROM t"), {}).get();
+  ASSERT_STATUS_OK(first);
+  EXPECT_THAT(first->job_reference().job_id(), Eq("job-1"));
+
+  auto second =
+      under_test.InsertJob(MakeQueryJob("SELECT a\n  FROM t"), {}).get();
+  ASSERT_STATUS_OK(second);
+  EXPECT_THAT(second->job_reference().job_id(), Eq("job-1"));
+
+  auto reference =
+      under_test.InsertJob(NoAwaitTag{}, MakeQueryJob("SELECT a FROM t"), {});
+  ASSERT_STATUS_OK(reference);
+  EXPECT_THAT(reference->job_id(), Eq("job-1"));
+
+  auto refreshed =
+      under_test
+          .InsertJob(MakeQueryJob("SELECT a FROM t"),
+                     Options{}.set<bigquery_unified::QueryCacheRefreshOption>(
+                         true))
+          .get();
+  ASSERT_STATUS_OK(refreshed);
+  EXPECT_THAT(refreshed->job_reference().job_id(), Eq("job-2"));
+
+  auto third = under_test.InsertJob(MakeQueryJob("SELECT a FROM t"), {}).get();
+  ASSERT_STATUS_OK(third);
+  EXPECT_THAT(third->job_reference().job_id(), Eq("job-2"));
+}
+
+TEST(QueryCacheConnectionTest, InsertJobDoesNotCacheErrors) {
+  auto mock = MakeMock();
+  EXPECT_CALL(*mock, InsertJob(A<Job const&>(), _))
+      .WillOnce([](Job const&, Options const&) {
+        return make_ready_future(
+            StatusOr<Job>(internal::InvalidArgumentError("bad query")));
+      })
+      .WillOnce(CompleteJob());
+
+  auto under_test = QueryCacheConnection(mock);
+  auto first = under_test.InsertJob(MakeQueryJob("SELECT a FROM t"), {}).get();
+  EXPECT_THAT(first, Not(IsOk()));
+  auto second =
+      under_test.InsertJob(MakeQueryJob("SELECT a FROM t"), {}).get();
+  ASSERT_STATUS_OK(second);
+}
+
+TEST(QueryCacheConnectionTest, InsertJobWithJobIdIsNotCached) {
+  auto mock = MakeMock();
+  EXPECT_CALL(*mock, InsertJob(A<Job const&>(), _))
+      .Times(2)
+      .WillRepeatedly(CompleteJob());
+
+  auto cache = std::make_shared<QueryCache>();
+  auto under_test = QueryCacheConnection(mock, cache);
+  ASSERT_STATUS_OK(
+      under_test.InsertJob(MakeQueryJob("SELECT a FROM t"), {}).get());
+  EXPECT_EQ(cache->size(), 1U);
+
+  auto job = MakeQueryJob("SELECT a FROM t");
+  job.mutable_job_reference()->set_job_id("my-job");
+  auto result = under_test.InsertJob(job, {}).get();
+  ASSERT_STATUS_OK(result);
+  EXPECT_THAT(result->job_reference().job_id(), Eq("job-2"));
+}
+
+TEST(QueryCacheConnectionTest, InsertJobUsesBillingProject) {
+  auto mock = MakeMock();
+  EXPECT_CALL(*mock, InsertJob(A<Job const&>(), _))
+      .Times(2)
+      .WillRepeatedly(CompleteJob());
+
+  auto under_test = QueryCacheConnection(mock);
+  ASSERT_STATUS_OK(
+      under_test.InsertJob(MakeQueryJob("SELECT a FROM t"), {}).get());
+
+  // A job without a project runs in the billing project.
+  auto job = MakeQueryJob("SELECT a FROM t");
+  job.mutable_job_reference()->clear_project_id();
+  auto billed =
+      under_test
+          .InsertJob(job, Options{}.set<bigquery_unified::BillingProjectOption>(
+                              "my-project"))
+          .get();
+  ASSERT_STATUS_OK(billed);
+  EXPECT_THAT(billed->job_reference().job_id(), Eq("job-1"));
+
+  auto other =
+      under_test
+          .InsertJob(job, Options{}.set<bigquery_unified::BillingProjectOption>(
+                              "other-project"))
+          .get();
+  ASSERT_STATUS_OK(other);
+  EXPECT_THAT(other->job_reference().job_id(), Eq("job-2"));
+}
+
+TEST(QueryCacheConnectionTest, ModifyingJobInvalidates) {
+  auto mock = MakeMock();
+  EXPECT_CALL(*mock, InsertJob(A<Job const&>(), _))
+      .Times(3)
+      .WillRepeatedly(CompleteJob());
+
+  auto cache = std::make_shared<QueryCache>();
+  auto under_test = QueryCacheConnection(mock, cache);
+  ASSERT_STATUS_OK(
+      under_test.InsertJob(MakeQueryJob("SELECT a FROM t"), {}).get());
+  EXPECT_EQ(cache->size(), 1U);
+
+  ASSERT_STATUS_OK(
+      under_test.InsertJob(MakeQueryJob("DELETE FROM t WHERE a > 1"), {})
+          .get());
+  EXPECT_EQ(cache->size(), 0U);
+
+  auto job = under_test.InsertJob(MakeQueryJob("SELECT a FROM t"), {}).get();
+  ASSERT_STATUS_OK(job);
+  EXPECT_THAT(job->job_reference().job_id(), Eq("job-3"));
+}
+
+TEST(QueryCacheConnectionTest, QueryRunningDuringInvalidationIsNotCached) {
+  auto mock = MakeMock();
+  promise<StatusOr<Job>> slow_query;
+  EXPECT_CALL(*mock, InsertJob(A<Job const&>(), _))
+      .WillOnce([&](Job const&, Options const&) {
+        return slow_query.get_future();
+      })
+      .WillOnce(CompleteJob());
+
+  auto cache = std::make_shared<QueryCache>();
+  auto under_test = QueryCacheConnection(mock, cache);
+  auto pending = under_test.InsertJob(MakeQueryJob("SELECT a FROM t"), {});
+  ASSERT_STATUS_OK(
+      under_test.InsertJob(MakeQueryJob("DELETE FROM t WHERE a > 1"), {})
+          .get());
+
+  // The query may have read the rows deleted above.
+  auto done = CompleteJob()(MakeQueryJob("SELECT a FROM t"), {}).get();
+  ASSERT_STATUS_OK(done);
+  slow_query.set_value(*done);
+  ASSERT_STATUS_OK(pending.get());
+  EXPECT_EQ(cache->size(), 0U);
+}
+
+TEST(QueryCacheConnectionTest, InsertJobsSkipsCachedJobs) {
+  auto mock = MakeMock();
+  EXPECT_CALL(*mock, InsertJob(A<Job const&>(), _)).WillOnce(CompleteJob());
+  EXPECT_CALL(*mock, InsertJobs)
+      .WillOnce([](std::vector<Job> const& jobs, Options const& opts) {
+        EXPECT_THAT(jobs, SizeIs(1));
+        std::vector<future<StatusOr<Job>>> result;
+        auto complete = CompleteJob();
+        for (auto const& job : jobs) result.push_back(complete(job, opts));
+        return result;
+      });
+
+  auto under_test = QueryCacheConnection(mock);
+  ASSERT_STATUS_OK(
+      under_test.InsertJob(MakeQueryJob("SELECT a FROM t"), {}).get());
+
+  auto result = under_test.InsertJobs(
+      {MakeQueryJob("SELECT a FROM t"), MakeQueryJob("SELECT b FROM t")}, {});
+  ASSERT_THAT(result, SizeIs(2));
+  auto cached = result[0].get();
+  ASSERT_STATUS_OK(cached);
+  EXPECT_THAT(cached->job_reference().job_id(), Eq("job-1"));
+  auto inserted = result[1].get();
+  ASSERT_STATUS_OK(inserted);
+  EXPECT_THAT(inserted->configuration().query().query(),
+              Eq("SELECT b FROM t"));
+}
+
+TEST(QueryCacheConnectionTest, QueryArrowReadsCachedJob) {
+  auto mock = MakeMock();
+  EXPECT_CALL(*mock, QueryArrow).Times(0);
+  EXPECT_CALL(*mock, InsertJob(A<Job const&>(), _)).WillOnce(CompleteJob());
+  EXPECT_CALL(*mock, ReadArrow)
+      .Times(3)
+      .WillRepeatedly([](google::cloud::bigquery::storage::v1::
+                             CreateReadSessionRequest const& request,
+                         Options const&) {
+        EXPECT_THAT(request.read_session().table(), EndsWith("/tables/anon1"));
+        return bigquery_unified::ReadArrowResponse{};
+      });
+
+  auto cache = std::make_shared<QueryCache>();
+  auto under_test = QueryCacheConnection(mock, cache);
+  // A miss runs the query and caches the completed job.
+  EXPECT_THAT(under_test.QueryArrow(MakeQueryJob("SELECT a FROM t"), {}).get(),
+              IsOk());
+  EXPECT_EQ(cache->size(), 1U);
+  EXPECT_THAT(under_test.QueryArrow(MakeQueryJob("SELECT a FROM t"), {}).get(),
+              IsOk());
+
+  // The job cached by `QueryArrow()` also serves `InsertJob()`, and the
+  // other way around.
+  auto job = under_test.InsertJob(MakeQueryJob("SELECT a FROM t"), {}).get();
+  ASSERT_STATUS_OK(job);
+  EXPECT_THAT(job->job_reference().job_id(), Eq("job-1"));
+  EXPECT_THAT(under_test.QueryArrow(MakeQueryJob("SELECT a FROM t"), {}).get(),
+              IsOk());
+}
+
+TEST(QueryCacheConnectionTest, QueryArrowDoesNotReadFailedJob) {
+  auto mock = MakeMock();
+  EXPECT_CALL(*mock, InsertJob(A<Job const&>(), _))
+      .WillOnce([](Job const& job, Options const&) {
+        auto done = job;
+        done.mutable_job_reference()->set_job_id("job-1");
+        done.mutable_status()->set_state("DONE");
+        done.mutable_status()->mutable_error_result()->set_message("uh-oh");
+        return make_ready_future(StatusOr<Job>(std::move(done)));
+      });
+  EXPECT_CALL(*mock, ReadArrow).Times(0);
+
+  auto cache = std::make_shared<QueryCache>();
+  auto under_test = QueryCacheConnection(mock, cache);
+  EXPECT_THAT(under_test.QueryArrow(MakeQueryJob("SELECT a FROM t"), {}).get(),
+              StatusIs(StatusCode::kUnknown));
+  EXPECT_EQ(cache->size(), 0U);
+}
+
+TEST(QueryCacheConnectionTest, QueryArrowModifyingJobInvalidates) {
+  auto mock = MakeMock();
+  EXPECT_CALL(*mock, InsertJob(A<Job const&>(), _)).WillOnce(CompleteJob());
+  EXPECT_CALL(*mock, QueryArrow).WillOnce([] {
+    return make_ready_future(StatusOr<bigquery_unified::ReadArrowResponse>(
+        bigquery_unified::ReadArrowResponse{}));
+  });
+
+  auto cache = std::make_shared<QueryCache>();
+  auto under_test = QueryCacheConnection(mock, cache);
+  ASSERT_STATUS_OK(
+      under_test.InsertJob(MakeQueryJob("SELECT a FROM t"), {}).get());
+  EXPECT_EQ(cache->size(), 1U);
+  EXPECT_THAT(
+      under_test.QueryArrow(MakeQueryJob("DELETE FROM t WHERE a > 1"), {})
+          .get(),
+      IsOk());
+  EXPECT_EQ(cache->size(), 0U);
+}
+
+TEST(QueryCacheConnectionTest, MakeQueryCacheConnection) {
+  auto disabled = std::make_shared<MockConnection>();
+  EXPECT_CALL(*disabled, options).WillRepeatedly(Return(Options{}));
+  auto connection = MakeQueryCacheConnection(disabled);
+  EXPECT_THAT(dynamic_cast<QueryCacheConnection*>(connection.get()),
+              IsNull());
+
+  connection = MakeQueryCacheConnection(MakeMock());
+  EXPECT_THAT(dynamic_cast<QueryCacheConnection*>(connection.get()),
+              NotNull());
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
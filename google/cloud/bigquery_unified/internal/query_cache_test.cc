@@ -0,0 +1,226 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/query_cache.h"
+#include <gmock/gmock.h>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery::v2::Job;
+
+Job MakeQueryJob(std::string const& query) {
+  Job job;
+  job.mutable_job_reference()->set_project_id("my-project");
+  job.mutable_configuration()->mutable_query()->set_query(query);
+  return job;
+}
+
+bool IsCacheable(std::string const& query) {
+  return QueryCache::Key(MakeQueryJob(query)).has_value();
+}
+
+Job MakeDoneJob(std::string const& job_id) {
+  Job job;
+  job.mutable_job_reference()->set_job_id(job_id);
+  job.mutable_status()->set_state("DONE");
+  job.mutable_configuration()
+      ->mutable_query()
+      ->mutable_destination_table()
+      ->set_table_id("anon" + job_id);
+  return job;
+}
+
+TEST(QueryCache, NormalizeQuery) {
+  EXPECT_EQ(QueryCache::NormalizeQuery("  SELECT\n\t a ,  b\nFROM t  "),
+            "SELECT a , b FROM t");
+  EXPECT_EQ(QueryCache::NormalizeQuery("SELECT 'a  b', \"c \\\"  d\""),
+            "SELECT 'a  b', \"c \\\"  d\"");
+  EXPECT_EQ(QueryCache::NormalizeQuery("SELECT 1 -- x  y\n  , 2"),
+            "SELECT 1 -- x  y\n , 2");
+}
+
+TEST(QueryCache, KeyIgnoresWhitespace) {
+  auto a = QueryCache::Key(MakeQueryJob("SELECT a FROM t"));
+  auto b = QueryCache::Key(MakeQueryJob("SELECT  a\n  FROM t\n"));
+  ASSERT_TRUE(a.has_value());
+  ASSERT_TRUE(b.has_value());
+  EXPECT_EQ(*a, *b);
+
+  auto c = QueryCache::Key(MakeQueryJob("SELECT b FROM t"));
+  ASSERT_TRUE(c.has_value());
+  EXPECT_NE(*a, *c);
+}
+
+TEST(QueryCache, KeyIncludesParametersAndDefaultDataset) {
+  auto job = MakeQueryJob("SELECT a FROM t WHERE b = @b");
+  auto const base = QueryCache::Key(job);
+
+  auto with_dataset = job;
+  with_dataset.mutable_configuration()
+      ->mutable_query()
+      ->mutable_default_dataset()
+      ->set_dataset_id("d");
+  auto with_parameter = job;
+  auto& parameter = *with_parameter.mutable_configuration()
+                         ->mutable_query()
+                         ->add_query_parameters();
+  parameter.set_name("b");
+  parameter.mutable_parameter_value()->mutable_value()->set_value("1");
+
+  auto const dataset_key = QueryCache::Key(with_dataset);
+  auto const parameter_key = QueryCache::Key(with_parameter);
+  ASSERT_TRUE(base.has_value());
+  ASSERT_TRUE(dataset_key.has_value());
+  ASSERT_TRUE(parameter_key.has_value());
+  EXPECT_NE(*base, *dataset_key);
+  EXPECT_NE(*base, *parameter_key);
+}
+
+TEST(QueryCache, KeyUsesBillingProject) {
+  auto const in_project = QueryCache::Key(MakeQueryJob("SELECT a FROM t"));
+  auto without_project = MakeQueryJob("SELECT a FROM t");
+  without_project.mutable_job_reference()->clear_project_id();
+  auto const billed = QueryCache::Key(without_project, "my-project");
+  auto const billed_elsewhere = QueryCache::Key(without_project, "other");
+  // The billing project only applies to jobs without a project.
+  auto const ignored =
+      QueryCache::Key(MakeQueryJob("SELECT a FROM t"), "other");
+  ASSERT_TRUE(in_project.has_value());
+  ASSERT_TRUE(billed.has_value());
+  ASSERT_TRUE(billed_elsewhere.has_value());
+  ASSERT_TRUE(ignored.has_value());
+  EXPECT_EQ(*in_project, *billed);
+  EXPECT_NE(*in_project, *billed_elsewhere);
+  EXPECT_EQ(*in_project, *ignored);
+}
+
+TEST(QueryCache, KeyRejectsUncacheableJobs) {
+  EXPECT_FALSE(IsCacheable("SELECT CURRENT_TIMESTAMP()"));
+  EXPECT_FALSE(IsCacheable("select rand() from t"));
+  EXPECT_FALSE(IsCacheable("SELECT @@current_job_id"));
+  EXPECT_FALSE(IsCacheable("DELETE FROM t WHERE true"));
+  EXPECT_FALSE(IsCacheable("SELECT 1; DROP TABLE t"));
+
+  auto no_cache = MakeQueryJob("SELECT a FROM t");
+  no_cache.mutable_configuration()
+      ->mutable_query()
+      ->mutable_use_query_cache()
+      ->set_value(false);
+  EXPECT_FALSE(QueryCache::Key(no_cache).has_value());
+
+  auto destination = MakeQueryJob("SELECT a FROM t");
+  destination.mutable_configuration()
+      ->mutable_query()
+      ->mutable_destination_table()
+      ->set_table_id("out");
+  EXPECT_FALSE(QueryCache::Key(destination).has_value());
+
+  Job load;
+  load.mutable_configuration()->mutable_load();
+  EXPECT_FALSE(QueryCache::Key(load).has_value());
+
+  auto with_job_id = MakeQueryJob("SELECT a FROM t");
+  with_job_id.mutable_job_reference()->set_job_id("my-job");
+  EXPECT_FALSE(QueryCache::Key(with_job_id).has_value());
+
+  // Function names in strings or table names do not matter.
+  EXPECT_TRUE(IsCacheable("SELECT 'rand()' FROM brand"));
+  EXPECT_TRUE(IsCacheable("(SELECT 1);"));
+  EXPECT_TRUE(IsCacheable("WITH x AS (SELECT 1) SELECT *"));
+}
+
+TEST(QueryCache, MayModifyTables) {
+  EXPECT_FALSE(QueryCache::MayModifyTables(MakeQueryJob("SELECT a FROM t")));
+  EXPECT_FALSE(
+      QueryCache::MayModifyTables(MakeQueryJob("SELECT CURRENT_DATE()")));
+  EXPECT_TRUE(QueryCache::MayModifyTables(MakeQueryJob("UPDATE t SET a = 1")));
+  EXPECT_TRUE(QueryCache::MayModifyTables(MakeQueryJob("SELECT 1; DELETE")));
+
+  Job copy;
+  copy.mutable_configuration()->mutable_copy();
+  EXPECT_TRUE(QueryCache::MayModifyTables(copy));
+  Job extract;
+  extract.mutable_configuration()->mutable_extract();
+  EXPECT_FALSE(QueryCache::MayModifyTables(extract));
+}
+
+TEST(QueryCache, HasResults) {
+  EXPECT_TRUE(QueryCache::HasResults(MakeDoneJob("a")));
+  auto running = MakeDoneJob("a");
+  running.mutable_status()->set_state("RUNNING");
+  EXPECT_FALSE(QueryCache::HasResults(running));
+  auto failed = MakeDoneJob("a");
+  failed.mutable_status()->mutable_error_result()->set_reason("invalid");
+  EXPECT_FALSE(QueryCache::HasResults(failed));
+}
+
+TEST(QueryCache, LookupAndExpire) {
+  auto now = std::chrono::system_clock::now();
+  QueryCache cache([&now] { return now; });
+
+  EXPECT_FALSE(cache.Lookup("k1").has_value());
+  cache.Insert("k1", MakeDoneJob("a"), std::chrono::minutes(5), 10,
+               cache.generation());
+  cache.Insert("k2", MakeDoneJob("b"), std::chrono::minutes(10), 10,
+               cache.generation());
+  EXPECT_EQ(cache.size(), 2U);
+
+  auto job = cache.Lookup("k1");
+  ASSERT_TRUE(job.has_value());
+  EXPECT_EQ(job->job_reference().job_id(), "a");
+
+  now += std::chrono::minutes(6);
+  EXPECT_FALSE(cache.Lookup("k1").has_value());
+  EXPECT_EQ(cache.size(), 1U);
+  EXPECT_TRUE(cache.Lookup("k2").has_value());
+
+  cache.Clear();
+  EXPECT_EQ(cache.size(), 0U);
+}
+
+TEST(QueryCache, InsertAfterClearIsIgnored) {
+  QueryCache cache;
+  auto const generation = cache.generation();
+  cache.Clear();
+  cache.Insert("k1", MakeDoneJob("a"), std::chrono::minutes(5), 10,
+               generation);
+  EXPECT_EQ(cache.size(), 0U);
+  EXPECT_FALSE(cache.Lookup("k1").has_value());
+
+  cache.Insert("k1", MakeDoneJob("a"), std::chrono::minutes(5), 10,
+               cache.generation());
+  EXPECT_EQ(cache.size(), 1U);
+}
+
+TEST(QueryCache, EvictsClosestToExpiration) {
+  auto now = std::chrono::system_clock::now();
+  QueryCache cache([&now] { return now; });
+
+  cache.Insert("k1", MakeDoneJob("a"), std::chrono::minutes(10), 2,
+               cache.generation());
+  cache.Insert("k2", MakeDoneJob("b"), std::chrono::minutes(5), 2,
+               cache.generation());
+  cache.Insert("k3", MakeDoneJob("c"), std::chrono::minutes(10), 2,
+               cache.generation());
+  EXPECT_EQ(cache.size(), 2U);
+  EXPECT_TRUE(cache.Lookup("k1").has_value());
+  EXPECT_FALSE(cache.Lookup("k2").has_value());
+  EXPECT_TRUE(cache.Lookup("k3").has_value());
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,150 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_channel_pool.h"
+#include <tuple>
+#include <utility>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+namespace {
+
+using ::google::cloud::bigquery::storage::v1::ReadRowsResponse;
+
+// Keeps the load of its channel up to date while the stream is open.
+class PooledReadRowsStream
+    : public google::cloud::internal::StreamingReadRpc<ReadRowsResponse> {
+ public:
+  PooledReadRowsStream(
+      std::shared_ptr<ReadChannel> channel,
+      std::unique_ptr<google::cloud::internal::StreamingReadRpc<
+          ReadRowsResponse>>
+          child)
+      : channel_(std::move(channel)), child_(std::move(child)) {
+    ++channel_->open_streams;
+    ++channel_->total_streams;
+  }
+  ~PooledReadRowsStream() override { Close(); }
+
+  void Cancel() override { child_->Cancel(); }
+
+  absl::variant<Status, ReadRowsResponse> Read() override {
+    auto result = child_->Read();
+    auto const* response = absl::get_if<ReadRowsResponse>(&result);
+    if (response == nullptr) {
+      Close();
+      return result;
+    }
+    auto const bytes =
+        response->arrow_record_batch().serialized_record_batch().size();
+    bytes_ += bytes;
+    channel_->bytes_received += bytes;
+    channel_->open_bytes += bytes;
+    return result;
+  }
+
+  RpcMetadata GetRequestMetadata() const override {
+    return child_->GetRequestMetadata();
+  }
+
+ private:
+  void Close() {
+    if (closed_) return;
+    closed_ = true;
+    --channel_->open_streams;
+    channel_->open_bytes -= bytes_;
+  }
+
+  std::shared_ptr<ReadChannel> channel_;
+  std::unique_ptr<google::cloud::internal::StreamingReadRpc<ReadRowsResponse>>
+      child_;
+  std::uint64_t bytes_ = 0;
+  bool closed_ = false;
+};
+
+}  // namespace
+
+ReadChannelPool::ReadChannelPool(
+    std::vector<std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub>>
+        children) {
+  channels_.reserve(children.size());
+  for (auto& child : children) {
+    channels_.push_back(std::make_shared<ReadChannel>(std::move(child)));
+  }
+}
+
+StatusOr<google::cloud::bigquery::storage::v1::ReadSession>
+ReadChannelPool::CreateReadSession(
+    grpc::ClientContext& context, Options const& options,
+    google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+        request) {
+  return Next()->stub->CreateReadSession(context, options, request);
+}
+
+std::unique_ptr<google::cloud::internal::StreamingReadRpc<ReadRowsResponse>>
+ReadChannelPool::ReadRows(
+    std::shared_ptr<grpc::ClientContext> context, Options const& options,
+    google::cloud::bigquery::storage::v1::ReadRowsRequest const& request) {
+  auto const& channel = LeastLoaded();
+  auto stream = channel->stub->ReadRows(std::move(context), options, request);
+  return std::make_unique<PooledReadRowsStream>(channel, std::move(stream));
+}
+
+StatusOr<google::cloud::bigquery::storage::v1::SplitReadStreamResponse>
+ReadChannelPool::SplitReadStream(
+    grpc::ClientContext& context, Options const& options,
+    google::cloud::bigquery::storage::v1::SplitReadStreamRequest const&
+        request) {
+  return Next()->stub->SplitReadStream(context, options, request);
+}
+
+std::vector<bigquery_unified::ReadChannelStats> ReadChannelPool::Stats()
+    const {
+  std::vector<bigquery_unified::ReadChannelStats> stats;
+  stats.reserve(channels_.size());
+  for (auto const& c : channels_) {
+    bigquery_unified::ReadChannelStats s;
+    s.open_streams = c->open_streams.load();
+    s.total_streams = c->total_streams.load();
+    s.bytes_received = c->bytes_received.load();
+    stats.push_back(s);
+  }
+  return stats;
+}
+
+std::shared_ptr<ReadChannel> const& ReadChannelPool::LeastLoaded() const {
+  // Concurrent calls may pick the same channel, the imbalance is corrected by
+  // the following calls.
+  auto load = [](ReadChannel const& c) {
+    return std::make_tuple(c.open_streams.load(), c.open_bytes.load());
+  };
+  auto const* best = &channels_.front();
+  auto best_load = load(**best);
+  for (auto const& c : channels_) {
+    auto l = load(*c);
+    if (l < best_load) {
+      best = &c;
+      best_load = l;
+    }
+  }
+  return *best;
+}
+
+std::shared_ptr<ReadChannel> const& ReadChannelPool::Next() {
+  return channels_[next_++ % channels_.size()];
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
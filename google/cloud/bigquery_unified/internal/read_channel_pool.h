@@ -0,0 +1,100 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_CHANNEL_POOL_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_CHANNEL_POOL_H
+
+#include "google/cloud/bigquery/storage/v1/internal/bigquery_read_stub.h"
+#include "google/cloud/bigquery_unified/read_channel_stats.h"
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/internal/streaming_read_rpc.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/// The state of one channel in a `ReadChannelPool`.
+struct ReadChannel {
+  explicit ReadChannel(
+      std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub> s)
+      : stub(std::move(s)) {}
+
+  std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub> const stub;
+  std::atomic<std::size_t> open_streams{0};
+  std::atomic<std::uint64_t> total_streams{0};
+  std::atomic<std::uint64_t> bytes_received{0};
+  // The bytes received by the streams still open on this channel.
+  std::atomic<std::uint64_t> open_bytes{0};
+};
+
+/**
+ * Spreads the Storage Read API calls over a pool of independent channels.
+ *
+ * A high-bandwidth read with hundreds of `ReadRows` streams is limited by the
+ * throughput of the few HTTP/2 connections that carry them. This stub owns one
+ * child stub per channel, each with its own connection, and starts every
+ * `ReadRows` stream on the least loaded channel: the channel with the fewest
+ * open streams, and among those, the one whose open streams have received the
+ * fewest bytes. The bytes a new stream will receive are not known when it
+ * starts, so the number of open streams is the primary measure of load.
+ *
+ * The short unary calls use the channels in round-robin order.
+ */
+class ReadChannelPool : public bigquery_storage_v1_internal::BigQueryReadStub {
+ public:
+  /// @p children must not be empty.
+  explicit ReadChannelPool(
+      std::vector<
+          std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub>>
+          children);
+  ~ReadChannelPool() override = default;
+
+  StatusOr<google::cloud::bigquery::storage::v1::ReadSession> CreateReadSession(
+      grpc::ClientContext& context, Options const& options,
+      google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+          request) override;
+
+  std::unique_ptr<google::cloud::internal::StreamingReadRpc<
+      google::cloud::bigquery::storage::v1::ReadRowsResponse>>
+  ReadRows(std::shared_ptr<grpc::ClientContext> context,
+           Options const& options,
+           google::cloud::bigquery::storage::v1::ReadRowsRequest const& request)
+      override;
+
+  StatusOr<google::cloud::bigquery::storage::v1::SplitReadStreamResponse>
+  SplitReadStream(
+      grpc::ClientContext& context, Options const& options,
+      google::cloud::bigquery::storage::v1::SplitReadStreamRequest const&
+          request) override;
+
+  /// The load of each channel, in pool order.
+  std::vector<bigquery_unified::ReadChannelStats> Stats() const;
+
+ private:
+  std::shared_ptr<ReadChannel> const& LeastLoaded() const;
+  std::shared_ptr<ReadChannel> const& Next();
+
+  std::vector<std::shared_ptr<ReadChannel>> channels_;
+  std::atomic<std::size_t> next_{0};
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_CHANNEL_POOL_H
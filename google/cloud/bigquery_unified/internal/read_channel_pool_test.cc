@@ -0,0 +1,190 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_channel_pool.h"
+#include <gmock/gmock.h>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery::storage::v1::ReadRowsRequest;
+using ::google::cloud::bigquery::storage::v1::ReadRowsResponse;
+using ::google::cloud::bigquery_unified::ReadChannelPoolStats;
+using ::google::cloud::bigquery_unified::ReadChannelStats;
+using ::testing::ElementsAre;
+using ::testing::Field;
+using ::testing::Return;
+
+class MockBigQueryReadStub
+    : public bigquery_storage_v1_internal::BigQueryReadStub {
+ public:
+  MOCK_METHOD(
+      StatusOr<google::cloud::bigquery::storage::v1::ReadSession>,
+      CreateReadSession,
+      (grpc::ClientContext&, Options const&,
+       google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&),
+      (override));
+  MOCK_METHOD(std::unique_ptr<
+                  google::cloud::internal::StreamingReadRpc<ReadRowsResponse>>,
+              ReadRows,
+              (std::shared_ptr<grpc::ClientContext>, Options const&,
+               ReadRowsRequest const&),
+              (override));
+  MOCK_METHOD(
+      StatusOr<google::cloud::bigquery::storage::v1::SplitReadStreamResponse>,
+      SplitReadStream,
+      (grpc::ClientContext&, Options const&,
+       google::cloud::bigquery::storage::v1::SplitReadStreamRequest const&),
+      (override));
+};
+
+// Returns one response for each element of `sizes`, with that many bytes of
+// data, then ends.
+class FakeStream
+    : public google::cloud::internal::StreamingReadRpc<ReadRowsResponse> {
+ public:
+  explicit FakeStream(std::deque<std::size_t> sizes)
+      : sizes_(std::move(sizes)) {}
+
+  void Cancel() override {}
+  absl::variant<Status, ReadRowsResponse> Read() override {
+    if (sizes_.empty()) return Status{};
+    ReadRowsResponse response;
+    response.mutable_arrow_record_batch()->set_serialized_record_batch(
+        std::string(sizes_.front(), 'x'));
+    sizes_.pop_front();
+    return response;
+  }
+  RpcMetadata GetRequestMetadata() const override { return {}; }
+
+ private:
+  std::deque<std::size_t> sizes_;
+};
+
+std::shared_ptr<MockBigQueryReadStub> MakeChild(std::size_t bytes) {
+  auto mock = std::make_shared<MockBigQueryReadStub>();
+  EXPECT_CALL(*mock, ReadRows).WillRepeatedly([bytes] {
+    return std::make_unique<FakeStream>(std::deque<std::size_t>{bytes, bytes});
+  });
+  return mock;
+}
+
+std::unique_ptr<google::cloud::internal::StreamingReadRpc<ReadRowsResponse>>
+StartStream(ReadChannelPool& pool) {
+  return pool.ReadRows(std::make_shared<grpc::ClientContext>(), Options{},
+                       ReadRowsRequest{});
+}
+
+TEST(ReadChannelPoolTest, AssignsStreamsToLeastLoadedChannel) {
+  ReadChannelPool pool({MakeChild(10), MakeChild(10), MakeChild(10)});
+
+  auto s1 = StartStream(pool);
+  auto s2 = StartStream(pool);
+  auto s3 = StartStream(pool);
+  EXPECT_THAT(pool.Stats(),
+              ElementsAre(Field(&ReadChannelStats::open_streams, 1U),
+                          Field(&ReadChannelStats::open_streams, 1U),
+                          Field(&ReadChannelStats::open_streams, 1U)));
+
+  // With the same number of open streams, the channel whose streams received
+  // the fewest bytes is preferred.
+  (void)s1->Read();
+  (void)s2->Read();
+  auto s4 = StartStream(pool);
+  EXPECT_THAT(pool.Stats(),
+              ElementsAre(Field(&ReadChannelStats::open_streams, 1U),
+                          Field(&ReadChannelStats::open_streams, 1U),
+                          Field(&ReadChannelStats::open_streams, 2U)));
+
+  // A finished stream no longer counts.
+  while (absl::holds_alternative<ReadRowsResponse>(s1->Read())) continue;
+  auto s5 = StartStream(pool);
+  auto stats = pool.Stats();
+  EXPECT_THAT(stats, ElementsAre(Field(&ReadChannelStats::open_streams, 1U),
+                                 Field(&ReadChannelStats::open_streams, 1U),
+                                 Field(&ReadChannelStats::open_streams, 2U)));
+  EXPECT_EQ(stats[0].total_streams, 2U);
+  EXPECT_EQ(stats[0].bytes_received, 20U);
+}
+
+TEST(ReadChannelPoolTest, DestroyedStreamIsClosed) {
+  ReadChannelPool pool({MakeChild(10), MakeChild(10)});
+  {
+    auto s = StartStream(pool);
+    (void)s->Read();
+  }
+  EXPECT_THAT(pool.Stats(),
+              ElementsAre(Field(&ReadChannelStats::open_streams, 0U),
+                          Field(&ReadChannelStats::open_streams, 0U)));
+  // The bytes of closed streams do not count, so the first channel is used.
+  auto s = StartStream(pool);
+  EXPECT_THAT(pool.Stats(),
+              ElementsAre(Field(&ReadChannelStats::total_streams, 2U),
+                          Field(&ReadChannelStats::total_streams, 0U)));
+}
+
+TEST(ReadChannelPoolTest, ReportsToPoolStats) {
+  ReadChannelPoolStats stats;
+  auto a = std::make_shared<ReadChannelPool>(
+      std::vector<
+          std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub>>{
+          MakeChild(10), MakeChild(10)});
+  AttachReadChannelPool(stats, a);
+  auto b = std::make_shared<ReadChannelPool>(
+      std::vector<
+          std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub>>{
+          MakeChild(10)});
+  AttachReadChannelPool(stats, b);
+
+  auto s = StartStream(*b);
+  (void)s->Read();
+  EXPECT_THAT(stats.Channels(),
+              ElementsAre(Field(&ReadChannelStats::open_streams, 0U),
+                          Field(&ReadChannelStats::open_streams, 0U),
+                          Field(&ReadChannelStats::bytes_received, 10U)));
+
+  // The channels of destroyed pools are no longer reported.
+  a.reset();
+  EXPECT_THAT(stats.Channels(),
+              ElementsAre(Field(&ReadChannelStats::open_streams, 1U)));
+}
+
+TEST(ReadChannelPoolTest, UnaryCallsUseChannelsInTurn) {
+  std::vector<std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub>>
+      children;
+  for (int i = 0; i != 2; ++i) {
+    auto mock = std::make_shared<MockBigQueryReadStub>();
+    EXPECT_CALL(*mock, SplitReadStream)
+        .Times(2)
+        .WillRepeatedly(Return(
+            google::cloud::bigquery::storage::v1::SplitReadStreamResponse{}));
+    children.push_back(std::move(mock));
+  }
+  ReadChannelPool pool(std::move(children));
+  for (int i = 0; i != 4; ++i) {
+    grpc::ClientContext context;
+    (void)pool.SplitReadStream(
+        context, Options{},
+        google::cloud::bigquery::storage::v1::SplitReadStreamRequest{});
+  }
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
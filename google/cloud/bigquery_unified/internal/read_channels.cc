@@ -0,0 +1,80 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_channels.h"
+#include "google/cloud/grpc_error_delegate.h"
+#include "google/cloud/internal/make_status.h"
+#include <google/cloud/bigquery/storage/v1/storage.grpc.pb.h>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+ReadChannels::Channels const& ReadChannels::Get() {
+  std::call_once(once_, [this] {
+    channels_ = factory_();
+    factory_ = nullptr;
+  });
+  return channels_;
+}
+
+Status ReadChannels::Connect(std::chrono::system_clock::time_point deadline) {
+  auto const& channels = Get().channels;
+  // Start connecting all the channels before waiting for any of them.
+  for (auto const& channel : channels) (void)channel->GetState(true);
+  for (auto const& channel : channels) {
+    for (auto state = channel->GetState(true); state != GRPC_CHANNEL_READY;
+         state = channel->GetState(true)) {
+      if (state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
+          state == GRPC_CHANNEL_SHUTDOWN) {
+        return internal::UnavailableError(
+            "cannot connect to the Storage Read API", GCP_ERROR_INFO());
+      }
+      if (!channel->WaitForStateChange(state, deadline)) {
+        return internal::DeadlineExceededError(
+            "timeout connecting to the Storage Read API", GCP_ERROR_INFO());
+      }
+    }
+  }
+  return Authenticate(deadline);
+}
+
+Status ReadChannels::Authenticate(
+    std::chrono::system_clock::time_point deadline) {
+  auto const& channels = Get();
+  if (!channels.auth) return Status{};
+  if (channels.auth->RequiresConfigureContext()) {
+    // The strategy caches the token for the contexts of the following calls.
+    grpc::ClientContext context;
+    return channels.auth->ConfigureContext(context);
+  }
+  for (auto const& channel : channels.channels) {
+    // A request without a stream name is rejected after the token is checked.
+    auto stub =
+        google::cloud::bigquery::storage::v1::BigQueryRead::NewStub(channel);
+    grpc::ClientContext context;
+    context.set_deadline(deadline);
+    google::cloud::bigquery::storage::v1::SplitReadStreamResponse response;
+    auto status = stub->SplitReadStream(
+        &context, google::cloud::bigquery::storage::v1::SplitReadStreamRequest{},
+        &response);
+    if (status.error_code() == grpc::StatusCode::UNAUTHENTICATED ||
+        status.error_code() == grpc::StatusCode::DEADLINE_EXCEEDED) {
+      return google::cloud::MakeStatusFromRpcError(status);
+    }
+  }
+  return Status{};
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
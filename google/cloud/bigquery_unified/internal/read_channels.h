@@ -0,0 +1,75 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_CHANNELS_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_CHANNELS_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/internal/unified_grpc_credentials.h"
+#include "google/cloud/status.h"
+#include <grpcpp/channel.h>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * The gRPC channels of the Storage Read API, created on first use.
+ *
+ * The read connection creates its stubs on these channels. Warming up the
+ * connection only needs the channels, so it connects them and fetches the
+ * access token without creating the connection.
+ */
+class ReadChannels {
+ public:
+  struct Channels {
+    std::shared_ptr<google::cloud::internal::GrpcAuthenticationStrategy> auth;
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+  };
+  using Factory = std::function<Channels()>;
+
+  explicit ReadChannels(Factory factory) : factory_(std::move(factory)) {}
+
+  /// Returns the channels, creating them on the first call.
+  Channels const& Get();
+
+  /**
+   * Connects all the channels, waiting until they are ready, then fetches the
+   * access token so the first read does not wait for it.
+   *
+   * The credentials managed by the library fetch the token directly. Those
+   * managed by gRPC fetch it on the first call, so each channel makes a call
+   * that the service rejects before doing any work.
+   *
+   * Returns an error if a channel fails to connect, or is not connected by
+   * @p deadline, or if the token cannot be fetched.
+   */
+  Status Connect(std::chrono::system_clock::time_point deadline);
+
+ private:
+  Status Authenticate(std::chrono::system_clock::time_point deadline);
+
+  std::once_flag once_;
+  Factory factory_;
+  Channels channels_;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_CHANNELS_H
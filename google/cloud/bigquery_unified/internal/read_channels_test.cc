@@ -0,0 +1,134 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_channels.h"
+#include "google/cloud/bigquery_unified/testing_util/status_matchers.h"
+#include "google/cloud/internal/make_status.h"
+#include <gmock/gmock.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <chrono>
+#include <memory>
+#include <string>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery_unified::testing_util::IsOk;
+using ::google::cloud::bigquery_unified::testing_util::StatusIs;
+using ::testing::Not;
+using ::testing::SizeIs;
+
+// Fetches the access token on the first call, and reuses it on the following
+// calls, like the credentials managed by the library.
+class FakeAuthenticationStrategy
+    : public google::cloud::internal::GrpcAuthenticationStrategy {
+ public:
+  explicit FakeAuthenticationStrategy(Status status = {})
+      : status_(std::move(status)) {}
+
+  std::shared_ptr<grpc::Channel> CreateChannel(
+      std::string const& endpoint, grpc::ChannelArguments const&) override {
+    return grpc::CreateChannel(endpoint, grpc::InsecureChannelCredentials());
+  }
+  bool RequiresConfigureContext() const override { return true; }
+  Status ConfigureContext(grpc::ClientContext&) override {
+    if (!fetched_) {
+      ++token_fetches;
+      fetched_ = status_.ok();
+    }
+    return status_;
+  }
+  future<StatusOr<std::shared_ptr<grpc::ClientContext>>> AsyncConfigureContext(
+      std::shared_ptr<grpc::ClientContext> context) override {
+    auto status = ConfigureContext(*context);
+    if (!status.ok()) {
+      return make_ready_future(
+          StatusOr<std::shared_ptr<grpc::ClientContext>>(std::move(status)));
+    }
+    return make_ready_future(make_status_or(std::move(context)));
+  }
+
+  int token_fetches = 0;
+
+ private:
+  Status status_;
+  bool fetched_ = false;
+};
+
+TEST(ReadChannels, CreatesChannelsOnce) {
+  auto calls = 0;
+  ReadChannels channels([&calls] {
+    ++calls;
+    ReadChannels::Channels result;
+    result.channels.push_back(grpc::CreateChannel(
+        "localhost:1", grpc::InsecureChannelCredentials()));
+    return result;
+  });
+  EXPECT_EQ(calls, 0);
+  EXPECT_THAT(channels.Get().channels, SizeIs(1));
+  EXPECT_THAT(channels.Get().channels, SizeIs(1));
+  EXPECT_EQ(calls, 1);
+}
+
+TEST(ReadChannels, ConnectWithoutChannels) {
+  ReadChannels channels([] { return ReadChannels::Channels{}; });
+  EXPECT_THAT(channels.Connect(std::chrono::system_clock::now()), IsOk());
+}
+
+TEST(ReadChannels, ConnectFetchesAccessToken) {
+  auto auth = std::make_shared<FakeAuthenticationStrategy>();
+  ReadChannels channels([auth] {
+    ReadChannels::Channels result;
+    result.auth = auth;
+    return result;
+  });
+  EXPECT_THAT(channels.Connect(std::chrono::system_clock::now()), IsOk());
+  EXPECT_EQ(auth->token_fetches, 1);
+
+  // The first read configures its context with the cached token.
+  grpc::ClientContext context;
+  EXPECT_THAT(channels.Get().auth->ConfigureContext(context), IsOk());
+  EXPECT_EQ(auth->token_fetches, 1);
+}
+
+TEST(ReadChannels, ConnectAccessTokenError) {
+  auto auth = std::make_shared<FakeAuthenticationStrategy>(
+      internal::UnauthenticatedError("bad credentials"));
+  ReadChannels channels([auth] {
+    ReadChannels::Channels result;
+    result.auth = auth;
+    return result;
+  });
+  EXPECT_THAT(channels.Connect(std::chrono::system_clock::now()),
+              StatusIs(StatusCode::kUnauthenticated));
+}
+
+TEST(ReadChannels, ConnectError) {
+  // Nothing listens on this port, the channel fails to connect.
+  ReadChannels channels([] {
+    ReadChannels::Channels result;
+    result.channels.push_back(grpc::CreateChannel(
+        "localhost:1", grpc::InsecureChannelCredentials()));
+    return result;
+  });
+  EXPECT_THAT(channels.Connect(std::chrono::system_clock::now() +
+                               std::chrono::seconds(10)),
+              Not(IsOk()));
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,177 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_metrics.h"
+#include "google/cloud/bigquery_unified/read_options.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+#include "absl/strings/str_split.h"
+#include <opentelemetry/context/context.h>
+#include <opentelemetry/metrics/provider.h>
+#include <map>
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+namespace metrics_api = ::opentelemetry::metrics;
+
+class ReadMetricsInstruments {
+ public:
+  ReadMetricsInstruments() {
+    auto meter = metrics_api::Provider::GetMeterProvider()->GetMeter(
+        "gl-cpp-bigquery-unified", bigquery_unified::version_string());
+    bytes = meter->CreateUInt64Counter(
+        "bigquery_unified.read.bytes",
+        "The bytes of the record batches received by ReadRows streams.", "By");
+    batches = meter->CreateUInt64Counter(
+        "bigquery_unified.read.batches",
+        "The record batches received by ReadRows streams.", "{batch}");
+    rows = meter->CreateUInt64Counter("bigquery_unified.read.rows",
+                                      "The rows received by ReadRows streams.",
+                                      "{row}");
+    wait_duration = meter->CreateDoubleHistogram(
+        "bigquery_unified.read.wait_duration",
+        "The time readers were blocked waiting for a ReadRows response.", "s");
+    decode_duration = meter->CreateDoubleHistogram(
+        "bigquery_unified.read.decode_duration",
+        "The time spent decoding the record batch of a ReadRows response.",
+        "s");
+  }
+
+  opentelemetry::nostd::unique_ptr<metrics_api::Counter<std::uint64_t>> bytes;
+  opentelemetry::nostd::unique_ptr<metrics_api::Counter<std::uint64_t>>
+      batches;
+  opentelemetry::nostd::unique_ptr<metrics_api::Counter<std::uint64_t>> rows;
+  opentelemetry::nostd::unique_ptr<metrics_api::Histogram<double>>
+      wait_duration;
+  opentelemetry::nostd::unique_ptr<metrics_api::Histogram<double>>
+      decode_duration;
+};
+
+namespace {
+
+// Returns the project, dataset and table attributes of @p table_name.
+std::map<std::string, std::string> TableAttributes(
+    std::string const& table_name) {
+  std::vector<std::string> const parts = absl::StrSplit(table_name, '/');
+  if (parts.size() != 6 || parts[0] != "projects" || parts[2] != "datasets" ||
+      parts[4] != "tables") {
+    return {{"bigquery.table", table_name}};
+  }
+  return {{"bigquery.project", parts[1]},
+          {"bigquery.dataset", parts[3]},
+          {"bigquery.table", parts[5]}};
+}
+
+class OpenTelemetryReadMetrics : public ReadMetrics {
+ public:
+  OpenTelemetryReadMetrics(std::shared_ptr<ReadMetricsInstruments> instruments,
+                           std::string const& table_name)
+      : instruments_(std::move(instruments)),
+        attributes_(TableAttributes(table_name)) {}
+
+  void RecordBatch(std::string const& /*stream_name*/,
+                   ReadBatchMetrics const& batch) override {
+    auto const context = opentelemetry::context::Context{};
+    instruments_->bytes->Add(static_cast<std::uint64_t>(batch.bytes),
+                             attributes_);
+    instruments_->batches->Add(1, attributes_);
+    instruments_->rows->Add(static_cast<std::uint64_t>(batch.rows),
+                            attributes_);
+    instruments_->wait_duration->Record(
+        std::chrono::duration<double>(batch.wait_time).count(), attributes_,
+        context);
+    instruments_->decode_duration->Record(
+        std::chrono::duration<double>(batch.decode_time).count(), attributes_,
+        context);
+  }
+
+ private:
+  std::shared_ptr<ReadMetricsInstruments> instruments_;
+  std::map<std::string, std::string> const attributes_;
+};
+
+}  // namespace
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+
+namespace {
+
+class CombinedReadMetrics : public ReadMetrics {
+ public:
+  explicit CombinedReadMetrics(
+      std::vector<std::shared_ptr<ReadMetrics>> children)
+      : children_(std::move(children)) {}
+
+  void RecordStreamStart(std::string const& stream_name) override {
+    for (auto const& c : children_) c->RecordStreamStart(stream_name);
+  }
+
+  void RecordBatch(std::string const& stream_name,
+                   ReadBatchMetrics const& batch) override {
+    for (auto const& c : children_) c->RecordBatch(stream_name, batch);
+  }
+
+ private:
+  std::vector<std::shared_ptr<ReadMetrics>> children_;
+};
+
+}  // namespace
+
+std::string ReadSessionName(std::string const& stream_name) {
+  // Stream names have the form `<session name>/streams/<stream id>`.
+  auto const pos = stream_name.rfind("/streams/");
+  if (pos == std::string::npos) return stream_name;
+  return stream_name.substr(0, pos);
+}
+
+std::shared_ptr<ReadMetricsInstruments> MakeReadMetricsInstruments(
+    Options const& options) {
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+  if (!options.get<bigquery_unified::EnableReadMetricsOption>()) return nullptr;
+  return std::make_shared<ReadMetricsInstruments>();
+#else
+  (void)options;
+  return nullptr;
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+}
+
+std::shared_ptr<ReadMetrics> MakeReadMetrics(
+    std::shared_ptr<ReadMetricsInstruments> instruments,
+    std::string const& table_name) {
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+  if (!instruments) return nullptr;
+  return std::make_shared<OpenTelemetryReadMetrics>(std::move(instruments),
+                                                    table_name);
+#else
+  (void)instruments;
+  (void)table_name;
+  return nullptr;
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+}
+
+std::shared_ptr<ReadMetrics> CombineReadMetrics(
+    std::vector<std::shared_ptr<ReadMetrics>> children) {
+  children.erase(std::remove(children.begin(), children.end(), nullptr),
+                 children.end());
+  if (children.empty()) return nullptr;
+  if (children.size() == 1) return std::move(children.front());
+  return std::make_shared<CombinedReadMetrics>(std::move(children));
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
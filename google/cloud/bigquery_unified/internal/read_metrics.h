@@ -0,0 +1,109 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_METRICS_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_METRICS_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/options.h"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/// The measurements of one record batch read from a `ReadRows` stream.
+struct ReadBatchMetrics {
+  std::int64_t bytes = 0;
+  std::int64_t rows = 0;
+  /// The time the reader was blocked waiting for the `ReadRows` response.
+  std::chrono::nanoseconds wait_time{0};
+  /// The time spent decoding the Arrow IPC message of the response.
+  std::chrono::nanoseconds decode_time{0};
+  /// The fraction of the rows of the stream read at the end of the response.
+  double progress = 0;
+};
+
+/**
+ * Records the throughput and latency of the Storage Read API streams.
+ *
+ * The measurements of each batch identify its read stream, recorders decide
+ * how to attribute them.
+ */
+class ReadMetrics {
+ public:
+  virtual ~ReadMetrics() = default;
+
+  /// Called for each `ReadRows` call of a stream, including its resumes.
+  virtual void RecordStreamStart(std::string const& /*stream_name*/) {}
+
+  virtual void RecordBatch(std::string const& stream_name,
+                           ReadBatchMetrics const& batch) = 0;
+};
+
+/**
+ * The recorder of the `ReadRows` calls made with these options.
+ *
+ * The resumable `ReadRows` stream of the connection passes the options of the
+ * original call to each of its attempts, this option lets the stub attribute
+ * them to the read.
+ */
+struct ReadMetricsOption {
+  using Type = std::shared_ptr<ReadMetrics>;
+};
+
+/// Returns the name of the read session that contains `stream_name`.
+std::string ReadSessionName(std::string const& stream_name);
+
+/// The OpenTelemetry instruments of the read metrics of a connection.
+class ReadMetricsInstruments;
+
+/**
+ * Creates the instruments for the reads of a connection created with
+ * @p options, using the current global meter provider.
+ *
+ * Returns `nullptr` if `EnableReadMetricsOption` is not set, or if the library
+ * is built without OpenTelemetry.
+ */
+std::shared_ptr<ReadMetricsInstruments> MakeReadMetricsInstruments(
+    Options const& options);
+
+/**
+ * Returns the recorder for a read of @p table_name, with the form
+ * `projects/{project}/datasets/{dataset}/tables/{table}`.
+ *
+ * The metrics are attributed to the project, dataset and table, which keeps
+ * the number of time series bounded. The measurements of each read session and
+ * stream are in its `ReadSessionStats`. Returns `nullptr` if @p instruments is
+ * `nullptr`.
+ */
+std::shared_ptr<ReadMetrics> MakeReadMetrics(
+    std::shared_ptr<ReadMetricsInstruments> instruments,
+    std::string const& table_name);
+
+/**
+ * Forwards the measurements to each of @p children that is not `nullptr`.
+ *
+ * Returns `nullptr` if all of @p children are `nullptr`.
+ */
+std::shared_ptr<ReadMetrics> CombineReadMetrics(
+    std::vector<std::shared_ptr<ReadMetrics>> children);
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_METRICS_H
@@ -0,0 +1,53 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_metrics_stub.h"
+#include "google/cloud/bigquery_unified/internal/read_metrics.h"
+#include <utility>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+ReadMetricsStub::ReadMetricsStub(
+    std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub> child)
+    : child_(std::move(child)) {}
+
+StatusOr<google::cloud::bigquery::storage::v1::ReadSession>
+ReadMetricsStub::CreateReadSession(
+    grpc::ClientContext& context, Options const& options,
+    google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+        request) {
+  return child_->CreateReadSession(context, options, request);
+}
+
+std::unique_ptr<google::cloud::internal::StreamingReadRpc<
+    google::cloud::bigquery::storage::v1::ReadRowsResponse>>
+ReadMetricsStub::ReadRows(
+    std::shared_ptr<grpc::ClientContext> context, Options const& options,
+    google::cloud::bigquery::storage::v1::ReadRowsRequest const& request) {
+  auto const& metrics = options.get<ReadMetricsOption>();
+  if (metrics) metrics->RecordStreamStart(request.read_stream());
+  return child_->ReadRows(std::move(context), options, request);
+}
+
+StatusOr<google::cloud::bigquery::storage::v1::SplitReadStreamResponse>
+ReadMetricsStub::SplitReadStream(
+    grpc::ClientContext& context, Options const& options,
+    google::cloud::bigquery::storage::v1::SplitReadStreamRequest const&
+        request) {
+  return child_->SplitReadStream(context, options, request);
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
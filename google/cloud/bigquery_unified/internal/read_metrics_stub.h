@@ -0,0 +1,64 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_METRICS_STUB_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_METRICS_STUB_H
+
+#include "google/cloud/bigquery/storage/v1/internal/bigquery_read_stub.h"
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/internal/streaming_read_rpc.h"
+#include <memory>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Reports each `ReadRows` call to the `ReadMetricsOption` of its options.
+ *
+ * The resumable stream of the connection calls the stub again to resume a
+ * broken stream. Those calls are invisible to the reader, this stub lets it
+ * count them.
+ */
+class ReadMetricsStub : public bigquery_storage_v1_internal::BigQueryReadStub {
+ public:
+  explicit ReadMetricsStub(
+      std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub> child);
+  ~ReadMetricsStub() override = default;
+
+  StatusOr<google::cloud::bigquery::storage::v1::ReadSession> CreateReadSession(
+      grpc::ClientContext& context, Options const& options,
+      google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+          request) override;
+
+  std::unique_ptr<google::cloud::internal::StreamingReadRpc<
+      google::cloud::bigquery::storage::v1::ReadRowsResponse>>
+  ReadRows(std::shared_ptr<grpc::ClientContext> context,
+           Options const& options,
+           google::cloud::bigquery::storage::v1::ReadRowsRequest const& request)
+      override;
+
+  StatusOr<google::cloud::bigquery::storage::v1::SplitReadStreamResponse>
+  SplitReadStream(
+      grpc::ClientContext& context, Options const& options,
+      google::cloud::bigquery::storage::v1::SplitReadStreamRequest const&
+          request) override;
+
+ private:
+  std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub> child_;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_METRICS_STUB_H
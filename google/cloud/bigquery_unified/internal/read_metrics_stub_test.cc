@@ -0,0 +1,69 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_metrics_stub.h"
+#include "google/cloud/bigquery_unified/internal/read_metrics.h"
+#include <gmock/gmock.h>
+#include <memory>
+#include <string>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery::storage::v1::ReadRowsRequest;
+using ::google::cloud::bigquery::storage::v1::ReadRowsResponse;
+using ReadRowsStream =
+    google::cloud::internal::StreamingReadRpc<ReadRowsResponse>;
+
+class MockBigQueryReadStub
+    : public bigquery_storage_v1_internal::BigQueryReadStub {
+ public:
+  MOCK_METHOD(std::unique_ptr<ReadRowsStream>, ReadRows,
+              (std::shared_ptr<grpc::ClientContext>, Options const&,
+               ReadRowsRequest const&),
+              (override));
+};
+
+class MockReadMetrics : public ReadMetrics {
+ public:
+  MOCK_METHOD(void, RecordStreamStart, (std::string const&), (override));
+  MOCK_METHOD(void, RecordBatch,
+              (std::string const&, ReadBatchMetrics const&), (override));
+};
+
+TEST(ReadMetricsStubTest, ReportsEachCall) {
+  auto mock = std::make_shared<MockBigQueryReadStub>();
+  EXPECT_CALL(*mock, ReadRows).Times(3).WillRepeatedly([] {
+    return std::unique_ptr<ReadRowsStream>();
+  });
+  auto metrics = std::make_shared<MockReadMetrics>();
+  EXPECT_CALL(*metrics, RecordStreamStart("s/streams/a")).Times(2);
+  ReadMetricsStub stub(mock);
+
+  ReadRowsRequest request;
+  request.set_read_stream("s/streams/a");
+  auto const options = Options{}.set<ReadMetricsOption>(metrics);
+  (void)stub.ReadRows(std::make_shared<grpc::ClientContext>(), options,
+                      request);
+  (void)stub.ReadRows(std::make_shared<grpc::ClientContext>(), options,
+                      request);
+  // Calls without a recorder are not reported.
+  (void)stub.ReadRows(std::make_shared<grpc::ClientContext>(), Options{},
+                      request);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,158 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_metrics.h"
+#include "google/cloud/bigquery_unified/internal/arrow_reader.h"
+#include "google/cloud/bigquery_unified/read_options.h"
+#include <arrow/api.h>
+#include <arrow/ipc/api.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <string>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery::storage::v1::ReadRowsRequest;
+using ::google::cloud::bigquery::storage::v1::ReadRowsResponse;
+using ::testing::_;
+using ::testing::AllOf;
+using ::testing::Field;
+using ::testing::IsNull;
+using ::testing::NotNull;
+
+class MockReadMetrics : public ReadMetrics {
+ public:
+  MOCK_METHOD(void, RecordStreamStart, (std::string const&), (override));
+  MOCK_METHOD(void, RecordBatch,
+              (std::string const&, ReadBatchMetrics const&), (override));
+};
+
+std::shared_ptr<arrow::RecordBatch> MakeTestRecordBatch() {
+  arrow::Int64Builder builder;
+  EXPECT_TRUE(builder.AppendValues({1, 2, 3}).ok());
+  std::shared_ptr<arrow::Array> array;
+  EXPECT_TRUE(builder.Finish(&array).ok());
+  return arrow::RecordBatch::Make(
+      arrow::schema({arrow::field("x", arrow::int64())}), 3, {array});
+}
+
+TEST(ReadMetricsTest, ReadSessionName) {
+  EXPECT_EQ(ReadSessionName("projects/p/locations/l/sessions/s/streams/t"),
+            "projects/p/locations/l/sessions/s");
+  EXPECT_EQ(ReadSessionName("unexpected"), "unexpected");
+}
+
+TEST(ReadMetricsTest, DisabledByDefault) {
+  EXPECT_THAT(MakeReadMetricsInstruments(Options{}), IsNull());
+  EXPECT_THAT(
+      MakeReadMetricsInstruments(
+          Options{}.set<bigquery_unified::EnableReadMetricsOption>(false)),
+      IsNull());
+  EXPECT_THAT(MakeReadMetrics(nullptr, "projects/p/datasets/d/tables/t"),
+              IsNull());
+}
+
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+TEST(ReadMetricsTest, Enabled) {
+  auto options = Options{}.set<bigquery_unified::EnableReadMetricsOption>(true);
+  auto instruments = MakeReadMetricsInstruments(options);
+  ASSERT_THAT(instruments, NotNull());
+  // Each connection creates its own instruments.
+  EXPECT_NE(instruments, MakeReadMetricsInstruments(options));
+  auto metrics = MakeReadMetrics(instruments, "projects/p/datasets/d/tables/t");
+  ASSERT_THAT(metrics, NotNull());
+  metrics->RecordBatch("projects/p/locations/l/sessions/s/streams/t",
+                       ReadBatchMetrics{});
+}
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+
+TEST(ReadMetricsTest, CombineReadMetrics) {
+  EXPECT_THAT(CombineReadMetrics({nullptr, nullptr}), IsNull());
+
+  auto a = std::make_shared<MockReadMetrics>();
+  EXPECT_EQ(CombineReadMetrics({nullptr, a}), a);
+
+  auto b = std::make_shared<MockReadMetrics>();
+  EXPECT_CALL(*a, RecordStreamStart("s/streams/t"));
+  EXPECT_CALL(*b, RecordStreamStart("s/streams/t"));
+  EXPECT_CALL(*a, RecordBatch("s/streams/t", _));
+  EXPECT_CALL(*b, RecordBatch("s/streams/t", _));
+  auto combined = CombineReadMetrics({a, nullptr, b});
+  ASSERT_THAT(combined, NotNull());
+  combined->RecordStreamStart("s/streams/t");
+  combined->RecordBatch("s/streams/t", ReadBatchMetrics{});
+}
+
+TEST(ReadMetricsTest, ReaderRecordsEachBatch) {
+  auto batch = MakeTestRecordBatch();
+  auto serialized = arrow::ipc::SerializeRecordBatch(
+      *batch, arrow::ipc::IpcWriteOptions::Defaults());
+  ASSERT_TRUE(serialized.ok());
+  ReadRowsResponse response;
+  response.set_row_count(3);
+  response.mutable_arrow_record_batch()->set_serialized_record_batch(
+      (*serialized)->ToString());
+  auto const bytes = static_cast<std::int64_t>((*serialized)->size());
+
+  auto metrics = std::make_shared<MockReadMetrics>();
+  EXPECT_CALL(*metrics,
+              RecordBatch("streams/t",
+                          AllOf(Field(&ReadBatchMetrics::bytes, bytes),
+                                Field(&ReadBatchMetrics::rows, 3))))
+      .Times(2);
+
+  ArrowRecordBatchReader reader(
+      "streams/t", batch->schema(),
+      std::make_shared<arrow::ipc::DictionaryMemo>(),
+      [response](ReadRowsRequest const&) {
+        return std::make_shared<StreamRange<ReadRowsResponse>>(
+            internal::MakeStreamRange<ReadRowsResponse>(
+                [response, count = 0]() mutable
+                -> absl::variant<Status, ReadRowsResponse> {
+                  if (count++ == 2) return Status{};
+                  return response;
+                }));
+      },
+      metrics);
+  for (int i = 0; i != 2; ++i) {
+    auto result = reader(Options{});
+    EXPECT_TRUE(
+        absl::holds_alternative<std::shared_ptr<arrow::RecordBatch>>(result));
+  }
+  auto end = reader(Options{});
+  ASSERT_TRUE(absl::holds_alternative<Status>(end));
+  EXPECT_TRUE(absl::get<Status>(end).ok());
+}
+
+TEST(ReadMetricsTest, ReaderWithoutMetrics) {
+  ArrowRecordBatchReader reader(
+      "streams/t", MakeTestRecordBatch()->schema(),
+      std::make_shared<arrow::ipc::DictionaryMemo>(),
+      [](ReadRowsRequest const&) {
+        return std::make_shared<StreamRange<ReadRowsResponse>>(
+            internal::MakeStreamRange<ReadRowsResponse>(
+                []() -> absl::variant<Status, ReadRowsResponse> {
+                  return Status{};
+                }));
+      });
+  auto end = reader(Options{});
+  ASSERT_TRUE(absl::holds_alternative<Status>(end));
+  EXPECT_TRUE(absl::get<Status>(end).ok());
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
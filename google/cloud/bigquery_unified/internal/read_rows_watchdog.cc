@@ -0,0 +1,164 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_rows_watchdog.h"
+#include "google/cloud/internal/absl_str_cat_quiet.h"
+#include "google/cloud/internal/make_status.h"
+#include <mutex>
+#include <utility>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+namespace {
+
+using ::google::cloud::bigquery::storage::v1::ReadRowsResponse;
+using ReadRowsStream =
+    google::cloud::internal::StreamingReadRpc<ReadRowsResponse>;
+
+// The state shared by a stream and its timer. The timer holds a weak pointer,
+// so a stream that is closed while its timer is pending is not kept alive.
+class Watchdog : public std::enable_shared_from_this<Watchdog> {
+ public:
+  Watchdog(CompletionQueue cq, std::chrono::milliseconds idle_timeout,
+           ReadRowsStream* stream)
+      : cq_(std::move(cq)), idle_timeout_(idle_timeout), stream_(stream) {}
+
+  void StartRead() {
+    std::unique_lock<std::mutex> lk(mu_);
+    reading_ = true;
+    last_progress_ = std::chrono::steady_clock::now();
+    // A timer armed by a previous `Read()` checks this one too.
+    if (timer_armed_) return;
+    Arm(std::move(lk), idle_timeout_);
+  }
+
+  // Returns true if the call was cancelled because it stalled.
+  bool EndRead() {
+    std::lock_guard<std::mutex> lk(mu_);
+    reading_ = false;
+    last_progress_ = std::chrono::steady_clock::now();
+    return stalled_;
+  }
+
+  void Close() {
+    std::lock_guard<std::mutex> lk(mu_);
+    stream_ = nullptr;
+  }
+
+ private:
+  void Arm(std::unique_lock<std::mutex> lk,
+           std::chrono::steady_clock::duration delay) {
+    timer_armed_ = true;
+    auto cq = cq_;
+    lk.unlock();
+    cq.MakeRelativeTimer(delay).then(
+        [w = weak_from_this()](
+            future<StatusOr<std::chrono::system_clock::time_point>> f) {
+          auto self = w.lock();
+          if (self) self->OnTimer(f.get().ok());
+        });
+  }
+
+  void OnTimer(bool ok) {
+    std::unique_lock<std::mutex> lk(mu_);
+    timer_armed_ = false;
+    if (!ok || stream_ == nullptr || !reading_) return;
+    auto const idle = std::chrono::steady_clock::now() - last_progress_;
+    if (idle < idle_timeout_) return Arm(std::move(lk), idle_timeout_ - idle);
+    stalled_ = true;
+    stream_->Cancel();
+  }
+
+  CompletionQueue cq_;
+  std::chrono::milliseconds const idle_timeout_;
+  std::mutex mu_;
+  ReadRowsStream* stream_;                               // GUARDED_BY(mu_)
+  bool reading_ = false;                                 // GUARDED_BY(mu_)
+  bool timer_armed_ = false;                             // GUARDED_BY(mu_)
+  bool stalled_ = false;                                 // GUARDED_BY(mu_)
+  std::chrono::steady_clock::time_point last_progress_;  // GUARDED_BY(mu_)
+};
+
+class WatchedReadRowsStream : public ReadRowsStream {
+ public:
+  WatchedReadRowsStream(std::unique_ptr<ReadRowsStream> child,
+                        CompletionQueue cq,
+                        std::chrono::milliseconds idle_timeout)
+      : child_(std::move(child)),
+        idle_timeout_(idle_timeout),
+        watchdog_(std::make_shared<Watchdog>(std::move(cq), idle_timeout,
+                                             child_.get())) {}
+  ~WatchedReadRowsStream() override { watchdog_->Close(); }
+
+  void Cancel() override { child_->Cancel(); }
+
+  absl::variant<Status, ReadRowsResponse> Read() override {
+    watchdog_->StartRead();
+    auto result = child_->Read();
+    auto const stalled = watchdog_->EndRead();
+    if (stalled && absl::holds_alternative<Status>(result)) {
+      return internal::UnavailableError(
+          absl::StrCat("ReadRows stream received no response for ",
+                       idle_timeout_.count(), "ms, the call was cancelled"),
+          GCP_ERROR_INFO());
+    }
+    return result;
+  }
+
+  RpcMetadata GetRequestMetadata() const override {
+    return child_->GetRequestMetadata();
+  }
+
+ private:
+  std::unique_ptr<ReadRowsStream> child_;
+  std::chrono::milliseconds idle_timeout_;
+  std::shared_ptr<Watchdog> watchdog_;
+};
+
+}  // namespace
+
+ReadRowsWatchdogStub::ReadRowsWatchdogStub(
+    std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub> child,
+    CompletionQueue cq, std::chrono::milliseconds idle_timeout)
+    : child_(std::move(child)),
+      cq_(std::move(cq)),
+      idle_timeout_(idle_timeout) {}
+
+StatusOr<google::cloud::bigquery::storage::v1::ReadSession>
+ReadRowsWatchdogStub::CreateReadSession(
+    grpc::ClientContext& context, Options const& options,
+    google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+        request) {
+  return child_->CreateReadSession(context, options, request);
+}
+
+std::unique_ptr<ReadRowsStream> ReadRowsWatchdogStub::ReadRows(
+    std::shared_ptr<grpc::ClientContext> context, Options const& options,
+    google::cloud::bigquery::storage::v1::ReadRowsRequest const& request) {
+  return std::make_unique<WatchedReadRowsStream>(
+      child_->ReadRows(std::move(context), options, request), cq_,
+      idle_timeout_);
+}
+
+StatusOr<google::cloud::bigquery::storage::v1::SplitReadStreamResponse>
+ReadRowsWatchdogStub::SplitReadStream(
+    grpc::ClientContext& context, Options const& options,
+    google::cloud::bigquery::storage::v1::SplitReadStreamRequest const&
+        request) {
+  return child_->SplitReadStream(context, options, request);
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,76 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_ROWS_WATCHDOG_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_ROWS_WATCHDOG_H
+
+#include "google/cloud/bigquery/storage/v1/internal/bigquery_read_stub.h"
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/completion_queue.h"
+#include "google/cloud/internal/streaming_read_rpc.h"
+#include <chrono>
+#include <memory>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Cancels the `ReadRows` streams that stop receiving responses.
+ *
+ * A stream can stall without an error, and without a deadline it blocks its
+ * reader indefinitely. This stub watches each stream with one completion queue
+ * timer: if a `Read()` waits for longer than @p idle_timeout, the call is
+ * cancelled and `Read()` returns `kUnavailable`.
+ *
+ * That error is retryable, so the resumable stream of the connection restarts
+ * the call at the offset of the last row it delivered, as it does for a broken
+ * connection. The reader sees no gap or duplicate rows. The time spent in the
+ * stalled call counts against the retry policy.
+ */
+class ReadRowsWatchdogStub
+    : public bigquery_storage_v1_internal::BigQueryReadStub {
+ public:
+  ReadRowsWatchdogStub(
+      std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub> child,
+      CompletionQueue cq, std::chrono::milliseconds idle_timeout);
+  ~ReadRowsWatchdogStub() override = default;
+
+  StatusOr<google::cloud::bigquery::storage::v1::ReadSession> CreateReadSession(
+      grpc::ClientContext& context, Options const& options,
+      google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+          request) override;
+
+  std::unique_ptr<google::cloud::internal::StreamingReadRpc<
+      google::cloud::bigquery::storage::v1::ReadRowsResponse>>
+  ReadRows(std::shared_ptr<grpc::ClientContext> context,
+           Options const& options,
+           google::cloud::bigquery::storage::v1::ReadRowsRequest const& request)
+      override;
+
+  StatusOr<google::cloud::bigquery::storage::v1::SplitReadStreamResponse>
+  SplitReadStream(
+      grpc::ClientContext& context, Options const& options,
+      google::cloud::bigquery::storage::v1::SplitReadStreamRequest const&
+          request) override;
+
+ private:
+  std::shared_ptr<bigquery_storage_v1_internal::BigQueryReadStub> child_;
+  CompletionQueue cq_;
+  std::chrono::milliseconds idle_timeout_;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_ROWS_WATCHDOG_H
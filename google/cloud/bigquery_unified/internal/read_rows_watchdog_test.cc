@@ -0,0 +1,128 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_rows_watchdog.h"
+#include "google/cloud/bigquery_unified/testing_util/status_matchers.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/internal/rest_background_threads_impl.h"
+#include <gmock/gmock.h>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery::storage::v1::ReadRowsRequest;
+using ::google::cloud::bigquery::storage::v1::ReadRowsResponse;
+using ::google::cloud::bigquery_unified::testing_util::StatusIs;
+using ReadRowsStream =
+    google::cloud::internal::StreamingReadRpc<ReadRowsResponse>;
+
+class MockBigQueryReadStub
+    : public bigquery_storage_v1_internal::BigQueryReadStub {
+ public:
+  MOCK_METHOD(std::unique_ptr<ReadRowsStream>, ReadRows,
+              (std::shared_ptr<grpc::ClientContext>, Options const&,
+               ReadRowsRequest const&),
+              (override));
+};
+
+// Returns `responses` responses, then ends if `stall` is false, or blocks until
+// it is cancelled.
+class FakeStream : public ReadRowsStream {
+ public:
+  FakeStream(int responses, bool stall, bool& cancelled)
+      : responses_(responses), stall_(stall), cancelled_(cancelled) {}
+
+  void Cancel() override {
+    std::lock_guard<std::mutex> lk(mu_);
+    cancelled_ = true;
+    cv_.notify_all();
+  }
+
+  absl::variant<Status, ReadRowsResponse> Read() override {
+    if (responses_ > 0) {
+      --responses_;
+      return ReadRowsResponse{};
+    }
+    if (!stall_) return Status{};
+    std::unique_lock<std::mutex> lk(mu_);
+    cv_.wait(lk, [this] { return cancelled_; });
+    return internal::CancelledError("cancelled", GCP_ERROR_INFO());
+  }
+
+  RpcMetadata GetRequestMetadata() const override { return {}; }
+
+ private:
+  int responses_;
+  bool stall_;
+  std::mutex mu_;
+  std::condition_variable cv_;
+  bool& cancelled_;
+};
+
+std::unique_ptr<ReadRowsStream> StartStream(ReadRowsWatchdogStub& stub) {
+  return stub.ReadRows(std::make_shared<grpc::ClientContext>(), Options{},
+                       ReadRowsRequest{});
+}
+
+TEST(ReadRowsWatchdogStubTest, StalledStreamIsCancelled) {
+  rest_internal::AutomaticallyCreatedRestBackgroundThreads background;
+  bool cancelled = false;
+  auto mock = std::make_shared<MockBigQueryReadStub>();
+  EXPECT_CALL(*mock, ReadRows).WillOnce([&cancelled] {
+    return std::make_unique<FakeStream>(1, true, cancelled);
+  });
+  ReadRowsWatchdogStub stub(mock, background.cq(),
+                            std::chrono::milliseconds(50));
+
+  auto stream = StartStream(stub);
+  EXPECT_TRUE(absl::holds_alternative<ReadRowsResponse>(stream->Read()));
+  auto result = stream->Read();
+  ASSERT_TRUE(absl::holds_alternative<Status>(result));
+  // The error is retryable, so the stream is resumed.
+  EXPECT_THAT(absl::get<Status>(result), StatusIs(StatusCode::kUnavailable));
+  EXPECT_TRUE(cancelled);
+}
+
+TEST(ReadRowsWatchdogStubTest, ActiveStreamIsNotCancelled) {
+  rest_internal::AutomaticallyCreatedRestBackgroundThreads background;
+  bool cancelled = false;
+  auto mock = std::make_shared<MockBigQueryReadStub>();
+  EXPECT_CALL(*mock, ReadRows).WillOnce([&cancelled] {
+    return std::make_unique<FakeStream>(3, false, cancelled);
+  });
+  ReadRowsWatchdogStub stub(mock, background.cq(),
+                            std::chrono::milliseconds(10));
+
+  auto stream = StartStream(stub);
+  for (int i = 0; i != 3; ++i) {
+    EXPECT_TRUE(absl::holds_alternative<ReadRowsResponse>(stream->Read()));
+  }
+  auto result = stream->Read();
+  ASSERT_TRUE(absl::holds_alternative<Status>(result));
+  EXPECT_THAT(absl::get<Status>(result), StatusIs(StatusCode::kOk));
+  // The timer may still be pending, it must not cancel the finished stream.
+  stream.reset();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(cancelled);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,118 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_session_cache.h"
+#include "google/cloud/internal/time_utils.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+StatusOr<google::cloud::bigquery::storage::v1::ReadSession>
+ReadSessionCache::GetOrCreate(
+    google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+        request,
+    std::chrono::milliseconds margin, std::size_t capacity,
+    Factory const& factory) {
+  auto const key = Key(request);
+  std::unique_lock<std::mutex> lk(mu_);
+  for (;;) {
+    EvictExpiring(clock_() + margin);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) break;
+    if (!it->second.pending) return it->second.session;
+    // Another thread is creating this session, wait for it rather than
+    // creating a duplicate.
+    cv_.wait(lk);
+  }
+  entries_.emplace(key, Entry{});
+  lk.unlock();
+
+  auto session = factory(request);
+
+  lk.lock();
+  if (session) {
+    auto& entry = entries_[key];
+    entry.pending = false;
+    entry.session = *session;
+    entry.expire_time =
+        google::cloud::internal::ToChronoTimePoint(session->expire_time());
+    EvictOverCapacity(capacity);
+  } else {
+    entries_.erase(key);
+  }
+  cv_.notify_all();
+  return session;
+}
+
+std::size_t ReadSessionCache::size() const {
+  std::lock_guard<std::mutex> lk(mu_);
+  return entries_.size();
+}
+
+std::string ReadSessionCache::Key(
+    google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+        request) {
+  // Only the input fields identify the session, discard any output fields the
+  // caller may have copied from a previous session.
+  auto normalized = request;
+  auto& session = *normalized.mutable_read_session();
+  session.clear_name();
+  session.clear_expire_time();
+  session.clear_arrow_schema();
+  session.clear_avro_schema();
+  session.clear_streams();
+  session.clear_estimated_total_bytes_scanned();
+  session.clear_estimated_total_physical_file_size();
+  session.clear_estimated_row_count();
+
+  std::string key;
+  {
+    google::protobuf::io::StringOutputStream output(&key);
+    google::protobuf::io::CodedOutputStream coded(&output);
+    coded.SetSerializationDeterministic(true);
+    normalized.SerializeToCodedStream(&coded);
+  }
+  return key;
+}
+
+void ReadSessionCache::EvictExpiring(
+    std::chrono::system_clock::time_point deadline) {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (!it->second.pending && it->second.expire_time <= deadline) {
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void ReadSessionCache::EvictOverCapacity(std::size_t capacity) {
+  while (entries_.size() > capacity) {
+    auto victim = entries_.end();
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->second.pending) continue;
+      if (victim == entries_.end() ||
+          it->second.expire_time < victim->second.expire_time) {
+        victim = it;
+      }
+    }
+    if (victim == entries_.end()) return;
+    entries_.erase(victim);
+  }
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
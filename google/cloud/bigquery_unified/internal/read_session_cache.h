@@ -0,0 +1,89 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_SESSION_CACHE_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_SESSION_CACHE_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/status_or.h"
+#include <google/cloud/bigquery/storage/v1/storage.pb.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Caches read sessions keyed by the request that created them.
+ *
+ * Sessions are reused until they are within `margin` of their `expire_time`,
+ * and are evicted as soon as they reach that point. Concurrent requests for
+ * the same uncached session wait for a single `CreateReadSession` call instead
+ * of each creating their own session.
+ */
+class ReadSessionCache {
+ public:
+  using Clock = std::function<std::chrono::system_clock::time_point()>;
+  using Factory =
+      std::function<StatusOr<google::cloud::bigquery::storage::v1::ReadSession>(
+          google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&)>;
+
+  explicit ReadSessionCache(Clock clock = std::chrono::system_clock::now)
+      : clock_(std::move(clock)) {}
+
+  /**
+   * Returns the cached session for @p request, or creates it with @p factory.
+   *
+   * At most @p capacity sessions are kept, when the cache is full the session
+   * closest to its expiration is evicted. Errors are not cached.
+   */
+  StatusOr<google::cloud::bigquery::storage::v1::ReadSession> GetOrCreate(
+      google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+          request,
+      std::chrono::milliseconds margin, std::size_t capacity,
+      Factory const& factory);
+
+  /// The number of cached (or pending) sessions.
+  std::size_t size() const;
+
+  /// Returns the cache key for @p request.
+  static std::string Key(
+      google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
+          request);
+
+ private:
+  struct Entry {
+    bool pending = true;
+    google::cloud::bigquery::storage::v1::ReadSession session;
+    std::chrono::system_clock::time_point expire_time;
+  };
+
+  void EvictExpiring(std::chrono::system_clock::time_point deadline);
+  void EvictOverCapacity(std::size_t capacity);
+
+  Clock clock_;
+  mutable std::mutex mu_;
+  std::condition_variable cv_;
+  std::map<std::string, Entry> entries_;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_SESSION_CACHE_H
@@ -0,0 +1,192 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_session_cache.h"
+#include "google/cloud/bigquery_unified/testing_util/status_matchers.h"
+#include "google/cloud/internal/make_status.h"
+#include "google/cloud/internal/time_utils.h"
+#include <gmock/gmock.h>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery::storage::v1::CreateReadSessionRequest;
+using ::google::cloud::bigquery::storage::v1::ReadSession;
+using ::google::cloud::bigquery_unified::testing_util::StatusIs;
+using ::testing::Eq;
+using ::testing::MockFunction;
+using ::testing::Ne;
+using ::testing::Return;
+
+auto constexpr kMargin = std::chrono::minutes(10);
+
+class ReadSessionCacheTest : public ::testing::Test {
+ protected:
+  ReadSessionCache MakeCache() {
+    return ReadSessionCache([this] { return now_; });
+  }
+
+  ReadSession MakeSession(std::string name, std::chrono::minutes ttl) {
+    ReadSession session;
+    session.set_name(std::move(name));
+    *session.mutable_expire_time() =
+        google::cloud::internal::ToProtoTimestamp(now_ + ttl);
+    return session;
+  }
+
+  static CreateReadSessionRequest MakeRequest(std::string const& table) {
+    CreateReadSessionRequest request;
+    request.set_parent("projects/p");
+    request.mutable_read_session()->set_table(table);
+    return request;
+  }
+
+  std::chrono::system_clock::time_point now_ =
+      std::chrono::system_clock::time_point{} + std::chrono::hours(1000);
+};
+
+TEST_F(ReadSessionCacheTest, ReusesSession) {
+  auto cache = MakeCache();
+  MockFunction<StatusOr<ReadSession>(CreateReadSessionRequest const&)> factory;
+  EXPECT_CALL(factory, Call).WillOnce(Return(MakeSession("s1", kMargin * 6)));
+
+  auto s1 = cache.GetOrCreate(MakeRequest("t"), kMargin, 10,
+                              factory.AsStdFunction());
+  ASSERT_STATUS_OK(s1);
+  auto s2 = cache.GetOrCreate(MakeRequest("t"), kMargin, 10,
+                              factory.AsStdFunction());
+  ASSERT_STATUS_OK(s2);
+  EXPECT_THAT(s2->name(), Eq("s1"));
+  EXPECT_EQ(cache.size(), 1U);
+}
+
+TEST_F(ReadSessionCacheTest, DifferentRequests) {
+  auto cache = MakeCache();
+  MockFunction<StatusOr<ReadSession>(CreateReadSessionRequest const&)> factory;
+  EXPECT_CALL(factory, Call)
+      .WillOnce(Return(MakeSession("s1", kMargin * 6)))
+      .WillOnce(Return(MakeSession("s2", kMargin * 6)));
+
+  auto s1 = cache.GetOrCreate(MakeRequest("t1"), kMargin, 10,
+                              factory.AsStdFunction());
+  auto s2 = cache.GetOrCreate(MakeRequest("t2"), kMargin, 10,
+                              factory.AsStdFunction());
+  ASSERT_STATUS_OK(s1);
+  ASSERT_STATUS_OK(s2);
+  EXPECT_THAT(s2->name(), Eq("s2"));
+  EXPECT_EQ(cache.size(), 2U);
+}
+
+TEST_F(ReadSessionCacheTest, EvictsNearExpiry) {
+  auto cache = MakeCache();
+  MockFunction<StatusOr<ReadSession>(CreateReadSessionRequest const&)> factory;
+  EXPECT_CALL(factory, Call)
+      .WillOnce(Return(MakeSession("s1", kMargin * 2)))
+      .WillOnce(Return(MakeSession("s2", kMargin * 2)));
+
+  auto s1 = cache.GetOrCreate(MakeRequest("t"), kMargin, 10,
+                              factory.AsStdFunction());
+  ASSERT_STATUS_OK(s1);
+  now_ += kMargin + std::chrono::seconds(1);
+  auto s2 = cache.GetOrCreate(MakeRequest("t"), kMargin, 10,
+                              factory.AsStdFunction());
+  ASSERT_STATUS_OK(s2);
+  EXPECT_THAT(s2->name(), Eq("s2"));
+  EXPECT_EQ(cache.size(), 1U);
+}
+
+TEST_F(ReadSessionCacheTest, EvictsOverCapacity) {
+  auto cache = MakeCache();
+  MockFunction<StatusOr<ReadSession>(CreateReadSessionRequest const&)> factory;
+  EXPECT_CALL(factory, Call)
+      .WillOnce(Return(MakeSession("s1", kMargin * 3)))
+      .WillOnce(Return(MakeSession("s2", kMargin * 6)))
+      .WillOnce(Return(MakeSession("s3", kMargin * 6)));
+
+  for (auto const* table : {"t1", "t2", "t3"}) {
+    ASSERT_STATUS_OK(cache.GetOrCreate(MakeRequest(table), kMargin, 2,
+                                       factory.AsStdFunction()));
+  }
+  EXPECT_EQ(cache.size(), 2U);
+}
+
+TEST_F(ReadSessionCacheTest, ErrorsAreNotCached) {
+  auto cache = MakeCache();
+  MockFunction<StatusOr<ReadSession>(CreateReadSessionRequest const&)> factory;
+  EXPECT_CALL(factory, Call)
+      .WillOnce(Return(internal::UnavailableError("try-again")))
+      .WillOnce(Return(MakeSession("s1", kMargin * 6)));
+
+  auto s1 = cache.GetOrCreate(MakeRequest("t"), kMargin, 10,
+                              factory.AsStdFunction());
+  EXPECT_THAT(s1, StatusIs(StatusCode::kUnavailable));
+  EXPECT_EQ(cache.size(), 0U);
+  auto s2 = cache.GetOrCreate(MakeRequest("t"), kMargin, 10,
+                              factory.AsStdFunction());
+  ASSERT_STATUS_OK(s2);
+  EXPECT_THAT(s2->name(), Eq("s1"));
+}
+
+TEST_F(ReadSessionCacheTest, ConcurrentCallsShareOneSession) {
+  auto cache = MakeCache();
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  std::atomic<int> calls{0};
+  auto factory = [&](CreateReadSessionRequest const&) -> StatusOr<ReadSession> {
+    ++calls;
+    released.wait();
+    return MakeSession("s1", kMargin * 6);
+  };
+
+  std::vector<std::thread> threads;
+  std::vector<std::string> names(4);
+  for (std::size_t i = 0; i != names.size(); ++i) {
+    threads.emplace_back([&, i] {
+      auto s = cache.GetOrCreate(MakeRequest("t"), kMargin, 10, factory);
+      if (s) names[i] = s->name();
+    });
+  }
+  while (calls.load() == 0) std::this_thread::yield();
+  release.set_value();
+  for (auto& t : threads) t.join();
+
+  EXPECT_THAT(calls.load(), Eq(1));
+  for (auto const& n : names) EXPECT_THAT(n, Eq("s1"));
+}
+
+TEST(ReadSessionCacheKey, IgnoresOutputFields) {
+  CreateReadSessionRequest request;
+  request.set_parent("projects/p");
+  request.mutable_read_session()->set_table("t");
+  auto with_outputs = request;
+  with_outputs.mutable_read_session()->set_name("session");
+  with_outputs.mutable_read_session()->add_streams()->set_name("stream");
+  with_outputs.mutable_read_session()->set_estimated_row_count(42);
+  EXPECT_THAT(ReadSessionCache::Key(with_outputs),
+              Eq(ReadSessionCache::Key(request)));
+
+  auto different = request;
+  different.set_max_stream_count(1);
+  EXPECT_THAT(ReadSessionCache::Key(different),
+              Ne(ReadSessionCache::Key(request)));
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
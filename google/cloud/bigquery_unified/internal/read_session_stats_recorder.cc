@@ -0,0 +1,61 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_session_stats_recorder.h"
+#include <mutex>
+#include <utility>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+ReadSessionStatsRecorder::ReadSessionStatsRecorder(
+    std::shared_ptr<bigquery_unified::ReadSessionStats> stats,
+    std::shared_ptr<ReadMetrics> child)
+    : stats_(std::move(stats)), child_(std::move(child)) {
+  for (std::size_t i = 0; i != stats_->stream_count(); ++i) {
+    index_.emplace(stats_->stream_name(i), i);
+  }
+}
+
+void ReadSessionStatsRecorder::RecordStreamStart(
+    std::string const& stream_name) {
+  if (child_) child_->RecordStreamStart(stream_name);
+  auto const i = index_.find(stream_name);
+  if (i == index_.end()) return;
+  std::lock_guard<std::mutex> lk(stats_->mu_);
+  // The first call starts the stream, any other call resumes it.
+  if (stats_->started_[i->second]) {
+    ++stats_->streams_[i->second].resumes;
+  } else {
+    stats_->started_[i->second] = true;
+  }
+}
+
+void ReadSessionStatsRecorder::RecordBatch(std::string const& stream_name,
+                                           ReadBatchMetrics const& batch) {
+  if (child_) child_->RecordBatch(stream_name, batch);
+  auto const i = index_.find(stream_name);
+  if (i == index_.end()) return;
+  std::lock_guard<std::mutex> lk(stats_->mu_);
+  auto& s = stats_->streams_[i->second];
+  s.bytes_received += batch.bytes;
+  s.rows += batch.rows;
+  ++s.batches;
+  s.decode_time += batch.decode_time;
+  s.wait_time += batch.wait_time;
+  s.progress = batch.progress;
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,56 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_SESSION_STATS_RECORDER_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_SESSION_STATS_RECORDER_H
+
+#include "google/cloud/bigquery_unified/internal/read_metrics.h"
+#include "google/cloud/bigquery_unified/read_session_stats.h"
+#include "google/cloud/bigquery_unified/version.h"
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Updates the `ReadSessionStats` of a `ReadArrowResponse`.
+ *
+ * The measurements are also forwarded to @p child, if it is not null, so one
+ * recorder serves both the statistics and the OpenTelemetry metrics of a read.
+ * Measurements of streams that are not in the session are ignored.
+ */
+class ReadSessionStatsRecorder : public ReadMetrics {
+ public:
+  ReadSessionStatsRecorder(
+      std::shared_ptr<bigquery_unified::ReadSessionStats> stats,
+      std::shared_ptr<ReadMetrics> child);
+  ~ReadSessionStatsRecorder() override = default;
+
+  void RecordStreamStart(std::string const& stream_name) override;
+  void RecordBatch(std::string const& stream_name,
+                   ReadBatchMetrics const& batch) override;
+
+ private:
+  std::shared_ptr<bigquery_unified::ReadSessionStats> stats_;
+  std::shared_ptr<ReadMetrics> child_;
+  std::unordered_map<std::string, std::size_t> index_;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_SESSION_STATS_RECORDER_H
@@ -0,0 +1,108 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_strategy.h"
+#include "google/cloud/bigquery_unified/read_options.h"
+#include "google/cloud/internal/absl_str_cat_quiet.h"
+#include "google/cloud/project.h"
+#include <utility>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+absl::optional<std::int64_t> EstimateJobResultRows(
+    google::cloud::bigquery::v2::Job const& job) {
+  auto const& job_type = job.configuration().job_type();
+  auto const& statistics = job.statistics();
+  if (job_type == "QUERY") {
+    // The last stage in the query plan writes the destination table.
+    auto const& plan = statistics.query().query_plan();
+    if (plan.empty()) return absl::nullopt;
+    auto const& output_stage = plan[plan.size() - 1];
+    if (!output_stage.has_records_written()) return absl::nullopt;
+    return output_stage.records_written().value();
+  }
+  if (job_type == "LOAD") {
+    if (!statistics.load().has_output_rows()) return absl::nullopt;
+    return statistics.load().output_rows().value();
+  }
+  if (job_type == "COPY") {
+    if (!statistics.copy().has_copied_rows()) return absl::nullopt;
+    return statistics.copy().copied_rows().value();
+  }
+  return absl::nullopt;
+}
+
+void ApplyReadStrategy(
+    google::cloud::bigquery::storage::v1::CreateReadSessionRequest& request,
+    Options const& options, absl::optional<std::int64_t> estimated_rows) {
+  if (options.has<bigquery_unified::PreferredMinimumReadStreamsOption>()) {
+    request.set_preferred_min_stream_count(
+        options.get<bigquery_unified::PreferredMinimumReadStreamsOption>());
+  }
+  if (options.has<bigquery_unified::MaxReadStreamsOption>()) {
+    request.set_max_stream_count(
+        options.get<bigquery_unified::MaxReadStreamsOption>());
+    return;
+  }
+  // Asking for a single stream while also asking for a minimum number of
+  // streams is contradictory, the explicit request wins.
+  if (options.has<bigquery_unified::PreferredMinimumReadStreamsOption>()) {
+    return;
+  }
+
+  auto const strategy =
+      options.has<bigquery_unified::ReadStrategyOption>()
+          ? options.get<bigquery_unified::ReadStrategyOption>()
+          : bigquery_unified::ReadStrategy::kAuto;
+  switch (strategy) {
+    case bigquery_unified::ReadStrategy::kSingleStream:
+      request.set_max_stream_count(1);
+      return;
+    case bigquery_unified::ReadStrategy::kMultiStream:
+      return;
+    case bigquery_unified::ReadStrategy::kAuto:
+      break;
+  }
+  if (!estimated_rows.has_value()) return;
+  if (!options.has<bigquery_unified::SingleStreamRowThresholdOption>()) return;
+  if (*estimated_rows <=
+      options.get<bigquery_unified::SingleStreamRowThresholdOption>()) {
+    request.set_max_stream_count(1);
+  }
+}
+
+google::cloud::bigquery::storage::v1::CreateReadSessionRequest
+MakeReadSessionRequest(
+    google::cloud::bigquery::v2::TableReference const& table_reference,
+    std::string billing_project, Options const& options,
+    absl::optional<std::int64_t> estimated_rows) {
+  google::cloud::bigquery::storage::v1::CreateReadSessionRequest
+      read_session_request;
+  read_session_request.set_parent(
+      google::cloud::Project(std::move(billing_project)).FullName());
+  ApplyReadStrategy(read_session_request, options, estimated_rows);
+
+  google::cloud::bigquery::storage::v1::ReadSession read_session;
+  read_session.set_data_format(
+      google::cloud::bigquery::storage::v1::DataFormat::ARROW);
+  read_session.set_table(absl::StrCat(
+      "projects/", table_reference.project_id(), "/datasets/",
+      table_reference.dataset_id(), "/tables/", table_reference.table_id()));
+  *read_session_request.mutable_read_session() = read_session;
+  return read_session_request;
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,53 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_STRATEGY_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_STRATEGY_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/options.h"
+#include "absl/types/optional.h"
+#include <google/cloud/bigquery/storage/v1/storage.pb.h>
+#include <google/cloud/bigquery/v2/job.pb.h>
+#include <cstdint>
+#include <string>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+// Returns the number of rows in the table written by `job`, as reported in the
+// job statistics. Returns an empty optional if the job type does not write a
+// table, or if the statistics are not (yet) populated.
+absl::optional<std::int64_t> EstimateJobResultRows(
+    google::cloud::bigquery::v2::Job const& job);
+
+// Sets the stream count fields of `request` using the
+// `bigquery_unified::ReadStrategyOption` in `options`. Explicitly configured
+// stream counts always take precedence over the strategy.
+void ApplyReadStrategy(
+    google::cloud::bigquery::storage::v1::CreateReadSessionRequest& request,
+    Options const& options, absl::optional<std::int64_t> estimated_rows);
+
+// Returns the request to read `table_reference` in the Arrow format, billed to
+// `billing_project`, with the stream counts set by `ApplyReadStrategy()`.
+google::cloud::bigquery::storage::v1::CreateReadSessionRequest
+MakeReadSessionRequest(
+    google::cloud::bigquery::v2::TableReference const& table_reference,
+    std::string billing_project, Options const& options,
+    absl::optional<std::int64_t> estimated_rows);
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_STRATEGY_H
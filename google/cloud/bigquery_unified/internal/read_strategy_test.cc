@@ -0,0 +1,117 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_strategy.h"
+#include "google/cloud/bigquery_unified/read_options.h"
+#include <gmock/gmock.h>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::testing::Eq;
+using ::testing::Optional;
+
+TEST(EstimateJobResultRows, Query) {
+  google::cloud::bigquery::v2::Job job;
+  job.mutable_configuration()->set_job_type("QUERY");
+  EXPECT_THAT(EstimateJobResultRows(job), Eq(absl::nullopt));
+
+  auto* plan = job.mutable_statistics()->mutable_query()->mutable_query_plan();
+  plan->Add()->mutable_records_written()->set_value(1000);
+  plan->Add()->mutable_records_written()->set_value(42);
+  EXPECT_THAT(EstimateJobResultRows(job), Optional(42));
+}
+
+TEST(EstimateJobResultRows, LoadAndCopy) {
+  google::cloud::bigquery::v2::Job job;
+  job.mutable_configuration()->set_job_type("LOAD");
+  EXPECT_THAT(EstimateJobResultRows(job), Eq(absl::nullopt));
+  job.mutable_statistics()->mutable_load()->mutable_output_rows()->set_value(7);
+  EXPECT_THAT(EstimateJobResultRows(job), Optional(7));
+
+  job.mutable_configuration()->set_job_type("COPY");
+  EXPECT_THAT(EstimateJobResultRows(job), Eq(absl::nullopt));
+  job.mutable_statistics()->mutable_copy()->mutable_copied_rows()->set_value(
+      8);
+  EXPECT_THAT(EstimateJobResultRows(job), Optional(8));
+
+  job.mutable_configuration()->set_job_type("EXTRACT");
+  EXPECT_THAT(EstimateJobResultRows(job), Eq(absl::nullopt));
+}
+
+TEST(ApplyReadStrategy, AutoUsesThreshold) {
+  auto const options =
+      Options{}
+          .set<bigquery_unified::ReadStrategyOption>(
+              bigquery_unified::ReadStrategy::kAuto)
+          .set<bigquery_unified::SingleStreamRowThresholdOption>(100);
+
+  google::cloud::bigquery::storage::v1::CreateReadSessionRequest small;
+  ApplyReadStrategy(small, options, 100);
+  EXPECT_THAT(small.max_stream_count(), Eq(1));
+
+  google::cloud::bigquery::storage::v1::CreateReadSessionRequest large;
+  ApplyReadStrategy(large, options, 101);
+  EXPECT_THAT(large.max_stream_count(), Eq(0));
+
+  google::cloud::bigquery::storage::v1::CreateReadSessionRequest unknown;
+  ApplyReadStrategy(unknown, options, absl::nullopt);
+  EXPECT_THAT(unknown.max_stream_count(), Eq(0));
+}
+
+TEST(ApplyReadStrategy, ExplicitStrategies) {
+  google::cloud::bigquery::storage::v1::CreateReadSessionRequest single;
+  ApplyReadStrategy(single,
+                    Options{}.set<bigquery_unified::ReadStrategyOption>(
+                        bigquery_unified::ReadStrategy::kSingleStream),
+                    absl::nullopt);
+  EXPECT_THAT(single.max_stream_count(), Eq(1));
+
+  google::cloud::bigquery::storage::v1::CreateReadSessionRequest multi;
+  ApplyReadStrategy(
+      multi,
+      Options{}
+          .set<bigquery_unified::ReadStrategyOption>(
+              bigquery_unified::ReadStrategy::kMultiStream)
+          .set<bigquery_unified::SingleStreamRowThresholdOption>(100),
+      1);
+  EXPECT_THAT(multi.max_stream_count(), Eq(0));
+}
+
+TEST(ApplyReadStrategy, StreamCountOptionsTakePrecedence) {
+  google::cloud::bigquery::storage::v1::CreateReadSessionRequest max;
+  ApplyReadStrategy(max,
+                    Options{}
+                        .set<bigquery_unified::ReadStrategyOption>(
+                            bigquery_unified::ReadStrategy::kSingleStream)
+                        .set<bigquery_unified::MaxReadStreamsOption>(8),
+                    absl::nullopt);
+  EXPECT_THAT(max.max_stream_count(), Eq(8));
+
+  google::cloud::bigquery::storage::v1::CreateReadSessionRequest min;
+  ApplyReadStrategy(
+      min,
+      Options{}
+          .set<bigquery_unified::ReadStrategyOption>(
+              bigquery_unified::ReadStrategy::kSingleStream)
+          .set<bigquery_unified::PreferredMinimumReadStreamsOption>(4),
+      absl::nullopt);
+  EXPECT_THAT(min.max_stream_count(), Eq(0));
+  EXPECT_THAT(min.preferred_min_stream_count(), Eq(4));
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
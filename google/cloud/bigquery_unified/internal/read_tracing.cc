@@ -0,0 +1,149 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_tracing.h"
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+#include "google/cloud/bigquery_unified/read_options.h"
+#include "google/cloud/internal/opentelemetry.h"
+#include "google/cloud/internal/traced_stream_range.h"
+#include <opentelemetry/context/runtime_context.h>
+#include <opentelemetry/trace/context.h>
+#include <opentelemetry/trace/scope.h>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+namespace {
+
+auto constexpr kDefaultDecodeSpanInterval = 100;
+
+class OpenTelemetryReadTracer : public ReadTracer {
+ public:
+  explicit OpenTelemetryReadTracer(Options const& options)
+      : tracer_(internal::GetTracer(options)),
+        parent_(opentelemetry::trace::GetSpan(
+                    opentelemetry::context::RuntimeContext::GetCurrent())
+                    ->GetContext()),
+        decode_span_interval_(DecodeSpanInterval(options)) {}
+
+  RecordBatchStream TraceStream(
+      std::string const& stream_name,
+      std::function<RecordBatchStream()> const& make_reader) override {
+    auto const session_name = ReadSessionName(stream_name);
+    opentelemetry::trace::StartSpanOptions start;
+    start.parent = parent_;
+    auto span = tracer_->StartSpan(
+        "bigquery_unified::ReadRows",
+        {{"bigquery.read_session",
+          opentelemetry::nostd::string_view(session_name)},
+         {"bigquery.read_stream",
+          opentelemetry::nostd::string_view(stream_name)}},
+        start);
+    {
+      std::lock_guard<std::mutex> lk(mu_);
+      streams_[stream_name] = StreamState{span, false, 0};
+    }
+    // Creating the reader makes the first `ReadRows` call, which is then
+    // traced as a child of the stream span.
+    auto scope = opentelemetry::trace::Scope(span);
+    auto reader = make_reader();
+    return internal::MakeTracedStreamRange<std::shared_ptr<arrow::RecordBatch>>(
+        std::move(span), std::move(reader));
+  }
+
+  void RecordStreamStart(std::string const& stream_name) override {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto s = streams_.find(stream_name);
+    if (s == streams_.end()) return;
+    if (s->second.started) {
+      s->second.span->AddEvent("bigquery_unified::ReadRows resumed");
+    }
+    s->second.started = true;
+  }
+
+  void RecordBatch(std::string const& stream_name,
+                   ReadBatchMetrics const& batch) override {
+    opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> stream_span;
+    {
+      std::lock_guard<std::mutex> lk(mu_);
+      auto s = streams_.find(stream_name);
+      if (s == streams_.end()) return;
+      if (s->second.batches++ % decode_span_interval_ != 0) return;
+      stream_span = s->second.span;
+    }
+    // The batch is already decoded, the span is created with the times the
+    // decoding started and ended.
+    auto const steady_end = std::chrono::steady_clock::now();
+    auto const system_end = std::chrono::system_clock::now();
+    opentelemetry::trace::StartSpanOptions start;
+    start.parent = stream_span->GetContext();
+    start.start_steady_time = opentelemetry::common::SteadyTimestamp(
+        steady_end -
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            batch.decode_time));
+    start.start_system_time = opentelemetry::common::SystemTimestamp(
+        system_end -
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            batch.decode_time));
+    auto span = tracer_->StartSpan(
+        "bigquery_unified::DecodeRecordBatch",
+        {{"bigquery.rows", batch.rows}, {"bigquery.bytes", batch.bytes}},
+        start);
+    opentelemetry::trace::EndSpanOptions end;
+    end.end_steady_time = opentelemetry::common::SteadyTimestamp(steady_end);
+    span->End(end);
+  }
+
+ private:
+  struct StreamState {
+    opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> span;
+    bool started;
+    std::int64_t batches;
+  };
+
+  static std::int64_t DecodeSpanInterval(Options const& options) {
+    auto const interval =
+        options.get<bigquery_unified::ReadDecodeSpanIntervalOption>();
+    return interval <= 0 ? kDefaultDecodeSpanInterval : interval;
+  }
+
+  opentelemetry::nostd::shared_ptr<opentelemetry::trace::Tracer> tracer_;
+  opentelemetry::trace::SpanContext parent_;
+  std::int64_t const decode_span_interval_;
+  std::mutex mu_;
+  std::unordered_map<std::string, StreamState> streams_;  // GUARDED_BY(mu_)
+};
+
+}  // namespace
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+
+std::shared_ptr<ReadTracer> MakeReadTracer(Options const& options) {
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+  if (!internal::TracingEnabled(options)) return nullptr;
+  return std::make_shared<OpenTelemetryReadTracer>(options);
+#else
+  (void)options;
+  return nullptr;
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,59 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_TRACING_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_TRACING_H
+
+#include "google/cloud/bigquery_unified/internal/read_metrics.h"
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/options.h"
+#include "google/cloud/stream_range.h"
+#include <arrow/record_batch.h>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Traces the streams of a read as children of the span of its operation.
+ *
+ * Each stream has a span for its lifetime, with the spans of its `ReadRows`
+ * calls as children, and an event for each resume. A sample of its record
+ * batches have a decode span.
+ */
+class ReadTracer : public ReadMetrics {
+ public:
+  using RecordBatchStream = StreamRange<std::shared_ptr<arrow::RecordBatch>>;
+
+  /// Creates the reader of @p stream_name, and traces it until it ends.
+  virtual RecordBatchStream TraceStream(
+      std::string const& stream_name,
+      std::function<RecordBatchStream()> const& make_reader) = 0;
+};
+
+/**
+ * Returns the tracer for the streams of a read made with @p options.
+ *
+ * The active span becomes the parent of the stream spans, so the tracer must
+ * be created on the thread that starts the read. Returns `nullptr` if tracing
+ * is disabled, or if the library is built without OpenTelemetry.
+ */
+std::shared_ptr<ReadTracer> MakeReadTracer(Options const& options);
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_READ_TRACING_H
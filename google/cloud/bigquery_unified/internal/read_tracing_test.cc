@@ -0,0 +1,102 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/read_tracing.h"
+#include "google/cloud/bigquery_unified/read_options.h"
+#include "google/cloud/bigquery_unified/testing_util/opentelemetry_matchers.h"
+#include "google/cloud/internal/opentelemetry.h"
+#include <gmock/gmock.h>
+#include <memory>
+#include <string>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::testing::IsNull;
+
+#ifdef GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+using ::google::cloud::bigquery_unified::testing_util::DisableTracing;
+using ::google::cloud::bigquery_unified::testing_util::EnableTracing;
+using ::google::cloud::bigquery_unified::testing_util::EventNamed;
+using ::google::cloud::bigquery_unified::testing_util::InstallSpanCatcher;
+using ::google::cloud::bigquery_unified::testing_util::SpanEventsAre;
+using ::google::cloud::bigquery_unified::testing_util::SpanNamed;
+using ::google::cloud::bigquery_unified::testing_util::SpanWithParent;
+using ::testing::AllOf;
+using ::testing::NotNull;
+using ::testing::UnorderedElementsAre;
+
+auto constexpr kStreamName = "projects/p/locations/l/sessions/s/streams/t";
+
+ReadTracer::RecordBatchStream MakeReader(int batches) {
+  return internal::MakeStreamRange<std::shared_ptr<arrow::RecordBatch>>(
+      [batches]() mutable
+      -> absl::variant<Status, std::shared_ptr<arrow::RecordBatch>> {
+        if (batches-- == 0) return Status{};
+        return std::shared_ptr<arrow::RecordBatch>();
+      });
+}
+
+TEST(ReadTracingTest, TracesStreamsAsChildren) {
+  auto span_catcher = InstallSpanCatcher();
+  auto options = EnableTracing(
+      Options{}.set<bigquery_unified::ReadDecodeSpanIntervalOption>(2));
+
+  auto parent = internal::MakeSpan("parent");
+  std::shared_ptr<ReadTracer> tracer;
+  {
+    auto scope = opentelemetry::trace::Scope(parent);
+    tracer = MakeReadTracer(options);
+  }
+  ASSERT_THAT(tracer, NotNull());
+
+  auto reader = tracer->TraceStream(kStreamName, [&] {
+    tracer->RecordStreamStart(kStreamName);
+    return MakeReader(3);
+  });
+  // A second call resumes the stream.
+  tracer->RecordStreamStart(kStreamName);
+  for (int i = 0; i != 3; ++i) {
+    tracer->RecordBatch(kStreamName, ReadBatchMetrics{});
+  }
+  for (auto& batch : reader) EXPECT_TRUE(batch.ok());
+  parent->End();
+
+  auto spans = span_catcher->GetSpans();
+  // With an interval of 2, the first and third batches are traced.
+  EXPECT_THAT(
+      spans,
+      UnorderedElementsAre(
+          SpanNamed("parent"),
+          AllOf(SpanNamed("bigquery_unified::ReadRows"),
+                SpanWithParent(parent),
+                SpanEventsAre(
+                    EventNamed("bigquery_unified::ReadRows resumed"))),
+          SpanNamed("bigquery_unified::DecodeRecordBatch"),
+          SpanNamed("bigquery_unified::DecodeRecordBatch")));
+}
+
+TEST(ReadTracingTest, TracingDisabled) {
+  EXPECT_THAT(MakeReadTracer(DisableTracing(Options{})), IsNull());
+}
+#else
+TEST(ReadTracingTest, WithoutOpenTelemetry) {
+  EXPECT_THAT(MakeReadTracer(Options{}), IsNull());
+}
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
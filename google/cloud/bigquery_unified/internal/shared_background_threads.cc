@@ -0,0 +1,41 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/shared_background_threads.h"
+#include <utility>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+SharedBackgroundThreads::SharedBackgroundThreads(
+    BackgroundThreadsFactory factory)
+    : state_(std::make_shared<State>()) {
+  state_->factory = std::move(factory);
+}
+
+CompletionQueue SharedBackgroundThreads::cq() const {
+  std::call_once(state_->once, [s = state_.get()] {
+    s->threads = s->factory();
+    s->factory = nullptr;
+  });
+  return state_->threads->cq();
+}
+
+std::unique_ptr<BackgroundThreads> SharedBackgroundThreads::Share() const {
+  return std::unique_ptr<BackgroundThreads>(
+      new SharedBackgroundThreads(state_));
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
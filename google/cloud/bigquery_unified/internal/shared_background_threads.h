@@ -0,0 +1,64 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_SHARED_BACKGROUND_THREADS_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_SHARED_BACKGROUND_THREADS_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/background_threads.h"
+#include "google/cloud/completion_queue.h"
+#include "google/cloud/grpc_options.h"
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Background threads created on first use and shared by several owners.
+ *
+ * The read, job and table connections each take ownership of a
+ * `BackgroundThreads`. Giving each of them a `Share()` of one instance runs
+ * all their work on a single completion queue, and no threads are started
+ * until one of them needs the completion queue. The threads are stopped when
+ * the last owner is destroyed.
+ */
+class SharedBackgroundThreads : public BackgroundThreads {
+ public:
+  explicit SharedBackgroundThreads(BackgroundThreadsFactory factory);
+  ~SharedBackgroundThreads() override = default;
+
+  CompletionQueue cq() const override;
+
+  /// Returns another owner of the same background threads.
+  std::unique_ptr<BackgroundThreads> Share() const;
+
+ private:
+  struct State {
+    std::once_flag once;
+    BackgroundThreadsFactory factory;
+    std::unique_ptr<BackgroundThreads> threads;
+  };
+
+  explicit SharedBackgroundThreads(std::shared_ptr<State> state)
+      : state_(std::move(state)) {}
+
+  std::shared_ptr<State> state_;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_SHARED_BACKGROUND_THREADS_H
@@ -0,0 +1,75 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/shared_background_threads.h"
+#include <gmock/gmock.h>
+#include <memory>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+// Counts the live instances.
+class FakeBackgroundThreads : public BackgroundThreads {
+ public:
+  explicit FakeBackgroundThreads(int& live) : live_(live) { ++live_; }
+  ~FakeBackgroundThreads() override { --live_; }
+
+  CompletionQueue cq() const override { return CompletionQueue(nullptr); }
+
+ private:
+  int& live_;
+};
+
+TEST(SharedBackgroundThreadsTest, CreatedOnFirstUseAndShared) {
+  int created = 0;
+  int live = 0;
+  auto background =
+      std::make_unique<SharedBackgroundThreads>([&created, &live] {
+        ++created;
+        return std::make_unique<FakeBackgroundThreads>(live);
+      });
+  auto share1 = background->Share();
+  auto share2 = background->Share();
+  EXPECT_EQ(created, 0);
+
+  (void)share1->cq();
+  (void)share2->cq();
+  (void)background->cq();
+  EXPECT_EQ(created, 1);
+  EXPECT_EQ(live, 1);
+
+  // The threads are released with the last owner.
+  background.reset();
+  share1.reset();
+  EXPECT_EQ(live, 1);
+  share2.reset();
+  EXPECT_EQ(live, 0);
+}
+
+TEST(SharedBackgroundThreadsTest, NeverUsed) {
+  int created = 0;
+  {
+    SharedBackgroundThreads background([&created] {
+      ++created;
+      return std::unique_ptr<BackgroundThreads>();
+    });
+    auto share = background.Share();
+  }
+  EXPECT_EQ(created, 0);
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
@@ -0,0 +1,160 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/table_schema.h"
+#include "google/cloud/internal/absl_str_cat_quiet.h"
+#include "google/cloud/internal/make_status.h"
+#include "absl/strings/ascii.h"
+#include <arrow/api.h>
+#include <algorithm>
+#include <set>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery::v2::TableFieldSchema;
+using FieldList = google::protobuf::RepeatedPtrField<TableFieldSchema>;
+
+// Copies the fields of `in` selected by `paths` into `out`. Each path is
+// relative to `in`, in lowercase, and is removed from `unmatched` once found.
+void SelectFieldList(FieldList const& in, std::set<std::string> const& paths,
+                     std::string const& prefix,
+                     std::set<std::string>& unmatched, FieldList& out) {
+  for (auto const& field : in) {
+    auto const path = prefix + absl::AsciiStrToLower(field.name());
+    auto const nested = path + ".";
+    auto const is_nested = [&nested](std::string const& p) {
+      return p.compare(0, nested.size(), nested) == 0;
+    };
+    if (paths.count(path) != 0) {
+      // The subfields of a selected RECORD are implicitly selected.
+      unmatched.erase(path);
+      for (auto it = unmatched.lower_bound(nested);
+           it != unmatched.end() && is_nested(*it);) {
+        it = unmatched.erase(it);
+      }
+      *out.Add() = field;
+      continue;
+    }
+    // Select only some of the subfields of a RECORD.
+    auto it = paths.lower_bound(nested);
+    if (it == paths.end() || !is_nested(*it)) continue;
+    auto& selected = *out.Add();
+    selected = field;
+    selected.clear_fields();
+    SelectFieldList(field.fields(), paths, nested, unmatched,
+                    *selected.mutable_fields());
+  }
+}
+
+StatusOr<std::shared_ptr<arrow::DataType>> ToArrowType(
+    std::string const& type) {
+  // See https://cloud.google.com/bigquery/docs/reference/storage#arrow_schema_details
+  if (type == "STRING" || type == "GEOGRAPHY" || type == "JSON") {
+    return arrow::utf8();
+  }
+  if (type == "BYTES") return arrow::binary();
+  if (type == "INTEGER" || type == "INT64") return arrow::int64();
+  if (type == "FLOAT" || type == "FLOAT64") return arrow::float64();
+  if (type == "BOOLEAN" || type == "BOOL") return arrow::boolean();
+  if (type == "NUMERIC") return arrow::decimal128(38, 9);
+  if (type == "BIGNUMERIC") return arrow::decimal256(76, 38);
+  if (type == "TIMESTAMP") {
+    return arrow::timestamp(arrow::TimeUnit::MICRO, "UTC");
+  }
+  if (type == "DATETIME") return arrow::timestamp(arrow::TimeUnit::MICRO);
+  if (type == "DATE") return arrow::date32();
+  if (type == "TIME") return arrow::time64(arrow::TimeUnit::MICRO);
+  if (type == "INTERVAL") return arrow::month_day_nano_interval();
+  return internal::InvalidArgumentError(
+      absl::StrCat("Unsupported BigQuery type: ", type), GCP_ERROR_INFO());
+}
+
+StatusOr<std::shared_ptr<arrow::Field>> ToArrowField(
+    TableFieldSchema const& field);
+
+StatusOr<std::vector<std::shared_ptr<arrow::Field>>> ToArrowFields(
+    FieldList const& fields) {
+  std::vector<std::shared_ptr<arrow::Field>> result;
+  result.reserve(fields.size());
+  for (auto const& f : fields) {
+    auto field = ToArrowField(f);
+    if (!field) return std::move(field).status();
+    result.push_back(*std::move(field));
+  }
+  return result;
+}
+
+StatusOr<std::shared_ptr<arrow::Field>> ToArrowField(
+    TableFieldSchema const& field) {
+  StatusOr<std::shared_ptr<arrow::DataType>> type;
+  if (field.type() == "RECORD" || field.type() == "STRUCT") {
+    auto children = ToArrowFields(field.fields());
+    if (!children) return std::move(children).status();
+    type = arrow::struct_(*std::move(children));
+  } else if (field.type() == "RANGE") {
+    auto element = ToArrowType(field.range_element_type().type());
+    if (!element) return std::move(element).status();
+    type = arrow::struct_(
+        {arrow::field("start", *element), arrow::field("end", *element)});
+  } else {
+    type = ToArrowType(field.type());
+  }
+  if (!type) return std::move(type).status();
+
+  if (field.mode() == "REPEATED") {
+    return arrow::field(field.name(),
+                        arrow::list(arrow::field("item", *type, false)),
+                        false);
+  }
+  return arrow::field(field.name(), *type, field.mode() != "REQUIRED");
+}
+
+}  // namespace
+
+StatusOr<google::cloud::bigquery::v2::TableSchema> SelectFields(
+    google::cloud::bigquery::v2::TableSchema const& schema,
+    std::vector<std::string> const& selected_fields) {
+  if (selected_fields.empty()) return schema;
+  // Column names are case-insensitive in BigQuery.
+  std::set<std::string> paths;
+  for (auto const& f : selected_fields) paths.insert(absl::AsciiStrToLower(f));
+  auto unmatched = paths;
+  google::cloud::bigquery::v2::TableSchema result;
+  SelectFieldList(schema.fields(), paths, "", unmatched,
+                  *result.mutable_fields());
+  if (!unmatched.empty()) {
+    auto const& missing = *std::find_if(
+        selected_fields.begin(), selected_fields.end(),
+        [&](std::string const& f) {
+          return absl::AsciiStrToLower(f) == *unmatched.begin();
+        });
+    return internal::InvalidArgumentError(
+        absl::StrCat("Selected field not found in the table schema: ",
+                     missing),
+        GCP_ERROR_INFO());
+  }
+  return result;
+}
+
+StatusOr<std::shared_ptr<arrow::Schema>> ToArrowSchema(
+    google::cloud::bigquery::v2::TableSchema const& schema) {
+  auto fields = ToArrowFields(schema.fields());
+  if (!fields) return std::move(fields).status();
+  return arrow::schema(*std::move(fields));
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
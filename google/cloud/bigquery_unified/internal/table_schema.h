@@ -0,0 +1,45 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_TABLE_SCHEMA_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_TABLE_SCHEMA_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/status_or.h"
+#include <google/cloud/bigquery/v2/table_schema.pb.h>
+#include <arrow/type.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+// Returns the subset of `schema` containing only the `selected_fields`, in
+// table order. Nested fields are selected using their dotted path, e.g. `a.b`.
+// Like column names in BigQuery, the paths are case-insensitive. An empty
+// selection returns the full schema.
+StatusOr<google::cloud::bigquery::v2::TableSchema> SelectFields(
+    google::cloud::bigquery::v2::TableSchema const& schema,
+    std::vector<std::string> const& selected_fields);
+
+// Converts a BigQuery table schema to the Arrow schema used by the BigQuery
+// Storage Read API for the same table.
+StatusOr<std::shared_ptr<arrow::Schema>> ToArrowSchema(
+    google::cloud::bigquery::v2::TableSchema const& schema);
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_TABLE_SCHEMA_H
@@ -0,0 +1,62 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/table_schema_cache.h"
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+absl::optional<google::cloud::bigquery::v2::TableSchema>
+TableSchemaCache::Lookup(std::string const& key) {
+  std::lock_guard<std::mutex> lk(mu_);
+  EvictExpired(clock_());
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return absl::nullopt;
+  return it->second.schema;
+}
+
+void TableSchemaCache::Insert(std::string key,
+                              google::cloud::bigquery::v2::TableSchema schema,
+                              std::chrono::milliseconds ttl,
+                              std::size_t capacity) {
+  std::lock_guard<std::mutex> lk(mu_);
+  auto const now = clock_();
+  EvictExpired(now);
+  entries_[std::move(key)] = Entry{std::move(schema), now + ttl};
+  while (entries_.size() > capacity) {
+    auto victim = entries_.begin();
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->second.expire_time < victim->second.expire_time) victim = it;
+    }
+    entries_.erase(victim);
+  }
+}
+
+std::size_t TableSchemaCache::size() const {
+  std::lock_guard<std::mutex> lk(mu_);
+  return entries_.size();
+}
+
+void TableSchemaCache::EvictExpired(std::chrono::system_clock::time_point now) {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->second.expire_time <= now) {
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
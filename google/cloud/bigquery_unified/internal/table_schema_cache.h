@@ -0,0 +1,73 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_TABLE_SCHEMA_CACHE_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_TABLE_SCHEMA_CACHE_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include "absl/types/optional.h"
+#include <google/cloud/bigquery/v2/table_schema.pb.h>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Caches table schemas for a limited time.
+ *
+ * Table schemas rarely change, but they can. Each entry is kept for the time
+ * to live given when it was inserted, expired entries are evicted on the next
+ * access. The number of entries is bounded by the capacity given to `Insert()`.
+ */
+class TableSchemaCache {
+ public:
+  using Clock = std::function<std::chrono::system_clock::time_point()>;
+
+  explicit TableSchemaCache(Clock clock = std::chrono::system_clock::now)
+      : clock_(std::move(clock)) {}
+
+  absl::optional<google::cloud::bigquery::v2::TableSchema> Lookup(
+      std::string const& key);
+
+  /**
+   * Caches @p schema, evicting the entries closest to expiration to keep at
+   * most @p capacity entries.
+   */
+  void Insert(std::string key, google::cloud::bigquery::v2::TableSchema schema,
+              std::chrono::milliseconds ttl, std::size_t capacity);
+
+  std::size_t size() const;
+
+ private:
+  struct Entry {
+    google::cloud::bigquery::v2::TableSchema schema;
+    std::chrono::system_clock::time_point expire_time;
+  };
+
+  void EvictExpired(std::chrono::system_clock::time_point now);
+
+  Clock clock_;
+  mutable std::mutex mu_;
+  std::map<std::string, Entry> entries_;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_TABLE_SCHEMA_CACHE_H
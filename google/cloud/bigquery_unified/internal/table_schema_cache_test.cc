@@ -0,0 +1,78 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/table_schema_cache.h"
+#include <gmock/gmock.h>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery::v2::TableSchema;
+
+TableSchema MakeSchema(std::string const& name) {
+  TableSchema schema;
+  auto& field = *schema.mutable_fields()->Add();
+  field.set_name(name);
+  field.set_type("STRING");
+  return schema;
+}
+
+TEST(TableSchemaCache, LookupAndExpire) {
+  auto now = std::chrono::system_clock::now();
+  TableSchemaCache cache([&now] { return now; });
+
+  EXPECT_FALSE(cache.Lookup("p.d.t").has_value());
+  cache.Insert("p.d.t", MakeSchema("a"), std::chrono::minutes(5), 10);
+  cache.Insert("p.d.u", MakeSchema("b"), std::chrono::minutes(10), 10);
+  EXPECT_EQ(cache.size(), 2U);
+
+  auto schema = cache.Lookup("p.d.t");
+  ASSERT_TRUE(schema.has_value());
+  EXPECT_EQ(schema->fields(0).name(), "a");
+
+  now += std::chrono::minutes(6);
+  EXPECT_FALSE(cache.Lookup("p.d.t").has_value());
+  EXPECT_EQ(cache.size(), 1U);
+  EXPECT_TRUE(cache.Lookup("p.d.u").has_value());
+}
+
+TEST(TableSchemaCache, InsertReplaces) {
+  auto now = std::chrono::system_clock::now();
+  TableSchemaCache cache([&now] { return now; });
+
+  cache.Insert("p.d.t", MakeSchema("a"), std::chrono::minutes(5), 10);
+  cache.Insert("p.d.t", MakeSchema("b"), std::chrono::minutes(5), 10);
+  EXPECT_EQ(cache.size(), 1U);
+  auto schema = cache.Lookup("p.d.t");
+  ASSERT_TRUE(schema.has_value());
+  EXPECT_EQ(schema->fields(0).name(), "b");
+}
+
+TEST(TableSchemaCache, InsertEvictsClosestToExpiration) {
+  auto now = std::chrono::system_clock::now();
+  TableSchemaCache cache([&now] { return now; });
+
+  cache.Insert("p.d.t", MakeSchema("a"), std::chrono::minutes(10), 2);
+  cache.Insert("p.d.u", MakeSchema("b"), std::chrono::minutes(5), 2);
+  cache.Insert("p.d.v", MakeSchema("c"), std::chrono::minutes(10), 2);
+  EXPECT_EQ(cache.size(), 2U);
+  EXPECT_TRUE(cache.Lookup("p.d.t").has_value());
+  EXPECT_FALSE(cache.Lookup("p.d.u").has_value());
+  EXPECT_TRUE(cache.Lookup("p.d.v").has_value());
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
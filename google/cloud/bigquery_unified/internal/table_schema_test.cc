@@ -0,0 +1,162 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/table_schema.h"
+#include "google/cloud/bigquery_unified/testing_util/status_matchers.h"
+#include <arrow/api.h>
+#include <gmock/gmock.h>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery::v2::TableFieldSchema;
+using ::google::cloud::bigquery::v2::TableSchema;
+using ::google::cloud::bigquery_unified::testing_util::StatusIs;
+using ::testing::ElementsAre;
+using ::testing::HasSubstr;
+
+TableFieldSchema* AddField(
+    google::protobuf::RepeatedPtrField<TableFieldSchema>& fields,
+    std::string name, std::string type, std::string mode = "NULLABLE") {
+  auto* field = fields.Add();
+  field->set_name(std::move(name));
+  field->set_type(std::move(type));
+  field->set_mode(std::move(mode));
+  return field;
+}
+
+TableSchema MakeSchema() {
+  TableSchema schema;
+  auto& fields = *schema.mutable_fields();
+  AddField(fields, "id", "INTEGER", "REQUIRED");
+  auto* record = AddField(fields, "person", "RECORD");
+  AddField(*record->mutable_fields(), "name", "STRING");
+  AddField(*record->mutable_fields(), "age", "INT64");
+  AddField(fields, "tags", "STRING", "REPEATED");
+  return schema;
+}
+
+std::vector<std::string> Names(TableSchema const& schema) {
+  std::vector<std::string> names;
+  for (auto const& f : schema.fields()) {
+    names.push_back(f.name());
+    for (auto const& c : f.fields()) names.push_back(f.name() + "." + c.name());
+  }
+  return names;
+}
+
+TEST(SelectFields, All) {
+  auto selected = SelectFields(MakeSchema(), {});
+  ASSERT_STATUS_OK(selected);
+  EXPECT_THAT(Names(*selected), ElementsAre("id", "person", "person.name",
+                                            "person.age", "tags"));
+}
+
+TEST(SelectFields, TableOrder) {
+  auto selected = SelectFields(MakeSchema(), {"tags", "id"});
+  ASSERT_STATUS_OK(selected);
+  EXPECT_THAT(Names(*selected), ElementsAre("id", "tags"));
+}
+
+TEST(SelectFields, Nested) {
+  auto selected = SelectFields(MakeSchema(), {"person.age"});
+  ASSERT_STATUS_OK(selected);
+  EXPECT_THAT(Names(*selected), ElementsAre("person", "person.age"));
+
+  selected = SelectFields(MakeSchema(), {"person", "person.age"});
+  ASSERT_STATUS_OK(selected);
+  EXPECT_THAT(Names(*selected),
+              ElementsAre("person", "person.name", "person.age"));
+}
+
+TEST(SelectFields, CaseInsensitive) {
+  auto selected = SelectFields(MakeSchema(), {"Person.AGE", "ID"});
+  ASSERT_STATUS_OK(selected);
+  // The selected fields keep the names in the table schema.
+  EXPECT_THAT(Names(*selected), ElementsAre("id", "person", "person.age"));
+
+  EXPECT_THAT(SelectFields(MakeSchema(), {"Missing"}),
+              StatusIs(StatusCode::kInvalidArgument, HasSubstr("Missing")));
+}
+
+TEST(SelectFields, NotFound) {
+  EXPECT_THAT(SelectFields(MakeSchema(), {"id", "missing"}),
+              StatusIs(StatusCode::kInvalidArgument, HasSubstr("missing")));
+  EXPECT_THAT(SelectFields(MakeSchema(), {"person.missing"}),
+              StatusIs(StatusCode::kInvalidArgument,
+                       HasSubstr("person.missing")));
+}
+
+TEST(ToArrowSchema, Basic) {
+  auto schema = ToArrowSchema(MakeSchema());
+  ASSERT_STATUS_OK(schema);
+  auto expected = arrow::schema({
+      arrow::field("id", arrow::int64(), false),
+      arrow::field("person",
+                   arrow::struct_({arrow::field("name", arrow::utf8()),
+                                   arrow::field("age", arrow::int64())})),
+      arrow::field("tags",
+                   arrow::list(arrow::field("item", arrow::utf8(), false)),
+                   false),
+  });
+  EXPECT_TRUE((*schema)->Equals(*expected)) << (*schema)->ToString();
+}
+
+TEST(ToArrowSchema, Types) {
+  TableSchema schema;
+  auto& fields = *schema.mutable_fields();
+  AddField(fields, "a", "NUMERIC");
+  AddField(fields, "b", "BIGNUMERIC");
+  AddField(fields, "c", "TIMESTAMP");
+  AddField(fields, "d", "DATETIME");
+  AddField(fields, "e", "DATE");
+  AddField(fields, "f", "TIME");
+  AddField(fields, "g", "BOOLEAN");
+  AddField(fields, "h", "FLOAT64");
+  AddField(fields, "i", "BYTES");
+  AddField(fields, "j", "JSON");
+  AddField(fields, "k", "RANGE")
+      ->mutable_range_element_type()
+      ->set_type("DATE");
+
+  auto actual = ToArrowSchema(schema);
+  ASSERT_STATUS_OK(actual);
+  auto expected = arrow::schema({
+      arrow::field("a", arrow::decimal128(38, 9)),
+      arrow::field("b", arrow::decimal256(76, 38)),
+      arrow::field("c", arrow::timestamp(arrow::TimeUnit::MICRO, "UTC")),
+      arrow::field("d", arrow::timestamp(arrow::TimeUnit::MICRO)),
+      arrow::field("e", arrow::date32()),
+      arrow::field("f", arrow::time64(arrow::TimeUnit::MICRO)),
+      arrow::field("g", arrow::boolean()),
+      arrow::field("h", arrow::float64()),
+      arrow::field("i", arrow::binary()),
+      arrow::field("j", arrow::utf8()),
+      arrow::field("k", arrow::struct_({arrow::field("start", arrow::date32()),
+                                        arrow::field("end", arrow::date32())})),
+  });
+  EXPECT_TRUE((*actual)->Equals(*expected)) << (*actual)->ToString();
+}
+
+TEST(ToArrowSchema, Unsupported) {
+  TableSchema schema;
+  AddField(*schema.mutable_fields(), "a", "UNKNOWN");
+  EXPECT_THAT(ToArrowSchema(schema),
+              StatusIs(StatusCode::kInvalidArgument, HasSubstr("UNKNOWN")));
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
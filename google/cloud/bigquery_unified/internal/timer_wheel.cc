@@ -0,0 +1,136 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/timer_wheel.h"
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+TimerWheel::TimerWheel(std::chrono::milliseconds tick, Clock clock)
+    : tick_(std::max(tick, std::chrono::milliseconds(1))),
+      clock_(std::move(clock)),
+      start_(clock_()) {}
+
+future<TimerWheel::TimerResult> TimerWheel::MakeRelativeTimer(
+    CompletionQueue cq, std::chrono::milliseconds duration) {
+  promise<TimerResult> p;
+  auto f = p.get_future();
+
+  std::unique_lock<std::mutex> lk(mu_);
+  auto const now = CurrentTick();
+  // An empty wheel has nothing to expire, skip over the idle ticks.
+  if (size_ == 0) current_ = std::max(current_, now);
+  auto const ticks = (std::max(duration, std::chrono::milliseconds(0)) +
+                      tick_ - std::chrono::milliseconds(1)) /
+                     tick_;
+  auto const deadline =
+      std::max(now + static_cast<std::uint64_t>(ticks), current_ + 1);
+  Insert(Timer{deadline, std::move(p)});
+  ++size_;
+  if (running_) return f;
+  cq_ = std::move(cq);
+  StartTimer(std::move(lk));
+  return f;
+}
+
+std::size_t TimerWheel::size() const {
+  std::lock_guard<std::mutex> lk(mu_);
+  return size_;
+}
+
+std::uint64_t TimerWheel::CurrentTick() const {
+  return static_cast<std::uint64_t>((clock_() - start_) / tick_);
+}
+
+void TimerWheel::Insert(Timer timer) {
+  auto const delta = timer.deadline - std::min(timer.deadline, current_);
+  for (int level = 0; level != kLevels; ++level) {
+    auto const shift = kLevelBits * level;
+    if (delta >> (shift + kLevelBits) != 0) continue;
+    auto const slot = (timer.deadline >> shift) & (kSlots - 1);
+    wheels_[level][slot].push_back(std::move(timer));
+    return;
+  }
+  // Beyond the range of the wheel. Park the timer in the last slot of the
+  // outermost wheel, it is inserted again when that slot is cascaded.
+  auto constexpr kShift = kLevelBits * (kLevels - 1);
+  auto const parked =
+      current_ + (std::uint64_t{1} << (kShift + kLevelBits)) - 1;
+  wheels_[kLevels - 1][(parked >> kShift) & (kSlots - 1)].push_back(
+      std::move(timer));
+}
+
+void TimerWheel::StartTimer(std::unique_lock<std::mutex> lk) {
+  running_ = true;
+  auto cq = cq_;
+  lk.unlock();
+  auto self = shared_from_this();
+  cq.MakeRelativeTimer(tick_).then(
+      [self](future<StatusOr<std::chrono::system_clock::time_point>> f) {
+        self->OnTimer(f.get().status());
+      });
+}
+
+void TimerWheel::OnTimer(Status const& status) {
+  std::vector<Timer> expired;
+  std::unique_lock<std::mutex> lk(mu_);
+  if (!status.ok()) {
+    // The completion queue is shutting down, no timer can expire.
+    for (auto& wheel : wheels_) {
+      for (auto& slot : wheel) {
+        std::move(slot.begin(), slot.end(), std::back_inserter(expired));
+        slot.clear();
+      }
+    }
+    size_ = 0;
+    running_ = false;
+    lk.unlock();
+    for (auto& t : expired) t.expired.set_value(status);
+    return;
+  }
+  Advance(CurrentTick(), expired);
+  if (size_ == 0) {
+    running_ = false;
+    lk.unlock();
+  } else {
+    StartTimer(std::move(lk));
+  }
+  auto const now = std::chrono::system_clock::now();
+  for (auto& t : expired) t.expired.set_value(now);
+}
+
+void TimerWheel::Advance(std::uint64_t tick, std::vector<Timer>& expired) {
+  while (current_ < tick) {
+    ++current_;
+    // Move the timers in the slots reached by the outer wheels to the inner
+    // wheels, starting with the outermost, then expire the innermost slot.
+    for (int level = kLevels - 1; level != 0; --level) {
+      auto const shift = kLevelBits * level;
+      if ((current_ & ((std::uint64_t{1} << shift) - 1)) != 0) continue;
+      Slot slot;
+      slot.swap(wheels_[level][(current_ >> shift) & (kSlots - 1)]);
+      for (auto& t : slot) Insert(std::move(t));
+    }
+    auto& slot = wheels_[0][current_ & (kSlots - 1)];
+    size_ -= slot.size();
+    std::move(slot.begin(), slot.end(), std::back_inserter(expired));
+    slot.clear();
+  }
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
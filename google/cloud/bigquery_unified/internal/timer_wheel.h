@@ -0,0 +1,103 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_TIMER_WHEEL_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_TIMER_WHEEL_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/completion_queue.h"
+#include "google/cloud/future.h"
+#include "google/cloud/status_or.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * Shares a single completion queue timer among many pending timers.
+ *
+ * Each polling loop waits between polls. With a completion queue timer per
+ * wait, tens of thousands of outstanding jobs mean tens of thousands of
+ * timers, each with its own allocation and completion queue tag. This class
+ * keeps the pending timers in a hierarchical timer wheel instead, where each
+ * timer is a small record in a slot, and drives the wheel with one completion
+ * queue timer that fires every @p tick.
+ *
+ * Timers expire at the first tick after their deadline, so they may fire up
+ * to @p tick late. The completion queue timer only runs while there are
+ * pending timers.
+ */
+class TimerWheel : public std::enable_shared_from_this<TimerWheel> {
+ public:
+  using Clock = std::function<std::chrono::steady_clock::time_point()>;
+  using TimerResult = StatusOr<std::chrono::system_clock::time_point>;
+
+  explicit TimerWheel(
+      std::chrono::milliseconds tick,
+      Clock clock = [] { return std::chrono::steady_clock::now(); });
+
+  /**
+   * Returns a future satisfied after @p duration.
+   *
+   * Like `CompletionQueue::MakeRelativeTimer()`, the future is satisfied with
+   * an error if the completion queue is shut down. The wheel is driven by @p cq
+   * if it is not already running.
+   */
+  future<TimerResult> MakeRelativeTimer(CompletionQueue cq,
+                                        std::chrono::milliseconds duration);
+
+  /// The number of pending timers.
+  std::size_t size() const;
+
+ private:
+  static constexpr int kLevelBits = 6;
+  static constexpr std::size_t kSlots = std::size_t{1} << kLevelBits;
+  static constexpr int kLevels = 4;
+
+  struct Timer {
+    std::uint64_t deadline;
+    promise<TimerResult> expired;
+  };
+  using Slot = std::vector<Timer>;
+  using Wheel = std::array<Slot, kSlots>;
+
+  std::uint64_t CurrentTick() const;
+  void Insert(Timer timer);
+  void StartTimer(std::unique_lock<std::mutex> lk);
+  void OnTimer(Status const& status);
+  void Advance(std::uint64_t tick, std::vector<Timer>& expired);
+
+  std::chrono::milliseconds const tick_;
+  Clock clock_;
+  std::chrono::steady_clock::time_point const start_;
+
+  mutable std::mutex mu_;
+  CompletionQueue cq_;                 // GUARDED_BY(mu_)
+  bool running_ = false;               // GUARDED_BY(mu_)
+  std::uint64_t current_ = 0;          // GUARDED_BY(mu_)
+  std::size_t size_ = 0;               // GUARDED_BY(mu_)
+  std::array<Wheel, kLevels> wheels_;  // GUARDED_BY(mu_)
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_INTERNAL_TIMER_WHEEL_H
@@ -0,0 +1,119 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/internal/timer_wheel.h"
+#include "google/cloud/bigquery_unified/testing_util/status_matchers.h"
+#include "google/cloud/internal/rest_background_threads_impl.h"
+#include <gmock/gmock.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery_unified::testing_util::IsOk;
+using ::testing::Not;
+
+// A steady clock that only moves when the test says so.
+class FakeClock {
+ public:
+  TimerWheel::Clock clock() const {
+    return [now = now_] {
+      return std::chrono::steady_clock::time_point(
+          std::chrono::milliseconds(now->load()));
+    };
+  }
+  void Advance(std::chrono::milliseconds d) { *now_ += d.count(); }
+
+ private:
+  std::shared_ptr<std::atomic<std::int64_t>> now_ =
+      std::make_shared<std::atomic<std::int64_t>>(0);
+};
+
+TEST(TimerWheelTest, ExpiresOnEveryLevel) {
+  rest_internal::AutomaticallyCreatedRestBackgroundThreads background;
+  FakeClock clock;
+  auto wheel = std::make_shared<TimerWheel>(std::chrono::milliseconds(1),
+                                            clock.clock());
+
+  auto level0 = wheel->MakeRelativeTimer(background.cq(),
+                                         std::chrono::milliseconds(5));
+  auto level1 = wheel->MakeRelativeTimer(background.cq(),
+                                         std::chrono::milliseconds(100));
+  auto level2 = wheel->MakeRelativeTimer(background.cq(),
+                                         std::chrono::milliseconds(5000));
+  auto parked = wheel->MakeRelativeTimer(background.cq(),
+                                         std::chrono::hours(6));
+  EXPECT_EQ(wheel->size(), 4U);
+
+  clock.Advance(std::chrono::milliseconds(5));
+  EXPECT_THAT(level0.get(), IsOk());
+  EXPECT_FALSE(level1.is_ready());
+
+  clock.Advance(std::chrono::milliseconds(95));
+  EXPECT_THAT(level1.get(), IsOk());
+  EXPECT_FALSE(level2.is_ready());
+
+  clock.Advance(std::chrono::milliseconds(4900));
+  EXPECT_THAT(level2.get(), IsOk());
+  EXPECT_FALSE(parked.is_ready());
+  EXPECT_EQ(wheel->size(), 1U);
+
+  clock.Advance(std::chrono::hours(6));
+  EXPECT_THAT(parked.get(), IsOk());
+  EXPECT_EQ(wheel->size(), 0U);
+}
+
+TEST(TimerWheelTest, ExpiresInOrder) {
+  rest_internal::AutomaticallyCreatedRestBackgroundThreads background;
+  FakeClock clock;
+  auto wheel = std::make_shared<TimerWheel>(std::chrono::milliseconds(10),
+                                            clock.clock());
+
+  auto late = wheel->MakeRelativeTimer(background.cq(),
+                                       std::chrono::milliseconds(25));
+  auto early = wheel->MakeRelativeTimer(background.cq(),
+                                        std::chrono::milliseconds(15));
+
+  // Deadlines are rounded up to the next tick.
+  clock.Advance(std::chrono::milliseconds(19));
+  EXPECT_FALSE(early.is_ready());
+  clock.Advance(std::chrono::milliseconds(1));
+  EXPECT_THAT(early.get(), IsOk());
+  EXPECT_FALSE(late.is_ready());
+  clock.Advance(std::chrono::milliseconds(10));
+  EXPECT_THAT(late.get(), IsOk());
+}
+
+TEST(TimerWheelTest, Shutdown) {
+  CompletionQueue cq;
+  std::thread t([&cq] { cq.Run(); });
+  FakeClock clock;
+  auto wheel = std::make_shared<TimerWheel>(std::chrono::milliseconds(10),
+                                            clock.clock());
+
+  auto timer = wheel->MakeRelativeTimer(cq, std::chrono::hours(1));
+  cq.Shutdown();
+  EXPECT_THAT(timer.get(), Not(IsOk()));
+  EXPECT_EQ(wheel->size(), 0U);
+  t.join();
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
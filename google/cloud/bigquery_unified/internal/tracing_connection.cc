@@ -25,6 +25,12 @@ TracingConnection::TracingConnection(
     std::shared_ptr<bigquery_unified::Connection> child)
     : child_(std::move(child)) {}
 
+future<Status> TracingConnection::WarmUp(Options opts) {
+  auto span = internal::MakeSpan("bigquery_unified::Connection::WarmUp");
+  internal::OTelScope scope(span);
+  return internal::EndSpan(std::move(span), child_->WarmUp(opts));
+}
+
 future<StatusOr<google::cloud::bigquery::v2::Job>> TracingConnection::CancelJob(
     google::cloud::bigquery::v2::CancelJobRequest const& request,
     Options opts) {
@@ -85,6 +91,17 @@ future<StatusOr<google::cloud::bigquery::v2::Job>> TracingConnection::InsertJob(
                            child_->InsertJob(job_reference, opts));
 }
 
+std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>>
+TracingConnection::InsertJobs(
+    std::vector<google::cloud::bigquery::v2::Job> jobs, Options opts) {
+  auto span = internal::MakeSpan("bigquery_unified::Connection::InsertJobs");
+  internal::OTelScope scope(span);
+  auto futures = child_->InsertJobs(std::move(jobs), opts);
+  // The span covers the submission of the jobs, each job completes separately.
+  span->End();
+  return futures;
+}
+
 Status TracingConnection::DeleteJob(
     google::cloud::bigquery::v2::DeleteJobRequest const& request,
     Options opts) {
@@ -93,6 +110,22 @@ Status TracingConnection::DeleteJob(
   return internal::EndSpan(*span, child_->DeleteJob(request, opts));
 }
 
+StatusOr<std::vector<bigquery_unified::JobOperationResult>>
+TracingConnection::CancelJobs(bigquery_unified::JobFilter const& filter,
+                              Options opts) {
+  auto span = internal::MakeSpan("bigquery_unified::Connection::CancelJobs");
+  auto scope = opentelemetry::trace::Scope(span);
+  return internal::EndSpan(*span, child_->CancelJobs(filter, opts));
+}
+
+StatusOr<std::vector<bigquery_unified::JobOperationResult>>
+TracingConnection::DeleteJobs(bigquery_unified::JobFilter const& filter,
+                              Options opts) {
+  auto span = internal::MakeSpan("bigquery_unified::Connection::DeleteJobs");
+  auto scope = opentelemetry::trace::Scope(span);
+  return internal::EndSpan(*span, child_->DeleteJobs(filter, opts));
+}
+
 StreamRange<google::cloud::bigquery::v2::ListFormatJob>
 TracingConnection::ListJobs(
     google::cloud::bigquery::v2::ListJobsRequest request, Options opts) {
@@ -104,12 +137,58 @@ TracingConnection::ListJobs(
                                                   std::move(sr));
 }
 
+StreamRange<google::cloud::bigquery::v2::ListFormatJob>
+TracingConnection::ListJobsInProjects(
+    std::vector<google::cloud::bigquery::v2::ListJobsRequest> requests,
+    Options opts) {
+  auto span =
+      internal::MakeSpan("bigquery_unified::Connection::ListJobsInProjects");
+  internal::OTelScope scope(span);
+  auto sr = child_->ListJobsInProjects(std::move(requests), opts);
+  return internal::MakeTracedStreamRange<
+      google::cloud::bigquery::v2::ListFormatJob>(std::move(span),
+                                                  std::move(sr));
+}
+
 StatusOr<bigquery_unified::ReadArrowResponse> TracingConnection::ReadArrow(
     google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
         read_session,
     Options opts) {
-  // Not add span tracing for now, will add it after discussion.
-  return child_->ReadArrow(read_session, opts);
+  // The span ends when the readers are created. The spans of their streams
+  // are its children, and end with the streams.
+  auto span = internal::MakeSpan("bigquery_unified::Connection::ReadArrow");
+  auto scope = opentelemetry::trace::Scope(span);
+  return internal::EndSpan(*span, child_->ReadArrow(read_session, opts));
+}
+
+StatusOr<bigquery_unified::ReadArrowPartitionsResponse>
+TracingConnection::ReadArrowPartitions(
+    std::map<std::string,
+             google::cloud::bigquery::storage::v1::CreateReadSessionRequest>
+        partition_requests,
+    Options opts) {
+  auto span =
+      internal::MakeSpan("bigquery_unified::Connection::ReadArrowPartitions");
+  auto scope = opentelemetry::trace::Scope(span);
+  return internal::EndSpan(
+      *span, child_->ReadArrowPartitions(std::move(partition_requests), opts));
+}
+
+future<StatusOr<bigquery_unified::ReadArrowResponse>>
+TracingConnection::QueryArrow(google::cloud::bigquery::v2::Job const& job,
+                              Options opts) {
+  auto span = internal::MakeSpan("bigquery_unified::Connection::QueryArrow");
+  internal::OTelScope scope(span);
+  return internal::EndSpan(std::move(span), child_->QueryArrow(job, opts));
+}
+
+StatusOr<std::shared_ptr<arrow::Schema>> TracingConnection::GetArrowSchema(
+    google::cloud::bigquery::v2::GetTableRequest const& request,
+    Options opts) {
+  auto span =
+      internal::MakeSpan("bigquery_unified::Connection::GetArrowSchema");
+  auto scope = opentelemetry::trace::Scope(span);
+  return internal::EndSpan(*span, child_->GetArrowSchema(request, opts));
 }
 #endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
 
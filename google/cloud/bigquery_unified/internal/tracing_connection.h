@@ -33,6 +33,8 @@ class TracingConnection : public bigquery_unified::Connection {
 
   Options options() override { return child_->options(); }
 
+  future<Status> WarmUp(Options opts) override;
+
   future<StatusOr<google::cloud::bigquery::v2::Job>> CancelJob(
       google::cloud::bigquery::v2::CancelJobRequest const& request,
       Options opts) override;
@@ -61,18 +63,45 @@ class TracingConnection : public bigquery_unified::Connection {
       google::cloud::bigquery::v2::JobReference const& job_reference,
       Options opts) override;
 
+  std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>> InsertJobs(
+      std::vector<google::cloud::bigquery::v2::Job> jobs,
+      Options opts) override;
+
   Status DeleteJob(google::cloud::bigquery::v2::DeleteJobRequest const& request,
                    Options opts) override;
 
+  StatusOr<std::vector<bigquery_unified::JobOperationResult>> CancelJobs(
+      bigquery_unified::JobFilter const& filter, Options opts) override;
+
+  StatusOr<std::vector<bigquery_unified::JobOperationResult>> DeleteJobs(
+      bigquery_unified::JobFilter const& filter, Options opts) override;
+
   StreamRange<google::cloud::bigquery::v2::ListFormatJob> ListJobs(
       google::cloud::bigquery::v2::ListJobsRequest request,
       Options opts) override;
 
+  StreamRange<google::cloud::bigquery::v2::ListFormatJob> ListJobsInProjects(
+      std::vector<google::cloud::bigquery::v2::ListJobsRequest> requests,
+      Options opts) override;
+
   StatusOr<bigquery_unified::ReadArrowResponse> ReadArrow(
       google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
           read_session,
       Options opts) override;
 
+  StatusOr<bigquery_unified::ReadArrowPartitionsResponse> ReadArrowPartitions(
+      std::map<std::string,
+               google::cloud::bigquery::storage::v1::CreateReadSessionRequest>
+          partition_requests,
+      Options opts) override;
+
+  future<StatusOr<bigquery_unified::ReadArrowResponse>> QueryArrow(
+      google::cloud::bigquery::v2::Job const& job, Options opts) override;
+
+  StatusOr<std::shared_ptr<arrow::Schema>> GetArrowSchema(
+      google::cloud::bigquery::v2::GetTableRequest const& request,
+      Options opts) override;
+
  private:
   std::shared_ptr<bigquery_unified::Connection> child_;
 };
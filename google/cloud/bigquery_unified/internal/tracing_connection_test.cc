@@ -168,6 +168,31 @@ TEST(TracingConnectionTest, GetJob) {
               OTelAttribute<std::string>("gl-cpp.status_code", kErrorCode)))));
 }
 
+TEST(TracingConnectionTest, GetArrowSchema) {
+  auto span_catcher = InstallSpanCatcher();
+
+  auto mock = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock, GetArrowSchema).WillOnce([] {
+    EXPECT_TRUE(ThereIsAnActiveSpan());
+    return internal::AbortedError("fail");
+  });
+
+  auto under_test = TracingConnection(mock);
+  google::cloud::bigquery::v2::GetTableRequest request;
+  auto result = under_test.GetArrowSchema(request, Options{});
+  EXPECT_THAT(result, StatusIs(StatusCode::kAborted));
+
+  auto spans = span_catcher->GetSpans();
+  EXPECT_THAT(
+      spans,
+      ElementsAre(AllOf(
+          SpanHasInstrumentationScope(), SpanKindIsClient(),
+          SpanNamed("bigquery_unified::Connection::GetArrowSchema"),
+          SpanWithStatus(opentelemetry::trace::StatusCode::kError, "fail"),
+          SpanHasAttributes(
+              OTelAttribute<std::string>("gl-cpp.status_code", kErrorCode)))));
+}
+
 TEST(TracingConnectionTest, InsertJobAwait) {
   auto span_catcher = InstallSpanCatcher();
 
@@ -256,6 +281,33 @@ TEST(TracingConnectionTest, InsertJobPoll) {
               OTelAttribute<std::string>("gl-cpp.status_code", kErrorCode)))));
 }
 
+TEST(TracingConnectionTest, InsertJobs) {
+  auto span_catcher = InstallSpanCatcher();
+
+  auto mock = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock, InsertJobs).WillOnce([] {
+    EXPECT_TRUE(ThereIsAnActiveSpan());
+    std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>> result;
+    result.push_back(
+        make_ready_future<StatusOr<google::cloud::bigquery::v2::Job>>(
+            internal::AbortedError("fail")));
+    return result;
+  });
+
+  auto under_test = TracingConnection(mock);
+  auto result =
+      under_test.InsertJobs({google::cloud::bigquery::v2::Job{}}, Options{});
+  ASSERT_EQ(result.size(), 1U);
+  EXPECT_THAT(result[0].get(), StatusIs(StatusCode::kAborted));
+
+  auto spans = span_catcher->GetSpans();
+  EXPECT_THAT(
+      spans,
+      ElementsAre(AllOf(
+          SpanHasInstrumentationScope(), SpanKindIsClient(),
+          SpanNamed("bigquery_unified::Connection::InsertJobs"))));
+}
+
 TEST(TracingConnectionTest, DeleteJob) {
   auto span_catcher = InstallSpanCatcher();
 
@@ -281,6 +333,54 @@ TEST(TracingConnectionTest, DeleteJob) {
               OTelAttribute<std::string>("gl-cpp.status_code", kErrorCode)))));
 }
 
+TEST(TracingConnectionTest, CancelJobs) {
+  auto span_catcher = InstallSpanCatcher();
+
+  auto mock = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock, CancelJobs).WillOnce([] {
+    EXPECT_TRUE(ThereIsAnActiveSpan());
+    return internal::AbortedError("fail");
+  });
+
+  auto under_test = TracingConnection(mock);
+  auto result = under_test.CancelJobs(bigquery_unified::JobFilter{}, Options{});
+  EXPECT_THAT(result, StatusIs(StatusCode::kAborted));
+
+  auto spans = span_catcher->GetSpans();
+  EXPECT_THAT(
+      spans,
+      ElementsAre(AllOf(
+          SpanHasInstrumentationScope(), SpanKindIsClient(),
+          SpanNamed("bigquery_unified::Connection::CancelJobs"),
+          SpanWithStatus(opentelemetry::trace::StatusCode::kError, "fail"),
+          SpanHasAttributes(
+              OTelAttribute<std::string>("gl-cpp.status_code", kErrorCode)))));
+}
+
+TEST(TracingConnectionTest, DeleteJobs) {
+  auto span_catcher = InstallSpanCatcher();
+
+  auto mock = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock, DeleteJobs).WillOnce([] {
+    EXPECT_TRUE(ThereIsAnActiveSpan());
+    return internal::AbortedError("fail");
+  });
+
+  auto under_test = TracingConnection(mock);
+  auto result = under_test.DeleteJobs(bigquery_unified::JobFilter{}, Options{});
+  EXPECT_THAT(result, StatusIs(StatusCode::kAborted));
+
+  auto spans = span_catcher->GetSpans();
+  EXPECT_THAT(
+      spans,
+      ElementsAre(AllOf(
+          SpanHasInstrumentationScope(), SpanKindIsClient(),
+          SpanNamed("bigquery_unified::Connection::DeleteJobs"),
+          SpanWithStatus(opentelemetry::trace::StatusCode::kError, "fail"),
+          SpanHasAttributes(
+              OTelAttribute<std::string>("gl-cpp.status_code", kErrorCode)))));
+}
+
 TEST(TracingConnectionTest, ListJobs) {
   auto span_catcher = InstallSpanCatcher();
 
@@ -311,6 +411,88 @@ TEST(TracingConnectionTest, ListJobs) {
               OTelAttribute<std::string>("gl-cpp.status_code", kErrorCode)))));
 }
 
+TEST(TracingConnectionTest, ListJobsInProjects) {
+  auto span_catcher = InstallSpanCatcher();
+
+  auto mock = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock, ListJobsInProjects).WillOnce([] {
+    EXPECT_TRUE(ThereIsAnActiveSpan());
+    EXPECT_TRUE(OTelContextCaptured());
+    return bigquery_unified_mocks::MakeStreamRange<
+        google::cloud::bigquery::v2::ListFormatJob>(
+        {}, internal::AbortedError("fail"));
+  });
+
+  auto under_test = TracingConnection(mock);
+  auto stream = under_test.ListJobsInProjects(
+      std::vector<google::cloud::bigquery::v2::ListJobsRequest>(2), Options{});
+  auto it = stream.begin();
+  EXPECT_THAT(*it, StatusIs(StatusCode::kAborted));
+  EXPECT_EQ(++it, stream.end());
+
+  auto spans = span_catcher->GetSpans();
+  EXPECT_THAT(
+      spans,
+      ElementsAre(AllOf(
+          SpanHasInstrumentationScope(), SpanKindIsClient(),
+          SpanNamed("bigquery_unified::Connection::ListJobsInProjects"),
+          SpanWithStatus(opentelemetry::trace::StatusCode::kError, "fail"),
+          SpanHasAttributes(
+              OTelAttribute<std::string>("gl-cpp.status_code", kErrorCode)))));
+}
+
+TEST(TracingConnectionTest, ReadArrow) {
+  auto span_catcher = InstallSpanCatcher();
+
+  auto mock = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock, ReadArrow).WillOnce([] {
+    EXPECT_TRUE(ThereIsAnActiveSpan());
+    return internal::AbortedError("fail");
+  });
+
+  auto under_test = TracingConnection(mock);
+  google::cloud::bigquery::storage::v1::CreateReadSessionRequest request;
+  auto result = under_test.ReadArrow(request, Options{});
+  EXPECT_THAT(result, StatusIs(StatusCode::kAborted));
+
+  auto spans = span_catcher->GetSpans();
+  EXPECT_THAT(
+      spans,
+      ElementsAre(AllOf(
+          SpanHasInstrumentationScope(), SpanKindIsClient(),
+          SpanNamed("bigquery_unified::Connection::ReadArrow"),
+          SpanWithStatus(opentelemetry::trace::StatusCode::kError, "fail"),
+          SpanHasAttributes(
+              OTelAttribute<std::string>("gl-cpp.status_code", kErrorCode)))));
+}
+
+TEST(TracingConnectionTest, QueryArrow) {
+  auto span_catcher = InstallSpanCatcher();
+
+  auto mock = std::make_shared<MockConnection>();
+  EXPECT_CALL(*mock, QueryArrow).WillOnce([] {
+    EXPECT_TRUE(ThereIsAnActiveSpan());
+    EXPECT_TRUE(OTelContextCaptured());
+    return make_ready_future<StatusOr<bigquery_unified::ReadArrowResponse>>(
+        internal::AbortedError("fail"));
+  });
+
+  auto under_test = TracingConnection(mock);
+  google::cloud::bigquery::v2::Job job;
+  auto result = under_test.QueryArrow(job, Options{}).get();
+  EXPECT_THAT(result, StatusIs(StatusCode::kAborted));
+
+  auto spans = span_catcher->GetSpans();
+  EXPECT_THAT(
+      spans,
+      ElementsAre(AllOf(
+          SpanHasInstrumentationScope(), SpanKindIsClient(),
+          SpanNamed("bigquery_unified::Connection::QueryArrow"),
+          SpanWithStatus(opentelemetry::trace::StatusCode::kError, "fail"),
+          SpanHasAttributes(
+              OTelAttribute<std::string>("gl-cpp.status_code", kErrorCode)))));
+}
+
 #endif  // GOOGLE_CLOUD_CPP_BIGQUERY_HAVE_OPENTELEMETRY
 
 }  // namespace
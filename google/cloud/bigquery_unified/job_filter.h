@@ -0,0 +1,67 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_JOB_FILTER_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_JOB_FILTER_H
+
+#include "google/cloud/bigquery_unified/job_options.h"
+#include "google/cloud/bigquery_unified/version.h"
+#include "google/cloud/status.h"
+#include <google/cloud/bigquery/v2/job_reference.pb.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace google::cloud::bigquery_unified {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ *  Selects the jobs of a project by their labels and state.
+ *
+ *  @see `Client::CancelJobs()`, `Client::DeleteJobs()`
+ */
+struct JobFilter {
+  /// The project containing the jobs.
+  std::string project_id;
+
+  /// Only the jobs with all of these labels, with the same values, match. The
+  /// service cannot filter jobs by label, so the jobs are listed with their
+  /// configuration and matched by the client.
+  std::map<std::string, std::string> labels;
+
+  /// Only the jobs in these states match. If empty, `CancelJobs()` matches the
+  /// pending and running jobs, and `DeleteJobs()` matches jobs in any state.
+  std::vector<JobState> states;
+
+  /// Match the jobs created by all users, not only the jobs created by the
+  /// current principal. This requires the Owner role on the project.
+  bool all_users = false;
+};
+
+/**
+ *  The outcome of cancelling or deleting one of the jobs matched by a
+ *  `JobFilter`.
+ */
+struct JobOperationResult {
+  /// The job.
+  google::cloud::bigquery::v2::JobReference job_reference;
+
+  /// The result of the operation on the job.
+  Status status;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_JOB_FILTER_H
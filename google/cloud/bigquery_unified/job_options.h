@@ -21,7 +21,11 @@
 #include "google/cloud/backoff_policy.h"
 #include "google/cloud/options.h"
 #include "google/cloud/polling_policy.h"
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace google::cloud::bigquery_unified {
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
@@ -49,6 +53,127 @@ struct BillingProjectOption {
   using Type = std::string;
 };
 
+/**
+ * Use with `google::cloud::Options` to wait for each job cancelled by
+ * `CancelJobs()` to complete.
+ *
+ * By default `CancelJobs()` returns once the cancellation of each job is
+ * requested. When set to `true`, each job is also awaited as in
+ * `CancelJob()`, and its result reports any error awaiting the job.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct CancelJobsAwaitOption {
+  using Type = bool;
+};
+
+/**
+ * The strategies available to detect the completion of a job.
+ *
+ * @see `JobCompletionStrategyOption`
+ */
+enum class JobCompletionStrategy {
+  /// Call `jobs.get` on the schedule of the `PollingPolicyOption`.
+  kPoll,
+  /// For query jobs, call `jobs.getQueryResults` with a server-side timeout,
+  /// which returns as soon as the job completes. Other jobs use `kPoll`.
+  kLongPoll,
+  /// Share a single polling loop among all the jobs awaited by the connection.
+  /// Every `JobWatchPeriodOption` the loop lists the completed jobs of each
+  /// project with `jobs.list`, and only calls `jobs.get` for the jobs found
+  /// in the list. `jobs.list` only returns the jobs created by the current
+  /// principal, so a job that is not listed is also checked with `jobs.get`
+  /// every 10 periods.
+  kWatch,
+};
+
+/**
+ * Use with `google::cloud::Options` to configure how the completion of a job
+ * is detected when awaiting `InsertJob()` and `CancelJob()`.
+ *
+ * With `JobCompletionStrategy::kLongPoll` (the default) each poll of a query
+ * job blocks in the service for up to `JobLongPollTimeoutOption`, and the next
+ * poll starts immediately after it. The `PollingPolicyOption` still limits the
+ * total polling time, and its backoff applies after failed polls. The time
+ * spent in a long poll counts towards the next backoff, so once the backoff is
+ * longer than the long poll, polls are no more frequent than with `kPoll`.
+ *
+ * Each pending long poll uses a thread. A connection runs at most
+ * `MaxConcurrentRpcsOption` long polls, see `BlockingThreadPoolOption` for
+ * shared pools. When no thread is free, the job is polled with `jobs.get`
+ * instead, and waits for the backoff of the `PollingPolicyOption`.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct JobCompletionStrategyOption {
+  using Type = JobCompletionStrategy;
+};
+
+/**
+ * Use with `google::cloud::Options` to configure how long each long poll for
+ * the completion of a query job waits in the service.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct JobLongPollTimeoutOption {
+  using Type = std::chrono::milliseconds;
+};
+
+/**
+ * Use with `google::cloud::Options` to configure how often the jobs awaited
+ * with `JobCompletionStrategy::kWatch` are polled.
+ *
+ * This option is read when the connection is created.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct JobWatchPeriodOption {
+  using Type = std::chrono::milliseconds;
+};
+
+/**
+ * The amount of detail returned for each job by `ListJobs()`.
+ */
+enum class ListJobsProjection {
+  /// Omit the job configuration.
+  kMinimal,
+  /// Include all the job data.
+  kFull,
+};
+
+/**
+ * Use with `google::cloud::Options` to configure the projection used by
+ * `ListJobs()`.
+ *
+ * When set, this overrides the `projection` field in the request. Listing
+ * many jobs with `ListJobsProjection::kMinimal` transfers much less data.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct ListJobsProjectionOption {
+  using Type = ListJobsProjection;
+};
+
+/**
+ * The job states used to filter the jobs returned by `ListJobs()`.
+ */
+enum class JobState {
+  kPending,
+  kRunning,
+  kDone,
+};
+
+/**
+ * Use with `google::cloud::Options` to list only the jobs in the given states.
+ *
+ * This option is ignored if the request sets its own `state_filter`.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct ListJobsStateFilterOption {
+  using Type = std::vector<JobState>;
+};
+
 /**
  * Use with `google::cloud::Options` to configure which operations are retried.
  *
@@ -76,11 +201,70 @@ struct RetryPolicyOption {
   using Type = std::shared_ptr<bigquery_unified::RetryPolicy>;
 };
 
+/**
+ * Use with `google::cloud::Options` to configure the maximum number of query
+ * results cached by the connection.
+ *
+ * When enabled, awaiting `InsertJob()` for a query that matches a recently
+ * completed query returns the completed job without starting a new one, and
+ * `ReadArrow()` reads the results from its destination table. Queries match if
+ * their text (ignoring whitespace), parameters, default dataset, project and
+ * location are the same. Only read-only queries without non-deterministic
+ * functions, such as `CURRENT_TIMESTAMP()` or `RAND()`, and without an explicit
+ * destination table or job id are cached, and setting `use_query_cache` to
+ * `false` in the query configuration disables caching for that query. Queries
+ * without a project in their job reference run in the `BillingProjectOption`
+ * project, and match the queries of that project.
+ *
+ * Jobs started with this connection that may modify tables, such as DML
+ * statements, load jobs and copy jobs, invalidate all the cached results.
+ * Changes made through other clients are not detected, use
+ * `QueryCacheTtlOption` to bound how stale the results may be.
+ *
+ * The cache is disabled if unset or zero. This option is read when the
+ * connection is created.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct QueryCacheSizeOption {
+  using Type = std::size_t;
+};
+
+/**
+ * Use with `google::cloud::Options` to configure how long query results are
+ * cached.
+ *
+ * The results of a query are stored in a temporary table that expires about
+ * 24 hours after the query completes, longer values are not useful.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct QueryCacheTtlOption {
+  using Type = std::chrono::milliseconds;
+};
+
+/**
+ * Use with `google::cloud::Options` to bypass any cached results of a query.
+ *
+ * When set to `true` the query runs even if its results are cached, and its
+ * results replace the cached ones.
+ *
+ * @ingroup google-cloud-bigquery-unified-options
+ */
+struct QueryCacheRefreshOption {
+  using Type = bool;
+};
+
 /** @} */
 
 using BigQueryJobOptionList =
     OptionList<BackoffPolicyOption, BillingProjectOption,
-               IdempotencyPolicyOption, PollingPolicyOption, RetryPolicyOption>;
+               CancelJobsAwaitOption, IdempotencyPolicyOption,
+               JobCompletionStrategyOption, JobLongPollTimeoutOption,
+               JobWatchPeriodOption, ListJobsProjectionOption,
+               ListJobsStateFilterOption, PollingPolicyOption,
+               QueryCacheRefreshOption, QueryCacheSizeOption,
+               QueryCacheTtlOption, RetryPolicyOption>;
 
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
 }  // namespace google::cloud::bigquery_unified
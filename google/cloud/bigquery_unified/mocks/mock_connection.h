@@ -34,6 +34,9 @@ class MockConnection : public bigquery_unified::Connection {
  public:
   MOCK_METHOD(Options, options, (), (override));
 
+  // WarmUp
+  MOCK_METHOD(future<Status>, WarmUp, (Options opts), (override));
+
   // CancelJob
   MOCK_METHOD(future<StatusOr<google::cloud::bigquery::v2::Job>>, CancelJob,
               (google::cloud::bigquery::v2::CancelJobRequest const& request,
@@ -63,12 +66,32 @@ class MockConnection : public bigquery_unified::Connection {
                Options opts),
               (override));
 
+  // CancelJobs
+  MOCK_METHOD(StatusOr<std::vector<bigquery_unified::JobOperationResult>>,
+              CancelJobs,
+              (bigquery_unified::JobFilter const& filter, Options opts),
+              (override));
+
+  // DeleteJobs
+  MOCK_METHOD(StatusOr<std::vector<bigquery_unified::JobOperationResult>>,
+              DeleteJobs,
+              (bigquery_unified::JobFilter const& filter, Options opts),
+              (override));
+
   // ListJobs
   MOCK_METHOD(StreamRange<google::cloud::bigquery::v2::ListFormatJob>, ListJobs,
               (google::cloud::bigquery::v2::ListJobsRequest request,
                Options opts),
               (override));
 
+  // ListJobsInProjects
+  MOCK_METHOD(
+      StreamRange<google::cloud::bigquery::v2::ListFormatJob>,
+      ListJobsInProjects,
+      (std::vector<google::cloud::bigquery::v2::ListJobsRequest> requests,
+       Options opts),
+      (override));
+
   // InsertJob
   MOCK_METHOD(future<StatusOr<google::cloud::bigquery::v2::Job>>, InsertJob,
               (google::cloud::bigquery::v2::Job const& job, Options opts),
@@ -84,12 +107,37 @@ class MockConnection : public bigquery_unified::Connection {
                Options opts),
               (override));
 
+  // InsertJobs
+  MOCK_METHOD(std::vector<future<StatusOr<google::cloud::bigquery::v2::Job>>>,
+              InsertJobs,
+              (std::vector<google::cloud::bigquery::v2::Job> jobs,
+               Options opts),
+              (override));
+
   MOCK_METHOD(
       StatusOr<bigquery_unified::ReadArrowResponse>, ReadArrow,
       (google::cloud::bigquery::storage::v1::CreateReadSessionRequest const&
            read_session,
        Options opts),
       (override));
+
+  MOCK_METHOD(
+      StatusOr<bigquery_unified::ReadArrowPartitionsResponse>,
+      ReadArrowPartitions,
+      ((std::map<std::string, google::cloud::bigquery::storage::v1::
+                                  CreateReadSessionRequest>),
+       Options),
+      (override));
+
+  MOCK_METHOD(future<StatusOr<bigquery_unified::ReadArrowResponse>>,
+              QueryArrow,
+              (google::cloud::bigquery::v2::Job const& job, Options opts),
+              (override));
+
+  MOCK_METHOD(StatusOr<std::shared_ptr<arrow::Schema>>, GetArrowSchema,
+              (google::cloud::bigquery::v2::GetTableRequest const& request,
+               Options opts),
+              (override));
 };
 
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
@@ -0,0 +1,55 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_PARTITION_RANGE_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_PARTITION_RANGE_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include "absl/time/civil_time.h"
+#include <string>
+
+namespace google::cloud::bigquery_unified {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ *  The maximum number of partitions in a `PartitionRange`.
+ *
+ *  Each partition is read by its own read session, larger ranges are rejected.
+ */
+auto constexpr kMaxPartitionRangeDays = 366;
+
+/**
+ *  A range of daily partitions in a date partitioned table.
+ *
+ *  The range may contain at most `kMaxPartitionRangeDays` partitions.
+ *
+ *  @see `Client::ReadArrowPartitions()`
+ */
+struct PartitionRange {
+  /// The partitioning column. Use `_PARTITIONDATE` (the default) for ingestion
+  /// time partitioned tables, or the name of the `DATE` column for tables
+  /// partitioned by a column. The name is quoted by the library.
+  std::string column = "_PARTITIONDATE";
+
+  /// The first partition in the range.
+  absl::CivilDay first;
+
+  /// The last partition in the range, inclusive.
+  absl::CivilDay last;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_PARTITION_RANGE_H
@@ -15,11 +15,14 @@
 #ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_READ_ARROW_RESPONSE_H
 #define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_READ_ARROW_RESPONSE_H
 
+#include "google/cloud/bigquery_unified/read_session_stats.h"
 #include "google/cloud/bigquery_unified/version.h"
 #include "google/cloud/stream_range.h"
 #include <google/protobuf/timestamp.pb.h>
 #include <arrow/record_batch.h>
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace google::cloud::bigquery_unified {
@@ -59,6 +62,54 @@ struct ReadArrowResponse {
 
   /// Contains one or more StreamRanges from which the data can be read.
   std::vector<StreamRange<std::shared_ptr<arrow::RecordBatch>>> readers;
+
+  /// The live statistics of the readers, updated as they are consumed. May be
+  /// null if the response was not created by the library.
+  std::shared_ptr<ReadSessionStats> stats;
+};
+
+/**
+ *  The key of the Arrow schema metadata entry containing the partition id in
+ *  the record batches returned by `Client::ReadArrowPartitions()`.
+ */
+auto constexpr kPartitionIdMetadataKey = "bigquery.partition_id";
+
+/**
+ *  Reads one stream of one partition in a `ReadArrowPartitions` call.
+ */
+struct PartitionReader {
+  /// The id of the partition read by this stream, in the `YYYYMMDD` format
+  /// used by BigQuery. The schema of each record batch contains the same value
+  /// under `kPartitionIdMetadataKey`.
+  std::string partition_id;
+
+  /// An estimate on the number of rows in the partition (not in this stream).
+  /// Partitions without any data have no streams, and thus no readers.
+  std::int64_t estimated_partition_row_count;
+
+  /// The record batches in this stream.
+  StreamRange<std::shared_ptr<arrow::RecordBatch>> reader;
+};
+
+/**
+ *  Contains data and metadata from a successful `ReadArrowPartitions` call.
+ */
+struct ReadArrowPartitionsResponse {
+  /// The sum of the estimated bytes scanned by the read session of each
+  /// partition.
+  std::int64_t estimated_total_bytes_scanned;
+
+  /// The sum of the estimated row counts of each partition.
+  std::int64_t estimated_row_count;
+
+  /// The earliest time at which one of the read sessions becomes invalid.
+  google::protobuf::Timestamp expire_time;
+
+  /// The schema for the read, without the partition metadata.
+  std::shared_ptr<arrow::Schema> schema;
+
+  /// The streams of all partitions, ordered by partition.
+  std::vector<PartitionReader> readers;
 };
 
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
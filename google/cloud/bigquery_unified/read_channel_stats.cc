@@ -0,0 +1,53 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/read_channel_stats.h"
+#include "google/cloud/bigquery_unified/internal/read_channel_pool.h"
+#include <algorithm>
+#include <utility>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+void AttachReadChannelPool(bigquery_unified::ReadChannelPoolStats& stats,
+                           std::weak_ptr<ReadChannelPool const> pool) {
+  std::lock_guard<std::mutex> lk(stats.mu_);
+  // Drop the pools of the connections destroyed since the last call.
+  stats.pools_.erase(
+      std::remove_if(stats.pools_.begin(), stats.pools_.end(),
+                     [](auto const& p) { return p.expired(); }),
+      stats.pools_.end());
+  stats.pools_.push_back(std::move(pool));
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+namespace google::cloud::bigquery_unified {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+std::vector<ReadChannelStats> ReadChannelPoolStats::Channels() const {
+  std::vector<ReadChannelStats> result;
+  std::lock_guard<std::mutex> lk(mu_);
+  for (auto const& p : pools_) {
+    auto pool = p.lock();
+    if (!pool) continue;
+    auto stats = pool->Stats();
+    result.insert(result.end(), stats.begin(), stats.end());
+  }
+  return result;
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified
@@ -0,0 +1,89 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_READ_CHANNEL_STATS_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_READ_CHANNEL_STATS_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+class ReadChannelPool;
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+namespace google::cloud::bigquery_unified {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+class ReadChannelPoolStats;
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+void AttachReadChannelPool(bigquery_unified::ReadChannelPoolStats& stats,
+                           std::weak_ptr<ReadChannelPool const> pool);
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+namespace google::cloud::bigquery_unified {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/// A snapshot of the load of one Storage Read API channel.
+struct ReadChannelStats {
+  /// The `ReadRows` streams currently open on the channel.
+  std::size_t open_streams = 0;
+  /// The `ReadRows` streams started on the channel.
+  std::uint64_t total_streams = 0;
+  /// The serialized record batch bytes received on the channel.
+  std::uint64_t bytes_received = 0;
+};
+
+/**
+ * Reports the load of the Storage Read API channels of one or more
+ * connections.
+ *
+ * The channels are created by the first read of a connection, or by its
+ * warm-up, and reported until the connection is destroyed. A channel with many
+ * more open streams or bytes than the others points to an unbalanced read, a
+ * pool where all channels have many open streams may be too small, see
+ * `ReadChannelPoolSizeOption`.
+ *
+ * @see `ReadChannelStatsOption`
+ */
+class ReadChannelPoolStats {
+ public:
+  ReadChannelPoolStats() = default;
+
+  /// The load of each channel, in the order the connections created them.
+  std::vector<ReadChannelStats> Channels() const;
+
+ private:
+  friend void bigquery_unified_internal::AttachReadChannelPool(
+      ReadChannelPoolStats& stats,
+      std::weak_ptr<bigquery_unified_internal::ReadChannelPool const> pool);
+
+  mutable std::mutex mu_;
+  std::vector<std::weak_ptr<bigquery_unified_internal::ReadChannelPool const>>
+      pools_;
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_READ_CHANNEL_STATS_H
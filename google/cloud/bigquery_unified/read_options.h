@@ -15,8 +15,12 @@
 #ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_READ_OPTIONS_H
 #define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_READ_OPTIONS_H
 
+#include "google/cloud/bigquery_unified/read_channel_stats.h"
 #include "google/cloud/bigquery_unified/version.h"
 #include "google/cloud/options.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
 namespace google::cloud::bigquery_unified {
@@ -61,8 +65,254 @@ struct PreferredMinimumReadStreamsOption {
   using Type = int32_t;
 };
 
+/**
+ *  The strategies available to decide how many streams a read session uses.
+ *
+ *  @see `ReadStrategyOption`
+ */
+enum class ReadStrategy {
+  /// Use the estimated size of the data, when it is known before the read
+  /// session is created, to choose between `kSingleStream` and `kMultiStream`.
+  kAuto,
+  /// Always request a single stream. This minimizes the setup latency for
+  /// small results and preserves the order of the rows.
+  kSingleStream,
+  /// Let the service choose the number of streams to maximize throughput.
+  kMultiStream,
+};
+
+/**
+ *  Use with `google::cloud::Options` to configure how `Client::ReadArrow()`
+ *  chooses the number of streams in a read session.
+ *
+ *  With `ReadStrategy::kAuto` (the default), reads of the results of a
+ *  completed `Job` use the row count found in the job statistics. If the count
+ *  is at or below `SingleStreamRowThresholdOption` a single stream is
+ *  requested, otherwise the service picks the number of streams.
+ *
+ *  This option has no effect if `MaxReadStreamsOption` is set, and the
+ *  single stream strategies are not applied if
+ *  `PreferredMinimumReadStreamsOption` is set.
+ *
+ *  @ingroup google-cloud-bigquery-unified-options
+ */
+struct ReadStrategyOption {
+  using Type = ReadStrategy;
+};
+
+/**
+ *  Use with `google::cloud::Options` to configure the largest estimated number
+ *  of rows read with a single stream under `ReadStrategy::kAuto`.
+ *
+ *  @ingroup google-cloud-bigquery-unified-options
+ */
+struct SingleStreamRowThresholdOption {
+  using Type = std::int64_t;
+};
+
+/**
+ *  Use with `google::cloud::Options` to enable the read session cache, and to
+ *  configure the maximum number of sessions in it.
+ *
+ *  When enabled, `ReadArrow` calls that would create a read session identical
+ *  to one created by a previous call reuse that session instead, with new
+ *  readers starting from the beginning of each stream. Concurrent calls for
+ *  the same session wait for a single `CreateReadSession` RPC. A reused session
+ *  reads the table as of the time the session was created.
+ *
+ *  The cache is disabled if unset or zero.
+ *
+ *  @ingroup google-cloud-bigquery-unified-options
+ */
+struct ReadSessionCacheSizeOption {
+  using Type = std::size_t;
+};
+
+/**
+ *  Use with `google::cloud::Options` to configure how long before their
+ *  `expire_time` cached read sessions stop being reused.
+ *
+ *  Readers must finish before the session expires, so this should be larger
+ *  than the time needed to read the data. Sessions are evicted from the cache
+ *  once they are this close to their expiration.
+ *
+ *  @ingroup google-cloud-bigquery-unified-options
+ */
+struct ReadSessionCacheExpiryMarginOption {
+  using Type = std::chrono::milliseconds;
+};
+
+/**
+ *  Use with `google::cloud::Options` to configure how long
+ *  `Client::GetArrowSchema()` caches the schema of a table.
+ *
+ *  Set to zero to always fetch the table metadata. Changes to the schema of a
+ *  table may not be visible until the cached schema expires.
+ *
+ *  @ingroup google-cloud-bigquery-unified-options
+ */
+struct TableSchemaCacheTtlOption {
+  using Type = std::chrono::milliseconds;
+};
+
+/**
+ *  Use with `google::cloud::Options` to configure the maximum number of table
+ *  schemas cached by `Client::GetArrowSchema()`.
+ *
+ *  Once the cache is full, the schemas closest to expiration are evicted. Set
+ *  to zero to always fetch the table metadata. If unset, up to 1000 schemas
+ *  are cached.
+ *
+ *  @ingroup google-cloud-bigquery-unified-options
+ */
+struct TableSchemaCacheSizeOption {
+  using Type = std::size_t;
+};
+
+/**
+ *  Use with `google::cloud::Options` to configure the number of gRPC channels
+ *  used by the Storage Read API.
+ *
+ *  Each channel in the pool has its own connection, and each new `ReadRows`
+ *  stream starts on the channel with the fewest open streams, breaking ties by
+ *  the bytes received on those streams. Reads with many high-bandwidth streams
+ *  need several connections to use the available network throughput.
+ *
+ *  If unset or zero, the channels configured by `GrpcNumChannelsOption` are
+ *  used in round-robin order. This option is read when the connection is
+ *  created.
+ *
+ *  @ingroup google-cloud-bigquery-unified-options
+ */
+struct ReadChannelPoolSizeOption {
+  using Type = std::size_t;
+};
+
+/**
+ *  Use with `google::cloud::Options` to report the load of the Storage Read
+ *  API channels of a connection.
+ *
+ *  The application keeps a copy of the pointer and reads the load of each
+ *  channel at any time. Several connections may share the same
+ *  `ReadChannelPoolStats`. This option is read when the connection is created.
+ *
+ *  @ingroup google-cloud-bigquery-unified-options
+ */
+struct ReadChannelStatsOption {
+  using Type = std::shared_ptr<ReadChannelPoolStats>;
+};
+
+/**
+ *  Use with `google::cloud::Options` to configure the largest `ReadRows`
+ *  response, in bytes, accepted from the Storage Read API.
+ *
+ *  Responses larger than this fail the stream. A negative value removes the
+ *  limit. If unset, the gRPC default is used. This option is read when the
+ *  connection is created.
+ *
+ *  @ingroup google-cloud-bigquery-unified-options
+ */
+struct ReadMaxReceiveMessageSizeOption {
+  using Type = std::int32_t;
+};
+
+/**
+ *  Use with `google::cloud::Options` to configure the initial HTTP/2 flow
+ *  control window, in bytes, of each `ReadRows` stream.
+ *
+ *  The throughput of a stream is limited to one window per round trip. Reads
+ *  over high-latency links need a window of at least the bandwidth-delay
+ *  product of the link to use its capacity from the start of each stream. If
+ *  unset, the gRPC default is used. This option is read when the connection is
+ *  created.
+ *
+ *  @ingroup google-cloud-bigquery-unified-options
+ */
+struct ReadInitialWindowSizeOption {
+  using Type = std::int32_t;
+};
+
+/**
+ *  Use with `google::cloud::Options` to enable or disable the bandwidth-delay
+ *  product probing of the Storage Read API channels.
+ *
+ *  With probing enabled, gRPC measures the link and grows the flow control
+ *  windows of long streams beyond their initial size. If unset, the gRPC
+ *  default, which enables probing, is used. This option is read when the
+ *  connection is created.
+ *
+ *  @ingroup google-cloud-bigquery-unified-options
+ */
+struct ReadBdpProbeOption {
+  using Type = bool;
+};
+
+/**
+ *  Use with `google::cloud::Options` to configure how long a `ReadRows` stream
+ *  may wait for a response before it is considered stalled.
+ *
+ *  A stalled stream is cancelled and resumed at the first row it has not
+ *  delivered, transparently to the reader, as if its connection had failed.
+ *  The resumed call counts as a retry for the
+ *  `bigquery_storage_v1::BigQueryReadRetryPolicyOption`. Choose a value well
+ *  above the normal time between responses, which may be several seconds for
+ *  tables with large rows.
+ *
+ *  If unset or zero, streams have no idle timeout. This option is read when
+ *  the connection is created.
+ *
+ *  @ingroup google-cloud-bigquery-unified-options
+ */
+struct ReadRowsIdleTimeoutOption {
+  using Type = std::chrono::milliseconds;
+};
+
+/**
+ *  Use with `google::cloud::Options` to record OpenTelemetry metrics for the
+ *  record batches read from the Storage Read API.
+ *
+ *  The metrics count the bytes, batches and rows received, and measure the
+ *  time readers were blocked waiting for each `ReadRows` response and the time
+ *  spent decoding it. They are attributed to the project, dataset and table
+ *  read, the measurements of each read session and stream are in the
+ *  `ReadSessionStats` of the read. Readers that mostly wait are limited by the
+ *  network, readers that mostly decode are limited by the CPU.
+ *
+ *  Each connection creates its instruments with the global meter provider when
+ *  the connection is created, so the provider must be set before. If unset or
+ *  false, or if the library is built without OpenTelemetry, no metrics are
+ *  recorded.
+ *
+ *  @ingroup google-cloud-bigquery-unified-options
+ */
+struct EnableReadMetricsOption {
+  using Type = bool;
+};
+
+/**
+ *  Use with `google::cloud::Options` to configure how many record batches of
+ *  each stream are traced.
+ *
+ *  With OpenTelemetry tracing enabled, each `ReadRows` stream has a span, and
+ *  the decoding of its first record batch, then of one batch in every
+ *  `ReadDecodeSpanIntervalOption` batches, has a child span. A value of 1
+ *  traces every batch. If unset or zero, one batch in 100 is traced.
+ *
+ *  @ingroup google-cloud-bigquery-unified-options
+ */
+struct ReadDecodeSpanIntervalOption {
+  using Type = std::int64_t;
+};
+
 using BigQueryReadOptionList =
-    OptionList<MaxReadStreamsOption, PreferredMinimumReadStreamsOption>;
+    OptionList<MaxReadStreamsOption, PreferredMinimumReadStreamsOption,
+               ReadStrategyOption, SingleStreamRowThresholdOption,
+               ReadSessionCacheSizeOption, ReadSessionCacheExpiryMarginOption,
+               TableSchemaCacheTtlOption, TableSchemaCacheSizeOption,
+               ReadChannelPoolSizeOption, ReadChannelStatsOption,
+               ReadMaxReceiveMessageSizeOption, ReadInitialWindowSizeOption,
+               ReadBdpProbeOption, ReadRowsIdleTimeoutOption,
+               EnableReadMetricsOption, ReadDecodeSpanIntervalOption>;
 
 GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
 }  // namespace google::cloud::bigquery_unified
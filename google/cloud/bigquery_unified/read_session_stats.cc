@@ -0,0 +1,50 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/read_session_stats.h"
+#include <utility>
+
+namespace google::cloud::bigquery_unified {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+ReadSessionStats::ReadSessionStats(std::vector<std::string> stream_names)
+    : stream_names_(std::move(stream_names)),
+      streams_(stream_names_.size()),
+      started_(stream_names_.size(), false) {}
+
+ReadStreamStats ReadSessionStats::stream(std::size_t i) const {
+  std::lock_guard<std::mutex> lk(mu_);
+  return streams_[i];
+}
+
+ReadStreamStats ReadSessionStats::total() const {
+  std::lock_guard<std::mutex> lk(mu_);
+  ReadStreamStats total;
+  for (auto const& s : streams_) {
+    total.bytes_received += s.bytes_received;
+    total.rows += s.rows;
+    total.batches += s.batches;
+    total.decode_time += s.decode_time;
+    total.wait_time += s.wait_time;
+    total.resumes += s.resumes;
+    total.progress += s.progress;
+  }
+  if (!streams_.empty()) {
+    total.progress /= static_cast<double>(streams_.size());
+  }
+  return total;
+}
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified
@@ -0,0 +1,102 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_READ_SESSION_STATS_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_READ_SESSION_STATS_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace google::cloud::bigquery_unified_internal {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+class ReadSessionStatsRecorder;
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified_internal
+
+namespace google::cloud::bigquery_unified {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ * The statistics of one stream of a read session, or of all of its streams.
+ */
+struct ReadStreamStats {
+  /// The bytes of the serialized record batches received from the service.
+  std::int64_t bytes_received = 0;
+
+  /// The rows in the record batches delivered to the reader.
+  std::int64_t rows = 0;
+
+  /// The record batches delivered to the reader.
+  std::int64_t batches = 0;
+
+  /// The time spent decoding the record batches.
+  std::chrono::nanoseconds decode_time{0};
+
+  /// The time the reader was blocked waiting for the service.
+  std::chrono::nanoseconds wait_time{0};
+
+  /// The number of times the stream was resumed after an error, or after it
+  /// stalled.
+  std::int64_t resumes = 0;
+
+  /// The fraction of the rows of the stream read so far, between 0 and 1, as
+  /// reported by the service. For all the streams of a session, the mean of
+  /// their fractions.
+  double progress = 0;
+};
+
+/**
+ * The live statistics of the streams of one read session.
+ *
+ * The statistics are updated while the readers of a `ReadArrowResponse`
+ * consume their streams, and may be queried from any thread at any time, for
+ * example to report the progress of a read, or to estimate its remaining
+ * time.
+ */
+class ReadSessionStats {
+ public:
+  explicit ReadSessionStats(std::vector<std::string> stream_names);
+
+  /// The number of streams, the same as the number of readers.
+  std::size_t stream_count() const { return stream_names_.size(); }
+
+  /// The name of the stream read by `ReadArrowResponse::readers[i]`.
+  std::string const& stream_name(std::size_t i) const {
+    return stream_names_[i];
+  }
+
+  /// The statistics of the stream read by `ReadArrowResponse::readers[i]`.
+  ReadStreamStats stream(std::size_t i) const;
+
+  /// The statistics of all the streams.
+  ReadStreamStats total() const;
+
+ private:
+  friend class bigquery_unified_internal::ReadSessionStatsRecorder;
+
+  std::vector<std::string> const stream_names_;
+  mutable std::mutex mu_;
+  std::vector<ReadStreamStats> streams_;  // GUARDED_BY(mu_)
+  std::vector<bool> started_;             // GUARDED_BY(mu_)
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_READ_SESSION_STATS_H
@@ -0,0 +1,91 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "google/cloud/bigquery_unified/read_session_stats.h"
+#include "google/cloud/bigquery_unified/internal/read_session_stats_recorder.h"
+#include <gmock/gmock.h>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace google::cloud::bigquery_unified {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+namespace {
+
+using ::google::cloud::bigquery_unified_internal::ReadBatchMetrics;
+using ::google::cloud::bigquery_unified_internal::ReadSessionStatsRecorder;
+using ::testing::DoubleEq;
+
+ReadBatchMetrics MakeBatch(std::int64_t bytes, std::int64_t rows,
+                           double progress) {
+  ReadBatchMetrics batch;
+  batch.bytes = bytes;
+  batch.rows = rows;
+  batch.wait_time = std::chrono::milliseconds(2);
+  batch.decode_time = std::chrono::milliseconds(1);
+  batch.progress = progress;
+  return batch;
+}
+
+TEST(ReadSessionStatsTest, Empty) {
+  ReadSessionStats stats({"s/streams/a", "s/streams/b"});
+  EXPECT_EQ(stats.stream_count(), 2U);
+  EXPECT_EQ(stats.stream_name(1), "s/streams/b");
+  auto total = stats.total();
+  EXPECT_EQ(total.bytes_received, 0);
+  EXPECT_EQ(total.batches, 0);
+  EXPECT_THAT(total.progress, DoubleEq(0));
+}
+
+TEST(ReadSessionStatsTest, RecordsByStream) {
+  auto stats = std::make_shared<ReadSessionStats>(
+      std::vector<std::string>{"s/streams/a", "s/streams/b"});
+  ReadSessionStatsRecorder recorder(stats, nullptr);
+  recorder.RecordStreamStart("s/streams/a");
+  recorder.RecordBatch("s/streams/a", MakeBatch(100, 10, 0.25));
+  recorder.RecordBatch("s/streams/a", MakeBatch(100, 10, 0.5));
+  // A second call for the same stream resumes it.
+  recorder.RecordStreamStart("s/streams/a");
+  recorder.RecordStreamStart("s/streams/b");
+  recorder.RecordBatch("s/streams/b", MakeBatch(50, 5, 1.0));
+  // Streams of other sessions are ignored.
+  recorder.RecordStreamStart("t/streams/a");
+  recorder.RecordBatch("t/streams/a", MakeBatch(1000, 100, 1.0));
+
+  auto a = stats->stream(0);
+  EXPECT_EQ(a.bytes_received, 200);
+  EXPECT_EQ(a.rows, 20);
+  EXPECT_EQ(a.batches, 2);
+  EXPECT_EQ(a.wait_time, std::chrono::milliseconds(4));
+  EXPECT_EQ(a.decode_time, std::chrono::milliseconds(2));
+  EXPECT_EQ(a.resumes, 1);
+  EXPECT_THAT(a.progress, DoubleEq(0.5));
+
+  auto b = stats->stream(1);
+  EXPECT_EQ(b.bytes_received, 50);
+  EXPECT_EQ(b.resumes, 0);
+
+  auto total = stats->total();
+  EXPECT_EQ(total.bytes_received, 250);
+  EXPECT_EQ(total.rows, 25);
+  EXPECT_EQ(total.batches, 3);
+  EXPECT_EQ(total.wait_time, std::chrono::milliseconds(6));
+  EXPECT_EQ(total.resumes, 1);
+  EXPECT_THAT(total.progress, DoubleEq(0.75));
+}
+
+}  // namespace
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified
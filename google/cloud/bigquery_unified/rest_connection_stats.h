@@ -0,0 +1,47 @@
+// Copyright 2025 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_REST_CONNECTION_STATS_H
+#define GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_REST_CONNECTION_STATS_H
+
+#include "google/cloud/bigquery_unified/version.h"
+#include <atomic>
+#include <cstdint>
+
+namespace google::cloud::bigquery_unified {
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_BEGIN
+
+/**
+ *  Counts the job service HTTP requests of a `Connection`, and how many of
+ *  them could not reuse a pooled connection.
+ *
+ *  Only the requests that reached the service are counted. A high ratio of
+ *  `new_connections` to `requests` means the connection pool is too small for
+ *  the concurrency of the application, see `RestConnectionPoolSizeOption`.
+ *
+ *  @see `RestConnectionStatsOption`
+ */
+struct RestConnectionStats {
+  /// The requests sent to the service.
+  std::atomic<std::uint64_t> requests{0};
+
+  /// The requests that opened a new connection, with a new TCP and TLS
+  /// handshake.
+  std::atomic<std::uint64_t> new_connections{0};
+};
+
+GOOGLE_CLOUD_CPP_BIGQUERY_INLINE_NAMESPACE_END
+}  // namespace google::cloud::bigquery_unified
+
+#endif  // GOOGLE_CLOUD_CPP_BIGQUERY_GOOGLE_CLOUD_BIGQUERY_UNIFIED_REST_CONNECTION_STATS_H